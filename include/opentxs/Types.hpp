@@ -28,6 +28,8 @@
 
 #define OPENTXS_ARG_BACKUP_DIRECTORY "backupdirectory"
 #define OPENTXS_ARG_BINDIP "bindip"
+#define OPENTXS_ARG_BLOCK_CACHE "blockcache"
+#define OPENTXS_ARG_BLOCK_PRUNE "blockprune"
 #define OPENTXS_ARG_BLOCK_STORAGE_LEVEL "blockstoragelevel"
 #define OPENTXS_ARG_COMMANDPORT "commandport"
 #define OPENTXS_ARG_DISABLED_BLOCKCHAINS "disabledblockchain"
@@ -43,6 +45,7 @@
 #define OPENTXS_ARG_LOGENDPOINT "logendpoint"
 #define OPENTXS_ARG_LOGLEVEL "log_level"
 #define OPENTXS_ARG_NAME "name"
+#define OPENTXS_ARG_NOTARY_THREADS "notarythreads"
 #define OPENTXS_ARG_NOTIFICATIONPORT "notificationport"
 #define OPENTXS_ARG_ONION "onion"
 #define OPENTXS_ARG_PASSPHRASE "passphrase"
@@ -46,6 +46,9 @@ struct GCS {
         const ReadView previous) const noexcept = 0;
     OPENTXS_EXPORT virtual Matches Match(const Targets&) const noexcept = 0;
     virtual proto::GCS Serialize() const noexcept = 0;
+    /// Flat storage record which can be used without copying or parsing
+    OPENTXS_EXPORT virtual bool Serialize(
+        const AllocateOutput out) const noexcept = 0;
     OPENTXS_EXPORT virtual bool Test(const Data& target) const noexcept = 0;
     OPENTXS_EXPORT virtual bool Test(const ReadView target) const noexcept = 0;
     OPENTXS_EXPORT virtual bool Test(
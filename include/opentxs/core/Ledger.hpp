@@ -15,6 +15,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -130,6 +131,12 @@ public:
         transactionType theType);
     OPENTXS_EXPORT std::shared_ptr<OTTransaction> GetTransaction(
         const TransactionNumber number) const;
+    // For boxes, replaces an abbreviated transaction with its box receipt the
+    // first time it is requested, if the receipt can be loaded. Receipts
+    // which fail to load are not retried until LoadBoxReceipt or
+    // SaveBoxReceipt is called for them.
+    OPENTXS_EXPORT std::shared_ptr<OTTransaction> GetFullTransaction(
+        const TransactionNumber number);
     OPENTXS_EXPORT std::shared_ptr<OTTransaction> GetTransactionByIndex(
         std::int32_t nIndex) const;
     OPENTXS_EXPORT std::shared_ptr<OTTransaction> GetFinalReceipt(
@@ -157,6 +164,7 @@ public:
     //
     OPENTXS_EXPORT bool VerifyAccount(const identity::Nym& theNym) override;
     // For ALL abbreviated transactions, load the actual box receipt for each.
+    // Large boxes are read, parsed and verified in parallel.
     OPENTXS_EXPORT bool LoadBoxReceipts(
         std::set<std::int64_t>* psetUnloaded = nullptr);  // if psetUnloaded
                                                           // passed
@@ -276,6 +284,18 @@ private:  // Private prevents erroneous use by other classes.
 
     mapOfTransactions m_mapTransactions;  // a ledger contains a map of
                                           // transactions.
+    // Box receipts which GetFullTransaction failed to load
+    std::set<TransactionNumber> m_setUnloadedReceipts;
+
+    static std::vector<std::unique_ptr<OTTransaction>> load_box_receipts(
+        const api::internal::Core& api,
+        const ledgerType type,
+        const std::vector<std::shared_ptr<OTTransaction>>& abbreviated);
+
+    bool has_box_receipts() const;
+    std::shared_ptr<OTTransaction> get_transaction(
+        const TransactionNumber number) const;
+    void load_on_demand(std::shared_ptr<OTTransaction>& transaction);
 
     std::tuple<bool, std::string, std::string, std::string> make_filename(
         const ledgerType theType);
@@ -131,7 +131,26 @@ private:
         irr::io::IrrXMLReader*& xml);
 
 public:
+    // How a serialized message is framed between client and notary. Binary
+    // frames skip compression and base64, and are only sent to a notary by a
+    // client configured to use them. A notary replies in the same encoding as
+    // the request.
+    enum class Encoding : std::uint8_t { Armored = 0, Binary = 1 };
+
     OPENTXS_EXPORT static std::string Command(const MessageType type);
+    // Detects the encoding of a frame and extracts the serialized message
+    OPENTXS_EXPORT static bool Decode(
+        const std::string& frame,
+        String& serialized,
+        Encoding& encoding);
+    OPENTXS_EXPORT static std::string Encode(
+        const String& serialized,
+        const Encoding encoding);
+    // The reply a notary sends when it can not process a request. Armored
+    // requests get an empty frame as before. Binary requests get a binary
+    // frame without a message, which tells the client the notary decoded the
+    // request, unlike a notary which predates binary messages.
+    OPENTXS_EXPORT static std::string Failure(const Encoding encoding);
     OPENTXS_EXPORT static MessageType Type(const std::string& type);
     OPENTXS_EXPORT static std::string ReplyCommand(const MessageType type);
 
@@ -75,10 +75,11 @@ enum PackType             // PACKING TYPE
   PACK_TYPE_ERROR         // (Should never be.)
 };
 
-// Currently supporting filesystem, with subclasses possible via API.
+// Currently supporting filesystem and LMDB, with subclasses possible via API.
 //
 enum StorageType         // STORAGE TYPE
 { STORE_FILESYSTEM = 0,  // Filesystem
+  STORE_LMDB,            // One LMDB environment per data folder
   STORE_TYPE_SUBCLASS    // (Subclass provided by API client via SWIG.)
 };
 
@@ -44,6 +44,11 @@ struct Manager;
 }  // namespace server
 }  // namespace api
 
+namespace cron
+{
+class Schedule;
+}  // namespace cron
+
 namespace identifier
 {
 class Nym;
@@ -118,6 +123,9 @@ public:
     mapOfCronItems::iterator FindItemOnMap(std::int64_t lTransactionNum);
     multimapOfCronItems::iterator FindItemOnMultimap(
         std::int64_t lTransactionNum);
+    /** Move an item already on Cron to a new due time. Used when something
+     * other than the item itself (such as a market) changes its state. */
+    void RescheduleCronItem(std::int64_t lTransactionNum, const Time tDue);
     // MARKETS
     bool AddMarket(
         std::shared_ptr<OTMarket> theMarket,
@@ -154,7 +162,12 @@ public:
      * finished.) */
     void ProcessCronItems();
 
+    /** Time remaining until the next item is due, but never less than the
+     * time remaining until the next round is permitted. */
     std::chrono::milliseconds computeTimeout();
+    /** The earliest time any item on Cron needs processing, or Time::max()
+     * if Cron is empty. */
+    Time NextDeadline() const;
 
     inline void SetNotaryID(const identifier::Server& NOTARY_ID)
     {
@@ -204,6 +217,8 @@ private:
     // Cron Items are found on both lists.
     mapOfCronItems m_mapCronItems;
     multimapOfCronItems m_multimapCronItems;
+    // Only items which are due get processed each round.
+    std::unique_ptr<cron::Schedule> m_pSchedule;
     // Always store this in any object that's associated with a specific server.
     OTServerID m_NOTARY_ID;
     // I can't put receipts in people's inboxes without a supply of these.
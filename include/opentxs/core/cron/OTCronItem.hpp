@@ -116,7 +116,7 @@ public:
         const PasswordPrompt& reason);
 
     inline bool IsFlaggedForRemoval() const { return m_bRemovalFlag; }
-    inline void FlagForRemoval() { m_bRemovalFlag = true; }
+    void FlagForRemoval();
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
 
     OPENTXS_EXPORT static std::unique_ptr<OTCronItem> LoadCronReceipt(
@@ -163,6 +163,9 @@ public:
     {
         return m_PROCESS_INTERVAL;
     }
+    // The earliest time at which ProcessCron will do more than return early.
+    // OTCron uses this to avoid waking items which have nothing to do.
+    Time GetNextProcessDate() const;
 
     inline OTCron* GetCron() const { return m_pCron; }
     void setServerNym(Nym_p serverNym) { serverNym_ = serverNym; }
@@ -9,8 +9,10 @@
 #include "opentxs/Forward.hpp"  // IWYU pragma: associated
 
 #include <irrxml/irrXML.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 
 #include "opentxs/Types.hpp"
@@ -22,6 +24,7 @@
 #include "opentxs/core/identifier/Server.hpp"
 #include "opentxs/core/identifier/UnitDefinition.hpp"
 #include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OfferBook.hpp"
 
 namespace opentxs
 {
@@ -54,6 +57,7 @@ class TradeListMarket;
 class Account;
 class Armored;
 class Identifier;
+class MarketJournal;
 class OTCron;
 class OTOffer;
 class OTTrade;
@@ -62,12 +66,9 @@ class PasswordPrompt;
 #define MAX_MARKET_QUERY_DEPTH                                                 \
     50  // todo add this to the ini file. (Now that we actually have one.)
 
-// Multiple offers, mapped by price limit.
-// Using multi-map since there will be more than one offer for each single
-// price.
-// (Map would only allow a single item on the map for each price.)
-using mapOfOffers = std::multimap<std::int64_t, OTOffer*>;
-// The same offers are also mapped (uniquely) to transaction number.
+// Offers are kept in an OfferBook for each side of the market, grouped by
+// price limit. The same offers are also mapped (uniquely) to transaction
+// number.
 using mapOfOffersTrnsNum = std::map<std::int64_t, OTOffer*>;
 
 // A market has a list of OTOffers for all the bids, and another list of
@@ -90,6 +91,9 @@ public:
     bool RemoveOffer(
         const std::int64_t& lTransactionNum,
         const PasswordPrompt& reason);
+    // Persist the current state of a single offer which is on the market,
+    // for example after it has been re-signed.
+    bool SaveOffer(const OTOffer& theOffer, const PasswordPrompt& reason);
     // returns general information about offers on the market
     OPENTXS_EXPORT bool GetOfferList(
         Armored& ascOutput,
@@ -126,8 +130,8 @@ public:
     std::int64_t GetHighestBidPrice();
     std::int64_t GetLowestAskPrice();
 
-    mapOfOffers::size_type GetBidCount() { return m_mapBids.size(); }
-    mapOfOffers::size_type GetAskCount() { return m_mapAsks.size(); }
+    std::size_t GetBidCount() { return m_Bids.size(); }
+    std::size_t GetAskCount() { return m_Asks.size(); }
     void SetInstrumentDefinitionID(
         const identifier::UnitDefinition& INSTRUMENT_DEFINITION_ID)
     {
@@ -177,7 +181,11 @@ public:
 
     inline void SetCronPointer(OTCron& theCron) { m_pCron = &theCron; }
     inline OTCron* GetCron() { return m_pCron; }
+    // Loads the last signed snapshot of the market, then replays the changes
+    // journaled since.
     bool LoadMarket();
+    // Signs and saves a complete snapshot of the market, then clears the
+    // journal. Changes to individual offers are journaled instead.
     bool SaveMarket(const PasswordPrompt& reason);
 
     void InitMarket();
@@ -204,8 +212,8 @@ private:
 
     OTDB::TradeListMarket* m_pTradeList{nullptr};
 
-    mapOfOffers m_mapBids;  // The buyers, ordered by price limit
-    mapOfOffers m_mapAsks;  // The sellers, ordered by price limit
+    OfferBook m_Bids;  // The buyers, ordered by price limit
+    OfferBook m_Asks;  // The sellers, ordered by price limit
 
     mapOfOffersTrnsNum m_mapOffers;  // All of the offers on a single list,
                                      // ordered by transaction number.
@@ -231,6 +239,10 @@ private:
     std::int64_t m_lLastSalePrice{0};
     std::string m_strLastSaleDate;
 
+    // Changes to the book since the last snapshot. Created on first use
+    // since the market ID is not known at construction.
+    std::unique_ptr<MarketJournal> m_pJournal;
+
     // The server stores a map of markets, one for each unique combination of
     // instrument definitions. That's what this market class represents: one
     // instrument definition being traded and priced in another. It could be
@@ -251,6 +263,16 @@ private:
         const identifier::UnitDefinition& CURRENCY_TYPE_ID,
         const std::int64_t& lScale);
 
+    bool erase_offer(const std::int64_t& lTransactionNum);
+    MarketJournal& journal();
+    // Takes a snapshot if the append failed or the journal is long enough
+    bool journaled(const bool bAppended, const PasswordPrompt& reason);
+    bool journal_removal(
+        const std::int64_t& lTransactionNum,
+        const PasswordPrompt& reason);
+    bool journal_sale(const PasswordPrompt& reason);
+    bool replay_journal();
+    void save_trade_list();
     void rollback_four_accounts(
         Account& p1,
         bool b1,
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef OPENTXS_CORE_TRADE_OFFERBOOK_HPP
+#define OPENTXS_CORE_TRADE_OFFERBOOK_HPP
+
+#include "opentxs/Forward.hpp"  // IWYU pragma: associated
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <vector>
+
+namespace opentxs
+{
+class OTOffer;
+
+// One side of a market: every bid, or every ask.
+//
+// Offers are grouped into one level per price. The levels are kept in a
+// contiguous array sorted from the least to the most competitive price, so
+// the best level is always at the back, and each level holds its offers in
+// the order they were added to the market.
+//
+// Iteration visits the offers in matching priority: the best price first,
+// and the oldest offer first within a price.
+class OfferBook
+{
+public:
+    struct Level {
+        std::int64_t price_{0};
+        std::deque<OTOffer*> offers_{};
+    };
+
+    using Levels = std::vector<Level>;
+
+    class const_iterator
+    {
+    public:
+        using difference_type = std::ptrdiff_t;
+        using value_type = OTOffer*;
+        using pointer = OTOffer* const*;
+        using reference = OTOffer* const&;
+        using iterator_category = std::forward_iterator_tag;
+
+        OPENTXS_EXPORT reference operator*() const;
+        OPENTXS_EXPORT const_iterator& operator++();
+        OPENTXS_EXPORT const_iterator operator++(int);
+        OPENTXS_EXPORT bool operator==(const const_iterator& rhs) const;
+        OPENTXS_EXPORT bool operator!=(const const_iterator& rhs) const;
+
+        OPENTXS_EXPORT const_iterator(
+            const Levels& levels,
+            const std::size_t level);
+
+    private:
+        const Levels* levels_;
+        // Counted from the best level
+        std::size_t level_;
+        std::size_t offer_;
+    };
+
+    // Price of the best level, or 0 if the book is empty
+    OPENTXS_EXPORT std::int64_t BestPrice() const;
+    // Price of the best level other than market orders (which have a price
+    // of 0), or 0 if there is none
+    OPENTXS_EXPORT std::int64_t BestLimitPrice() const;
+    const Levels& GetLevels() const { return levels_; }
+
+    OPENTXS_EXPORT const_iterator begin() const;
+    bool empty() const { return 0 == count_; }
+    OPENTXS_EXPORT const_iterator end() const;
+    std::size_t size() const { return count_; }
+
+    OPENTXS_EXPORT void Add(OTOffer& theOffer);
+    // Returns the removed offer, or nullptr if it was not found
+    OPENTXS_EXPORT OTOffer* Remove(
+        const std::int64_t& lPriceLimit,
+        const std::int64_t& lTransactionNum);
+    // Removes and returns any offer, or nullptr if the book is empty
+    OPENTXS_EXPORT OTOffer* Pop();
+
+    OPENTXS_EXPORT explicit OfferBook(const bool bids);
+
+private:
+    // Bids: highest price is best. Asks: lowest price is best.
+    const bool bids_;
+    Levels levels_;
+    std::size_t count_;
+
+    bool better(const std::int64_t& lhs, const std::int64_t& rhs) const;
+    Levels::iterator find(const std::int64_t& lPriceLimit);
+
+    OfferBook() = delete;
+};
+}  // namespace opentxs
+#endif
@@ -61,6 +61,8 @@ OPENTXS_EXPORT const VersionMap& StorageSeedsAllowedStorageItemHash() noexcept;
 OPENTXS_EXPORT const VersionMap&
 StorageServersAllowedStorageItemHash() noexcept;
 OPENTXS_EXPORT const VersionMap& StorageThreadAllowedItem() noexcept;
+OPENTXS_EXPORT const VersionMap& StorageThreadAllowedPage() noexcept;
+OPENTXS_EXPORT const VersionMap& StorageThreadPageAllowedItem() noexcept;
 OPENTXS_EXPORT const VersionMap& StorageUnitsAllowedStorageItemHash() noexcept;
 }  // namespace proto
 }  // namespace opentxs
@@ -26,6 +26,7 @@ extern "C" {
 #include <vector>
 
 #include "2_Factory.hpp"
+#include "core/Armored.hpp"
 #include "internal/api/Api.hpp"
 #include "internal/api/client/Client.hpp"
 #include "internal/api/client/Factory.hpp"
@@ -224,6 +225,7 @@ void Context::Init()
     }
 
     Init_Log(argLevel);
+    Init_Armor();
     Init_Crypto();
     Init_Factory();
     Init_Profile();
@@ -233,6 +235,23 @@ void Context::Init()
     Init_Zap();
 }
 
+void Context::Init_Armor()
+{
+    OT_ASSERT(legacy_)
+
+    const auto& config = Config(legacy_->OpentxsConfigFilePath());
+    bool notUsed{false};
+    std::int64_t level{0};
+    config.CheckSet_long(
+        String::Factory("armor"),
+        String::Factory("compression_level"),
+        OT_ARMOR_COMPRESSION_LEVEL,
+        level,
+        notUsed);
+    opentxs::implementation::Armored::SetCompressionLevel(
+        static_cast<std::int32_t>(level));
+}
+
 void Context::Init_Crypto()
 {
     crypto_ = factory::Crypto(Config(legacy_->OpentxsConfigFilePath()));
@@ -144,6 +144,7 @@ private:
     void start_client(const Lock& lock, const ArgList& args) const;
     void start_server(const Lock& lock, const ArgList& args) const;
 
+    void Init_Armor();
     void Init_Crypto();
     void Init_Factory();
     void Init_Log(const std::int32_t argLevel);
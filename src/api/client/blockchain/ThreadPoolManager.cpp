@@ -12,6 +12,8 @@
 #include <set>
 #include <thread>
 
+#include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/network/zeromq/socket/Socket.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Endpoints.hpp"
@@ -89,6 +91,10 @@ auto Blockchain::ThreadPoolManager::callback(zmq::Message& in) noexcept -> void
             opentxs::blockchain::client::internal::FilterOracle::
                 ProcessThreadPool(in);
         } break;
+        case Work::BlockParser: {
+            opentxs::blockchain::block::bitcoin::internal::ProcessThreadPool(
+                in);
+        } break;
         default: {
             OT_FAIL;
         }
@@ -182,8 +188,12 @@ auto Blockchain::ThreadPoolManager::startup() const noexcept -> void
     OT_ASSERT(zmq);
 
     for (unsigned int i{0}; i < target; ++i) {
-        auto& worker = workers_.emplace_back(api_.ZeroMQ().PullSocket(
-            cbi_, zmq::socket::Socket::Direction::Connect));
+        // Jobs run for a long time so each worker gets its own thread
+        auto& worker = workers_.emplace_back(factory::PullSocket(
+            api_.ZeroMQ(),
+            static_cast<bool>(zmq::socket::Socket::Direction::Connect),
+            cbi_,
+            false));
         auto zmq = worker->Start(endpoint);
 
         OT_ASSERT(zmq);
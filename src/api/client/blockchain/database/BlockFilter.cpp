@@ -7,24 +7,25 @@
 #include "1_Internal.hpp"  // IWYU pragma: associated
 #include "api/client/blockchain/database/BlockFilter.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <cstring>
 #include <stdexcept>
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "internal/api/Api.hpp"  // IWYU pragma: keep
 #include "internal/blockchain/Blockchain.hpp"
-#include "opentxs/Proto.tpp"
 #include "opentxs/blockchain/client/FilterOracle.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
 #include "opentxs/protobuf/BlockchainFilterHeader.pb.h"
-#include "opentxs/protobuf/GCS.pb.h"
 #include "util/LMDB.hpp"
 
-// #define OT_METHOD
-// "opentxs::api::client::blockchain::database::implementation::BlockFilter::"
+#define OT_METHOD                                                              \
+    "opentxs::api::client::blockchain::database::implementation::BlockFilter::"
 
 namespace opentxs::api::client::blockchain::database::implementation
 {
@@ -66,7 +67,7 @@ auto BlockFilter::LoadFilter(const FilterType type, const ReadView blockHash)
     auto cb = [this, &output](const auto in) {
         if ((nullptr == in.data()) || (0 == in.size())) { return; }
 
-        output = factory::GCS(api_, proto::Factory<proto::GCS>(in));
+        output = factory::GCS(api_, in);
     };
 
     try {
@@ -133,6 +134,49 @@ auto BlockFilter::LoadFilterHeader(
     return output;
 }
 
+auto BlockFilter::ReadFilters(
+    const FilterType type,
+    const std::vector<opentxs::blockchain::block::pHash>& blocks,
+    const FilterReader cb) const noexcept -> bool
+{
+    OT_ASSERT(cb);
+
+    auto keys = std::vector<ReadView>{};
+    auto found = std::vector<bool>(blocks.size(), false);
+    auto more{true};
+    keys.reserve(blocks.size());
+
+    for (const auto& block : blocks) { keys.emplace_back(block->Bytes()); }
+
+    try {
+        lmdb_.LoadMany(
+            translate_filter(type),
+            keys,
+            [&](const auto index, const auto in) -> bool {
+                if ((nullptr == in.data()) || (0 == in.size())) { return true; }
+
+                const auto filter = factory::GCS(api_, in, true);
+
+                if (filter) {
+                    found.at(index) = true;
+                    more = cb(index, filter.get());
+                }
+
+                return more;
+            });
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+
+    for (auto i = std::size_t{0}; more && (i < found.size()); ++i) {
+        if (false == found.at(i)) { more = cb(i, nullptr); }
+    }
+
+    return true;
+}
+
 auto BlockFilter::StoreFilterHeaders(
     const FilterType type,
     const std::vector<FilterHeader>& headers) const noexcept -> bool
@@ -152,8 +196,6 @@ auto BlockFilter::StoreFilters(
     const std::vector<FilterHeader>& headers,
     const std::vector<FilterData>& filters) const noexcept -> bool
 {
-    auto parentTxn = lmdb_.TransactionRW();
-
     for (const auto& [block, header, hash] : headers) {
         auto proto = proto::BlockchainFilterHeader();
         proto.set_version(1);
@@ -164,13 +206,10 @@ auto BlockFilter::StoreFilters(
             reinterpret_cast<std::uint8_t*>(bytes.data()));
 
         try {
-            const auto stored = lmdb_.Store(
-                translate_header(type),
-                block->Bytes(),
-                reader(bytes),
-                parentTxn);
+            const auto queued = lmdb_.Queue(
+                translate_header(type), block->Bytes(), reader(bytes));
 
-            if (false == stored.first) { return false; }
+            if (false == queued) { return false; }
         } catch (...) {
 
             return false;
@@ -181,23 +220,24 @@ auto BlockFilter::StoreFilters(
         OT_ASSERT(pFilter);
 
         const auto& filter = *pFilter;
-        const auto proto = filter.Serialize();
-        auto bytes = space(proto.ByteSize());
-        proto.SerializeWithCachedSizesToArray(
-            reinterpret_cast<std::uint8_t*>(bytes.data()));
+        auto bytes = Space{};
+
+        if (false == filter.Serialize(writer(bytes))) { return false; }
 
         try {
-            const auto stored = lmdb_.Store(
-                translate_filter(type), block, reader(bytes), parentTxn);
+            const auto queued =
+                lmdb_.Queue(translate_filter(type), block, reader(bytes));
 
-            if (false == stored.first) { return false; }
+            if (false == queued) { return false; }
         } catch (...) {
 
             return false;
         }
     }
 
-    return parentTxn.Finalize(true);
+    // Callers advance the filter tips immediately afterwards so these records
+    // must be durable first
+    return lmdb_.Commit();
 }
 
 auto BlockFilter::translate_filter(const FilterType type) noexcept(false)
@@ -50,6 +50,10 @@ public:
         const noexcept -> bool;
     auto LoadFilter(const FilterType type, const ReadView blockHash) const
         noexcept -> std::unique_ptr<const opentxs::blockchain::client::GCS>;
+    auto ReadFilters(
+        const FilterType type,
+        const std::vector<opentxs::blockchain::block::pHash>& blocks,
+        const FilterReader cb) const noexcept -> bool;
     auto LoadFilterHash(
         const FilterType type,
         const ReadView blockHash,
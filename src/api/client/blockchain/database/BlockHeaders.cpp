@@ -81,27 +81,24 @@ auto BlockHeader::StoreBlockHeader(
 auto BlockHeader::StoreBlockHeaders(const UpdatedHeader& headers) const noexcept
     -> bool
 {
-    auto parentTxn = lmdb_.TransactionRW();
-
     for (const auto& [hash, pair] : headers) {
         const auto& [header, newBlock] = pair;
 
         if (newBlock) {
             auto serialized = header->Serialize();
             serialized.clear_local();
-            const auto stored = lmdb_.Store(
+            const auto queued = lmdb_.Queue(
                 Table::BlockHeaders,
                 api_.Crypto().Encode().IdentifierEncode(header->Hash()),
                 proto::ToString(serialized),
-                parentTxn,
                 MDB_NOOVERWRITE);
 
-            if (false == stored.first) {
-                if (MDB_KEYEXIST != stored.second) { return false; }
-            }
+            if (false == queued) { return false; }
         }
     }
 
-    return parentTxn.Finalize(true);
+    // Callers update the best chain immediately afterwards so these headers
+    // must be durable first
+    return lmdb_.Commit();
 }
 }  // namespace opentxs::api::client::blockchain::database::implementation
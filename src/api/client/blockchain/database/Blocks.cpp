@@ -10,11 +10,18 @@
 
 #include <boost/filesystem.hpp>
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 #include <utility>
+#if defined __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif  // __linux__
 
 #include "api/client/blockchain/database/Database.hpp"
 #include "internal/api/client/blockchain/Blockchain.hpp"
@@ -46,6 +53,15 @@ constexpr auto target_file_size_ =
 #else
     std::size_t{8u * TiB_};
 #endif  // OT_VALGRIND
+// Pruning and compaction are evaluated once per this many stored blocks
+constexpr auto maintenance_interval_ = std::size_t{1024u};
+// Delay before maintenance which could not start is attempted again
+constexpr auto maintenance_retry_ = std::chrono::seconds{1};
+// Never prune below this many blocks regardless of configuration
+constexpr auto minimum_keep_ = std::size_t{288u};
+constexpr auto compact_minimum_ = std::size_t{64u * MiB_};
+// Limits how long a single compaction pass blocks readers
+constexpr auto compact_batch_ = std::size_t{256u * MiB_};
 
 constexpr auto get_file_count(const std::size_t bytes) noexcept -> std::size_t
 {
@@ -73,13 +89,24 @@ const std::size_t Blocks::address_key_{
 
 Blocks::Blocks(
     opentxs::storage::lmdb::LMDB& lmdb,
-    const std::string& path) noexcept(false)
+    const std::string& path,
+    const std::size_t keep) noexcept(false)
     : lmdb_(lmdb)
     , path_prefix_(path)
+    , keep_((0u == keep) ? 0u : std::max(keep, minimum_keep_))
     , next_position_(load_position(lmdb_))
-    , files_(init_files(path_prefix_, next_position_))
-    , lock_()
+    , dead_bytes_(0)
+    , stored_since_maintenance_(0)
+    , files_(std::make_shared<const Files>(
+          init_files(path_prefix_, next_position_)))
+    , file_lock_()
+    , maintenance_lock_()
+    , position_lock_()
     , block_locks_()
+    , maintenance_signal_lock_()
+    , maintenance_signal_()
+    , shutdown_(false)
+    , maintenance_thread_()
 {
     static_assert(sizeof(std::uint64_t) == sizeof(std::size_t));
     static_assert(1 == get_file_count(0));
@@ -97,16 +124,31 @@ Blocks::Blocks(
     static_assert(0 == get_start_position(0));
     static_assert(target_file_size_ == get_start_position(1));
 
-    {
-        Lock lock(lock_);
-        const auto offset = get_offset(next_position_);
+    const auto next = next_position_.load();
+    const auto offset = get_offset(next);
+
+    OT_ASSERT(files_->size() == (offset.first + 1));
+    OT_ASSERT(check_file(offset.first)->size() == (offset.first + 1));
+
+    auto live = std::size_t{0};
 
-        OT_ASSERT(files_.size() == (offset.first + 1));
+    for (const auto& [data, hash] : index()) { live += data.size_; }
 
-        check_file(lock, offset.first);
+    dead_bytes_ = (next > live) ? next - live : 0u;
+    maintenance_thread_ = std::thread{&Blocks::run_maintenance, this};
+}
+
+auto Blocks::block_lock(const Hash& block) const noexcept -> BlockLock
+{
+    auto& shard = block_locks_.at(this->shard(block));
+    Lock lock(shard.lock_);
+    auto& output = shard.locks_[block];
 
-        OT_ASSERT(files_.size() == (offset.first + 1));
+    if (false == bool(output)) {
+        output = std::make_shared<std::shared_mutex>();
     }
+
+    return output;
 }
 
 auto Blocks::calculate_file_name(
@@ -124,18 +166,152 @@ auto Blocks::calculate_file_name(
     return path.string();
 }
 
-auto Blocks::check_file(const Lock& lock, const FileCounter position)
-    const noexcept -> void
+auto Blocks::check_file(const FileCounter file) const noexcept -> pFiles
 {
-    while (files_.size() < (position + 1)) {
-        create_or_load(path_prefix_, files_.size(), files_);
+    auto output = std::atomic_load(&files_);
+
+    if (file < output->size()) { return output; }
+
+    Lock lock(file_lock_);
+    output = std::atomic_load(&files_);
+
+    if (file < output->size()) { return output; }
+
+    // Copies of a mapped_file share the same mapping so views into the
+    // previous table remain valid
+    auto replacement = std::make_shared<Files>(*output);
+
+    while (replacement->size() < (file + 1)) {
+        create_or_load(path_prefix_, replacement->size(), *replacement);
     }
+
+    output = replacement;
+    std::atomic_store(&files_, output);
+
+    return output;
+}
+
+// Slides blocks toward the start of the store in their existing order to
+// reclaim space left behind by pruned or replaced blocks.
+//
+// Writers are excluded by the maintenance lock and a block is safe to move
+// once its exclusive lock is obtained since readers validate the index entry
+// after locking. A busy block ends the pass, as does reaching compact_batch_.
+// Blocks which would overlap their own old copy stay in place.
+auto Blocks::compact(const eLock& lock) const noexcept -> void
+{
+    const auto next = next_position_.load();
+
+    if (dead_bytes_.load() < std::max(compact_minimum_, next / 4u)) { return; }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Compacting block storage with ")(
+        dead_bytes_.load())(" of ")(next)(" bytes unused")
+        .Flush();
+    const auto entries = index();
+    const auto files = check_file(get_offset(next).first);
+    auto target = MemoryPosition{0};
+    auto live = std::size_t{0};
+    auto copied = std::size_t{0};
+    auto finished{true};
+    // The old copy of a block must survive until the index entry which points
+    // to its new location has been committed
+    auto protect = std::numeric_limits<MemoryPosition>::max();
+    auto commit = [&]() -> bool {
+        if (false == lmdb_.Commit()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to commit index")
+                .Flush();
+
+            return false;
+        }
+
+        protect = std::numeric_limits<MemoryPosition>::max();
+
+        return true;
+    };
+
+    for (const auto& [data, hash] : entries) {
+        live += data.size_;
+        auto position = target;
+
+        {
+            const auto start = get_offset(position).first;
+            const auto end = get_offset(position + (data.size_ - 1u)).first;
+
+            if (end != start) { position = get_start_position(end); }
+        }
+
+        if ((position + data.size_) > data.position_) {
+            target = std::max(target, data.position_ + data.size_);
+
+            continue;
+        }
+
+        if (compact_batch_ < copied) {
+            finished = false;
+
+            break;
+        }
+
+        const auto mutex = block_lock(hash);
+        auto blockLock = eLock{*mutex, std::try_to_lock};
+
+        if (false == blockLock.owns_lock()) {
+            finished = false;
+
+            break;
+        }
+
+        if (((position + data.size_) > protect) && (false == commit())) {
+            return;
+        }
+
+        const auto [fromFile, fromOffset] = get_offset(data.position_);
+        const auto [toFile, toOffset] = get_offset(position);
+        std::memcpy(
+            files->at(toFile).data() + toOffset,
+            files->at(fromFile).const_data() + fromOffset,
+            data.size_);
+        const auto moved = IndexData{position, data.size_};
+
+        if (false ==
+            lmdb_.Queue(Table::BlockIndex, hash->Bytes(), tsv(moved))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to update index for block ")(hash->asHex())
+                .Flush();
+
+            return;
+        }
+
+        protect = std::min(protect, data.position_);
+        copied += data.size_;
+        target = position + data.size_;
+    }
+
+    if (false == finished) {
+        commit();
+
+        return;
+    }
+
+    next_position_.store(target);
+
+    if ((false == update_position()) || (false == commit())) {
+        next_position_.store(next);
+
+        return;
+    }
+
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Reclaimed ")(next - target)(
+        " bytes")
+        .Flush();
+    release(lock, target, next);
+    dead_bytes_.store((target > live) ? target - live : 0u);
 }
 
 auto Blocks::create_or_load(
     const std::string& prefix,
     const FileCounter file,
-    std::vector<boost::iostreams::mapped_file>& output) noexcept -> void
+    Files& output) noexcept -> void
 {
     auto params =
         boost::iostreams::mapped_file_params{calculate_file_name(prefix, file)};
@@ -181,12 +357,39 @@ auto Blocks::Exists(const Hash& block) const noexcept -> bool
     return lmdb_.Exists(Table::BlockIndex, block.Bytes());
 }
 
+auto Blocks::index() const noexcept -> std::vector<Entry>
+{
+    auto output = std::vector<Entry>{};
+    lmdb_.Read(
+        Table::BlockIndex,
+        [&](const auto key, const auto value) -> bool {
+            auto data = IndexData{};
+
+            if (sizeof(data) != value.size()) { return true; }
+
+            std::memcpy(static_cast<void*>(&data), value.data(), value.size());
+
+            if (0 < data.size_) {
+                output.emplace_back(
+                    data, Data::Factory(key.data(), key.size()));
+            }
+
+            return true;
+        },
+        opentxs::storage::lmdb::LMDB::Dir::Forward);
+    std::sort(
+        output.begin(), output.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first.position_ < rhs.first.position_;
+        });
+
+    return output;
+}
+
 auto Blocks::init_files(
     const std::string& prefix,
-    const MemoryPosition position) noexcept
-    -> std::vector<boost::iostreams::mapped_file>
+    const MemoryPosition position) noexcept -> Files
 {
-    auto output = std::vector<boost::iostreams::mapped_file>{};
+    auto output = Files{};
     const auto target = get_file_count(position);
     output.reserve(target);
 
@@ -199,29 +402,47 @@ auto Blocks::init_files(
 
 auto Blocks::Load(const Hash& block) const noexcept -> BlockReader
 {
-    Lock lock(lock_);
-    auto index = IndexData{};
-    auto cb = [&index](const auto in) {
-        if (sizeof(index) != in.size()) { return; }
+    auto index = load_index(block);
+    auto mutex = BlockLock{};
 
-        std::memcpy(static_cast<void*>(&index), in.data(), in.size());
-    };
-    lmdb_.Load(Table::BlockIndex, block.Bytes(), cb);
+    while (true) {
+        if (0 == index.size_) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Block ")(block.asHex())(
+                " not found in index")
+                .Flush();
 
-    if (0 == index.size_) {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": Block ")(block.asHex())(
-            " not found in index")
-            .Flush();
+            return {};
+        }
 
-        return {};
+        if (false == bool(mutex)) { mutex = block_lock(block); }
+
+        const auto [file, offset] = get_offset(index.position_);
+        const auto files = check_file(file);
+        auto output = BlockReader{
+            ReadView{files->at(file).const_data() + offset, index.size_},
+            *mutex,
+            [mutex] {}};
+        // The block can not move while it is locked but it may have been moved
+        // or removed between the index lookup and acquiring the lock
+        const auto current = load_index(block);
+
+        if (current == index) { return output; }
+
+        index = current;
     }
+}
+
+auto Blocks::load_index(const Hash& block) const noexcept -> IndexData
+{
+    auto output = IndexData{};
+    auto cb = [&output](const auto in) {
+        if (sizeof(output) != in.size()) { return; }
 
-    const auto [file, offset] = get_offset(index.position_);
-    check_file(lock, file);
+        std::memcpy(static_cast<void*>(&output), in.data(), in.size());
+    };
+    lmdb_.Load(Table::BlockIndex, block.Bytes(), cb);
 
-    return BlockReader{
-        ReadView{files_.at(file).const_data() + offset, index.size_},
-        block_locks_[block]};
+    return output;
 }
 
 auto Blocks::load_position([
@@ -246,92 +467,303 @@ auto Blocks::load_position([
     return output;
 }
 
-auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
-    -> BlockWriter
+auto Blocks::maintain() const noexcept -> bool
 {
-    if (0 == bytes) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Block ")(block.asHex())(
-            " invalid block size")
-            .Flush();
+    // A writer which holds the maintenance lock may be waiting for a block
+    // held by a caller which is itself about to store another block. Waiting
+    // for the lock here could stall that caller behind this thread, so give
+    // up and try again later.
+    auto lock = eLock{maintenance_lock_, std::try_to_lock};
 
-        return {};
+    if (false == lock.owns_lock()) { return false; }
+
+    stored_since_maintenance_.store(0);
+    prune(lock);
+    compact(lock);
+
+    return true;
+}
+
+auto Blocks::Pin(const Hash& block) const noexcept -> bool
+{
+    static const auto pinned = std::uint8_t{1};
+
+    return lmdb_.Queue(Table::BlockPins, block.Bytes(), tsv(pinned));
+}
+
+// Removes all but the keep_ most recently stored blocks from the index. Their
+// space is reclaimed by the next compaction.
+auto Blocks::prune(const eLock& lock) const noexcept -> void
+{
+    if (0u == keep_) { return; }
+
+    const auto entries = index();
+
+    if (entries.size() <= keep_) { return; }
+
+    const auto stop = entries.size() - keep_;
+    auto count = std::size_t{0};
+
+    for (auto i = std::size_t{0}; i < stop; ++i) {
+        const auto& [data, hash] = entries.at(i);
+
+        if (lmdb_.Exists(Table::BlockPins, hash->Bytes())) { continue; }
+
+        if (false == remove(lock, hash)) { continue; }
+
+        dead_bytes_ += data.size_;
+        ++count;
     }
 
-    Lock lock(lock_);
-    auto index = IndexData{};
-    auto cb = [&index](const auto in) {
-        if (sizeof(index) != in.size()) { return; }
+    LogVerbose(OT_METHOD)(__FUNCTION__)(": Pruned ")(count)(" blocks").Flush();
+}
 
-        std::memcpy(static_cast<void*>(&index), in.data(), in.size());
-    };
-    lmdb_.Load(Table::BlockIndex, block.Bytes(), cb);
-    const auto replace = bytes == index.size_;
+// Returns the storage for a range of the files to the filesystem
+auto Blocks::release(
+    const eLock&,
+    const MemoryPosition start,
+    const MemoryPosition end) const noexcept -> void
+{
+#if defined __linux__
+    static const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto files = std::atomic_load(&files_);
+    auto position = start;
+
+    while (position < end) {
+        const auto file = get_offset(position).first;
+        const auto base = get_start_position(file);
+        const auto stop = std::min(end, get_start_position(file + 1u));
+        const auto first = ((position - base + page - 1u) / page) * page;
+        const auto last = ((stop - base) / page) * page;
+        position = stop;
+
+        if ((first >= last) || (file >= files->size())) { continue; }
+
+        if (0 != ::madvise(
+                     files->at(file).data() + first,
+                     last - first,
+                     MADV_REMOVE)) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(
+                ": Unable to release unused space in file ")(file)
+                .Flush();
+        }
+    }
+#endif  // __linux__
+}
+
+// Returns space which was reserved for a block which will not be stored. The
+// write position only moves back if no other space was reserved since.
+auto Blocks::release_reservation(const IndexData& index) const noexcept -> void
+{
+    auto end = index.position_ + index.size_;
+
+    if (false == next_position_.compare_exchange_strong(end, index.position_)) {
+        dead_bytes_ += index.size_;
+    }
+}
+
+// Only succeeds if no reader or writer holds, or is about to acquire, the
+// lock for the block
+auto Blocks::remove(const eLock&, const Hash& block) const noexcept -> bool
+{
+    auto& shard = block_locks_.at(this->shard(block));
+    Lock lock(shard.lock_);
+    auto it = shard.locks_.find(block);
 
-    if (replace) {
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": Replacing existing block ")(
-            block.asHex())
+    if ((shard.locks_.end() != it) && (1 < it->second.use_count())) {
+        return false;
+    }
+
+    if (false == lmdb_.QueueDelete(Table::BlockIndex, block.Bytes())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to remove block ")(
+            block.asHex())(" from index")
             .Flush();
-    } else {
-        index.size_ = bytes;
-        index.position_ = next_position_;
+
+        return false;
+    }
+
+    if (shard.locks_.end() != it) { shard.locks_.erase(it); }
+
+    return true;
+}
+
+auto Blocks::run_maintenance() noexcept -> void
+{
+    auto lock = Lock{maintenance_signal_lock_};
+
+    while (false == shutdown_) {
+        maintenance_signal_.wait(lock, [&] {
+            return shutdown_ ||
+                   (maintenance_interval_ <= stored_since_maintenance_.load());
+        });
+
+        if (shutdown_) { return; }
+
+        lock.unlock();
+        const auto done = maintain();
+        lock.lock();
+
+        if (false == done) {
+            maintenance_signal_.wait_for(
+                lock, maintenance_retry_, [&] { return shutdown_; });
+        }
+    }
+}
+
+auto Blocks::reserve(const BlockSize bytes) const noexcept -> MemoryPosition
+{
+    auto current = next_position_.load();
+
+    while (true) {
+        auto position = current;
 
         {
             // NOTE This check prevents writing past end of file
-            const auto start = get_offset(index.position_).first;
-            const auto end =
-                get_offset(index.position_ + (index.size_ - 1)).first;
+            const auto start = get_offset(position).first;
+            const auto end = get_offset(position + (bytes - 1u)).first;
 
             if (end != start) {
                 OT_ASSERT(end > start);
 
-                index.position_ = get_start_position(end);
+                position = get_start_position(end);
             }
         }
 
-        LogVerbose(OT_METHOD)(__FUNCTION__)(": Storing block ")(block.asHex())(
-            " at position ")(index.position_)
-            .Flush();
+        if (next_position_.compare_exchange_weak(current, position + bytes)) {
+            dead_bytes_ += (position - current);
+
+            return position;
+        }
     }
+}
 
-    const auto [file, offset] = get_offset(index.position_);
-    check_file(lock, file);
-    auto output = BlockWriter{
-        WritableView{files_.at(file).data() + offset, bytes},
-        block_locks_[block]};
+auto Blocks::schedule_maintenance() const noexcept -> void
+{
+    if (maintenance_interval_ != ++stored_since_maintenance_) { return; }
 
-    if (replace) { return output; }
+    // Acquiring the mutex ensures the maintenance thread is either waiting or
+    // has not yet checked the counter, so the notification is not lost
+    {
+        Lock lock(maintenance_signal_lock_);
+    }
+
+    maintenance_signal_.notify_one();
+}
 
-    const auto nextPosition = index.position_ + bytes;
-    auto tx = lmdb_.TransactionRW();
-    auto result = lmdb_.Store(Table::BlockIndex, block.Bytes(), tsv(index), tx);
+auto Blocks::shard(const Hash& block) noexcept -> std::size_t
+{
+    auto output = std::size_t{0};
+    std::memcpy(
+        &output, block.data(), std::min(sizeof(output), block.size()));
 
-    if (false == result.first) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(
-            ": Failed to update index for block ")(block.asHex())
+    return output % shard_count_;
+}
+
+auto Blocks::Store(const Hash& block, const std::size_t bytes) const noexcept
+    -> BlockWriter
+{
+    if (0 == bytes) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Block ")(block.asHex())(
+            " invalid block size")
             .Flush();
 
         return {};
     }
 
-    result =
-        lmdb_.Store(Table::Config, tsv(address_key_), tsv(nextPosition), tx);
+    schedule_maintenance();
+    auto maintenance = sLock{maintenance_lock_};
+    const auto mutex = block_lock(block);
+    auto existing = load_index(block);
 
-    if (false == result.first) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to next write position")
-            .Flush();
+    while (true) {
+        const auto replace = bytes == existing.size_;
+        auto index = existing;
 
-        return {};
-    }
+        if (replace) {
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Replacing existing block ")(
+                block.asHex())
+                .Flush();
+        } else {
+            index = IndexData{reserve(bytes), bytes};
+            LogVerbose(OT_METHOD)(__FUNCTION__)(": Storing block ")(
+                block.asHex())(" at position ")(index.position_)
+                .Flush();
+        }
+
+        const auto [file, offset] = get_offset(index.position_);
+        const auto files = check_file(file);
+        auto output = BlockWriter{
+            WritableView{files->at(file).data() + offset, bytes},
+            *mutex,
+            [mutex] {}};
+        // Another writer for the same block may have finished while this one
+        // was waiting for the lock
+        const auto current = load_index(block);
+
+        if (current != existing) {
+            if (false == replace) { dead_bytes_ += bytes; }
+
+            existing = current;
+
+            continue;
+        }
 
-    if (tx.Finalize(true)) {
-        next_position_ = nextPosition;
+        if (replace) { return output; }
+
+        // The write position covering the new block is queued ahead of its
+        // index entry, so the index entry is never committed in an earlier
+        // batch than the position. Losing both in a crash only causes the
+        // block to be downloaded again.
+        if (false == update_position()) {
+            release_reservation(index);
+
+            return {};
+        }
+
+        if (false ==
+            lmdb_.Queue(Table::BlockIndex, block.Bytes(), tsv(index))) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to update index for block ")(block.asHex())
+                .Flush();
+            release_reservation(index);
+
+            return {};
+        }
+
+        dead_bytes_ += existing.size_;
 
         return output;
-    } else {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Database update error").Flush();
+    }
+}
 
-        return {};
+auto Blocks::update_position() const noexcept -> bool
+{
+    // Writers may finish in any order so always store the latest value
+    Lock lock(position_lock_);
+    const auto position = next_position_.load();
+
+    if (false ==
+        lmdb_.Queue(Table::Config, tsv(address_key_), tsv(position))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to update next write position")
+            .Flush();
+
+        return false;
     }
+
+    return true;
+}
+
+Blocks::~Blocks()
+{
+    {
+        Lock lock(maintenance_signal_lock_);
+        shutdown_ = true;
+    }
+
+    maintenance_signal_.notify_all();
+
+    if (maintenance_thread_.joinable()) { maintenance_thread_.join(); }
 }
 }  // namespace opentxs::api::client::blockchain::database::implementation
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
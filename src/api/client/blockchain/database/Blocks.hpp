@@ -8,11 +8,18 @@
 #if OPENTXS_BLOCK_STORAGE_ENABLED
 
 #include <boost/iostreams/device/mapped_file.hpp>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
 #include <iosfwd>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "internal/blockchain/client/Client.hpp"
@@ -35,6 +42,12 @@ class LMDB;
 
 namespace opentxs::api::client::blockchain::database::implementation
 {
+// Loads never wait on the store as a whole. The table of mapped files is
+// replaced rather than modified when it grows, index lookups go straight to
+// LMDB, and each block is protected by its own lock.
+//
+// Pruning and compaction run on a dedicated thread so they never delay the
+// Store call which triggers them.
 class Blocks
 {
 public:
@@ -43,31 +56,71 @@ public:
 
     auto Exists(const Hash& block) const noexcept -> bool;
     auto Load(const Hash& block) const noexcept -> BlockReader;
+    // Exempts a block from pruning
+    auto Pin(const Hash& block) const noexcept -> bool;
     auto Store(const Hash& block, const std::size_t bytes) const noexcept
         -> BlockWriter;
 
     Blocks(
         opentxs::storage::lmdb::LMDB& lmdb,
-        const std::string& path) noexcept(false);
+        const std::string& path,
+        const std::size_t keep) noexcept(false);
+
+    ~Blocks();
 
 private:
     using FileCounter = std::size_t;
     using MemoryPosition = std::size_t;
     using BlockSize = std::size_t;
+    using Files = std::vector<boost::iostreams::mapped_file>;
+    using pFiles = std::shared_ptr<const Files>;
+    using BlockLock = std::shared_ptr<std::shared_mutex>;
 
     struct IndexData {
         MemoryPosition position_;
         BlockSize size_;
+
+        auto operator==(const IndexData& rhs) const noexcept -> bool
+        {
+            return (position_ == rhs.position_) && (size_ == rhs.size_);
+        }
+        auto operator!=(const IndexData& rhs) const noexcept -> bool
+        {
+            return false == operator==(rhs);
+        }
+    };
+
+    struct Shard {
+        std::mutex lock_{};
+        std::map<pHash, BlockLock> locks_{};
     };
 
+    using Entry = std::pair<IndexData, pHash>;
+
+    static constexpr auto shard_count_ = std::size_t{64};
+
     static const std::size_t address_key_;
 
     opentxs::storage::lmdb::LMDB& lmdb_;
     const std::string path_prefix_;
-    mutable MemoryPosition next_position_;
-    mutable std::vector<boost::iostreams::mapped_file> files_;
-    mutable std::mutex lock_;
-    mutable std::map<pHash, std::shared_mutex> block_locks_;
+    // Number of most recently stored blocks to retain. Zero disables pruning.
+    const std::size_t keep_;
+    mutable std::atomic<MemoryPosition> next_position_;
+    // Bytes below next_position_ which no longer belong to any block
+    mutable std::atomic<std::size_t> dead_bytes_;
+    mutable std::atomic<std::size_t> stored_since_maintenance_;
+    mutable pFiles files_;
+    // Serializes growth of files_
+    mutable std::mutex file_lock_;
+    // Shared by writers, exclusive during pruning and compaction
+    mutable std::shared_mutex maintenance_lock_;
+    // Keeps the stored write position from moving backwards
+    mutable std::mutex position_lock_;
+    mutable std::array<Shard, shard_count_> block_locks_;
+    mutable std::mutex maintenance_signal_lock_;
+    mutable std::condition_variable maintenance_signal_;
+    bool shutdown_;
+    std::thread maintenance_thread_;
 
     static auto calculate_file_name(
         const std::string& prefix,
@@ -75,16 +128,39 @@ private:
     static auto create_or_load(
         const std::string& prefix,
         const FileCounter file,
-        std::vector<boost::iostreams::mapped_file>& output) noexcept -> void;
+        Files& output) noexcept -> void;
     static auto init_files(
         const std::string& prefix,
-        const MemoryPosition position) noexcept
-        -> std::vector<boost::iostreams::mapped_file>;
+        const MemoryPosition position) noexcept -> Files;
     static auto load_position(opentxs::storage::lmdb::LMDB& db) noexcept
         -> MemoryPosition;
+    static auto shard(const Hash& block) noexcept -> std::size_t;
+
+    auto block_lock(const Hash& block) const noexcept -> BlockLock;
+    // Returns a file table which contains at least the specified file
+    auto check_file(const FileCounter file) const noexcept -> pFiles;
+    auto compact(const eLock& lock) const noexcept -> void;
+    auto index() const noexcept -> std::vector<Entry>;
+    auto load_index(const Hash& block) const noexcept -> IndexData;
+    auto maintain() const noexcept -> bool;
+    auto prune(const eLock& lock) const noexcept -> void;
+    auto release(
+        const eLock& lock,
+        const MemoryPosition start,
+        const MemoryPosition end) const noexcept -> void;
+    auto release_reservation(const IndexData& index) const noexcept -> void;
+    auto remove(const eLock& lock, const Hash& block) const noexcept -> bool;
+    auto reserve(const BlockSize bytes) const noexcept -> MemoryPosition;
+    auto schedule_maintenance() const noexcept -> void;
+    auto update_position() const noexcept -> bool;
+
+    auto run_maintenance() noexcept -> void;
 
-    auto check_file(const Lock& lock, const FileCounter position) const noexcept
-        -> void;
+    Blocks() = delete;
+    Blocks(const Blocks&) = delete;
+    Blocks(Blocks&&) = delete;
+    auto operator=(const Blocks&) -> Blocks& = delete;
+    auto operator=(Blocks&&) -> Blocks& = delete;
 };
 }  // namespace opentxs::api::client::blockchain::database::implementation
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
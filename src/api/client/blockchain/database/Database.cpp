@@ -55,6 +55,7 @@ const opentxs::storage::lmdb::TableNames Database::table_names_{
     {Config, "config"},
     {BlockIndex, "blocks"},
     {Enabled, "enabled_chains"},
+    {BlockPins, "block_pins"},
 };
 
 Database::Database(
@@ -91,14 +92,19 @@ Database::Database(
               {Config, MDB_INTEGERKEY},
               {BlockIndex, 0},
               {Enabled, MDB_INTEGERKEY},
+              {BlockPins, 0},
           })
     , block_policy_(block_storage_level(args, lmdb_))
+    , block_cache_(block_cache_limit(args))
     , siphash_key_(siphash_key(lmdb_))
     , headers_(std::make_unique<BlockHeader>(api_, lmdb_))
     , peers_(std::make_unique<Peers>(api_, lmdb_))
     , filters_(std::make_unique<BlockFilter>(api_, lmdb_))
 #if OPENTXS_BLOCK_STORAGE_ENABLED
-    , blocks_(std::make_unique<Blocks>(lmdb_, blocks_path_->Get()))
+    , blocks_(std::make_unique<Blocks>(
+          lmdb_,
+          blocks_path_->Get(),
+          block_prune_depth(args)))
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     , wallet_(std::make_unique<Wallet>(blockchain, lmdb_))
 {
@@ -139,6 +145,36 @@ auto Database::BlockHeaderExists(const BlockHash& hash) const noexcept -> bool
     return headers_->BlockHeaderExists(hash);
 }
 
+auto Database::block_cache_limit(const ArgList& args) noexcept -> std::size_t
+{
+    // Megabytes
+    static constexpr auto default_limit = std::size_t{256};
+    static constexpr auto scale = std::size_t{1024u * 1024u};
+
+    try {
+        const auto& arg = args.at(OPENTXS_ARG_BLOCK_CACHE);
+
+        if (0 == arg.size()) { return default_limit * scale; }
+
+        return std::stoull(*arg.cbegin()) * scale;
+    } catch (...) {
+        return default_limit * scale;
+    }
+}
+
+auto Database::block_prune_depth(const ArgList& args) noexcept -> std::size_t
+{
+    try {
+        const auto& arg = args.at(OPENTXS_ARG_BLOCK_PRUNE);
+
+        if (0 == arg.size()) { return 0; }
+
+        return std::stoull(*arg.cbegin());
+    } catch (...) {
+        return 0;
+    }
+}
+
 auto Database::block_storage_enabled() noexcept -> bool
 {
     return 1 == OPENTXS_BLOCK_STORAGE_ENABLED;
@@ -243,6 +279,15 @@ auto Database::BlockLoad(const BlockHash& block) const noexcept -> BlockReader
 #endif
 }
 
+auto Database::BlockPin(const BlockHash& block) const noexcept -> bool
+{
+#if OPENTXS_BLOCK_STORAGE_ENABLED
+    return blocks_->Pin(block);
+#else
+    return false;
+#endif
+}
+
 auto Database::BlockStore(const BlockHash& block, const std::size_t bytes)
     const noexcept -> BlockWriter
 {
@@ -333,6 +378,14 @@ auto Database::LoadFilter(const FilterType type, const ReadView blockHash)
     return filters_->LoadFilter(type, blockHash);
 }
 
+auto Database::ReadFilters(
+    const FilterType type,
+    const std::vector<opentxs::blockchain::block::pHash>& blocks,
+    const FilterReader cb) const noexcept -> bool
+{
+    return filters_->ReadFilters(type, blocks, cb);
+}
+
 auto Database::LoadFilterHash(
     const FilterType type,
     const ReadView blockHash,
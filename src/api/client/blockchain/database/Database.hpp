@@ -109,9 +109,11 @@ public:
     auto AssociateTransaction(
         const Txid& txid,
         const std::vector<PatternID>& patterns) const noexcept -> bool;
+    auto BlockCacheLimit() const noexcept { return block_cache_; }
     auto BlockHeaderExists(const BlockHash& hash) const noexcept -> bool;
     auto BlockExists(const BlockHash& block) const noexcept -> bool;
     auto BlockLoad(const BlockHash& block) const noexcept -> BlockReader;
+    auto BlockPin(const BlockHash& block) const noexcept -> bool;
     auto BlockPolicy() const noexcept -> BlockStorage { return block_policy_; }
     auto BlockStore(const BlockHash& block, const std::size_t bytes)
         const noexcept -> BlockWriter;
@@ -133,6 +135,10 @@ public:
     auto LoadEnabledChains() const noexcept -> std::vector<Chain>;
     auto LoadFilter(const FilterType type, const ReadView blockHash) const
         noexcept -> std::unique_ptr<const opentxs::blockchain::client::GCS>;
+    auto ReadFilters(
+        const FilterType type,
+        const std::vector<opentxs::blockchain::block::pHash>& blocks,
+        const FilterReader cb) const noexcept -> bool;
     auto LoadFilterHash(
         const FilterType type,
         const ReadView blockHash,
@@ -189,6 +195,7 @@ private:
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     opentxs::storage::lmdb::LMDB lmdb_;
     const BlockStorage block_policy_;
+    const std::size_t block_cache_;
     const SiphashKey siphash_key_;
     const std::unique_ptr<BlockHeader> headers_;
     const std::unique_ptr<Peers> peers_;
@@ -198,6 +205,8 @@ private:
 #endif  // OPENTXS_BLOCK_STORAGE_ENABLED
     const std::unique_ptr<Wallet> wallet_;
 
+    static auto block_cache_limit(const ArgList& args) noexcept -> std::size_t;
+    static auto block_prune_depth(const ArgList& args) noexcept -> std::size_t;
     static auto block_storage_enabled() noexcept -> bool;
     static auto block_storage_level(
         const ArgList& args,
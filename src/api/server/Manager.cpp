@@ -9,6 +9,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <exception>
 #include <list>
@@ -571,8 +572,15 @@ void Manager::Start()
 
     auto pubkey = Data::Factory();
     auto privateKey = server_.TransportKey(pubkey);
+    auto threads = std::size_t{0};
+
+    try {
+        threads = std::stoul(get_arg(OPENTXS_ARG_NOTARY_THREADS));
+    } catch (...) {
+    }
+
     message_processor_.init(
-        (proto::ADDRESSTYPE_INPROC == type), port, privateKey);
+        (proto::ADDRESSTYPE_INPROC == type), port, privateKey, threads);
     message_processor_.Start();
 #if OT_CASH
     ScanMints();
@@ -12,6 +12,7 @@
 #include <ctime>
 #include <functional>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <thread>
@@ -46,6 +47,7 @@
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
 #include "opentxs/protobuf/UnitDefinition.pb.h"
+#include "storage/FlushTimer.hpp"
 #include "storage/StorageConfig.hpp"
 #include "storage/tree/Accounts.hpp"
 #include "storage/tree/Bip47Channels.hpp"
@@ -184,6 +186,12 @@ auto Factory::Storage(
         defaultGcInterval,
         configGcInterval,
         notUsed);
+    config.CheckSet_long(
+        String::Factory(STORAGE_CONFIG_KEY),
+        String::Factory("write_back_interval"),
+        storageConfig.write_back_interval_,
+        storageConfig.write_back_interval_,
+        notUsed);
     config.CheckSet_str(
         String::Factory(STORAGE_CONFIG_KEY),
         String::Factory("path"),
@@ -361,10 +369,13 @@ Storage::Storage(
     : crypto_(crypto)
     , running_(running)
     , gc_interval_(config.gc_interval_)
+    , write_back_interval_(config.write_back_interval_)
     , write_lock_()
     , root_(nullptr)
+    , root_dirty_(false)
     , primary_bucket_(Flag::Factory(false))
     , background_threads_()
+    , flush_timer_()
     , config_(config)
     , multiplex_p_(opentxs::Factory::StorageMultiplex(
           *this,
@@ -719,11 +730,16 @@ auto Storage::CheckTokenSpent(
 
 void Storage::Cleanup_Storage()
 {
+    if (flush_timer_) { flush_timer_->Stop(); }
+
     for (auto& thread : background_threads_) {
         if (thread.joinable()) { thread.join(); }
     }
 
-    if (root_) { root_->cleanup(); }
+    if (root_) {
+        Flush();
+        root_->cleanup();
+    }
 }
 
 void Storage::Cleanup() { Cleanup_Storage(); }
@@ -833,6 +849,42 @@ auto Storage::DeletePaymentWorkflow(
         .Delete(workflowID);
 }
 
+auto Storage::Flush() const -> bool
+{
+    Lock lock(write_lock_);
+
+    return flush(lock);
+}
+
+auto Storage::flush(const Lock& lock) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    if (false == root_dirty_) { return true; }
+
+    OT_ASSERT(root_);
+
+    if (false == root_->flush()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to flush storage tree")
+            .Flush();
+
+        return false;
+    }
+
+    // The root hash is only replaced after every node below it has been
+    // written, so an interrupted flush leaves the previous root intact
+    if (false == multiplex_.StoreRoot(true, root_->root_)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to store root hash")
+            .Flush();
+
+        return false;
+    }
+
+    root_dirty_ = false;
+
+    return true;
+}
+
 auto Storage::HashType() const -> std::uint32_t { return HASH_TYPE; }
 
 void Storage::InitBackup() { multiplex_.InitBackup(); }
@@ -1862,7 +1914,11 @@ auto Storage::root() const -> opentxs::storage::Root*
 
     if (!root_) {
         root_.reset(new opentxs::storage::Root(
-            multiplex_, multiplex_.LoadRoot(), gc_interval_, primary_bucket_));
+            multiplex_,
+            multiplex_.LoadRoot(),
+            gc_interval_,
+            primary_bucket_,
+            0 < write_back_interval_.count()));
     }
 
     OT_ASSERT(root_);
@@ -1901,6 +1957,12 @@ void Storage::save(opentxs::storage::Root* in, const Lock& lock) const
     OT_ASSERT(verify_write_lock(lock));
     OT_ASSERT(nullptr != in);
 
+    if (0 < write_back_interval_.count()) {
+        root_dirty_ = true;
+
+        return;
+    }
+
     multiplex_.StoreRoot(true, in->root_);
 }
 
@@ -2119,7 +2181,15 @@ auto Storage::ServerList() const -> ObjectList
     return Root().Tree().Servers().List();
 }
 
-void Storage::start() { InitPlugins(); }
+void Storage::start()
+{
+    InitPlugins();
+
+    if (0 < write_back_interval_.count()) {
+        flush_timer_ = std::make_unique<opentxs::storage::FlushTimer>(
+            write_back_interval_, [this] { Flush(); });
+    }
+}
 
 auto Storage::Store(
     const std::string& accountID,
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <ctime>
 #include <iosfwd>
@@ -81,6 +82,7 @@ class UnitDefinition;
 
 namespace storage
 {
+class FlushTimer;
 class Root;
 }  // namespace storage
 
@@ -194,6 +196,7 @@ public:
     auto DeletePaymentWorkflow(
         const std::string& nymID,
         const std::string& workflowID) const -> bool final;
+    auto Flush() const -> bool final;
     auto HashType() const -> std::uint32_t final;
     auto IssuerList(const std::string& nymID) const -> ObjectList final;
     auto Load(
@@ -484,10 +487,13 @@ private:
     const api::Crypto& crypto_;
     const Flag& running_;
     std::int64_t gc_interval_{std::numeric_limits<std::int64_t>::max()};
+    const std::chrono::milliseconds write_back_interval_;
     mutable std::mutex write_lock_;
     mutable std::unique_ptr<opentxs::storage::Root> root_;
+    mutable bool root_dirty_;
     mutable OTFlag primary_bucket_;
     std::vector<std::thread> background_threads_;
+    std::unique_ptr<opentxs::storage::FlushTimer> flush_timer_;
     const StorageConfig config_;
     std::unique_ptr<Multiplex> multiplex_p_;
     Multiplex& multiplex_;
@@ -502,6 +508,7 @@ private:
     void Cleanup();
     void Cleanup_Storage();
     void CollectGarbage() const;
+    auto flush(const Lock& lock) const -> bool;
     void InitBackup() final;
     void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) final;
     void InitPlugins();
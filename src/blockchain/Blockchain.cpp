@@ -320,6 +320,37 @@ SerializedBloomFilter::SerializedBloomFilter() noexcept
     static_assert(9 == sizeof(SerializedBloomFilter));
 }
 
+SerializedGCS::SerializedGCS(
+    const std::uint8_t bits,
+    const std::uint32_t fpRate,
+    const std::uint32_t count,
+    const ReadView key) noexcept(false)
+    : version_(current_version_)
+    , bits_(bits)
+    , fp_rate_(fpRate)
+    , count_(count)
+    , key_()
+{
+    static_assert(26 == sizeof(SerializedGCS));
+
+    if (key_.size() != key.size()) {
+        throw std::runtime_error(
+            "Invalid key size: " + std::to_string(key.size()));
+    }
+
+    std::memcpy(key_.data(), key.data(), key_.size());
+}
+
+SerializedGCS::SerializedGCS() noexcept
+    : version_()
+    , bits_()
+    , fp_rate_()
+    , count_()
+    , key_()
+{
+    static_assert(26 == sizeof(SerializedGCS));
+}
+
 auto BlockHashToFilterKey(const ReadView hash) noexcept(false) -> ReadView
 {
     if (16 > hash.size()) { throw std::runtime_error("Hash too short"); }
@@ -372,6 +403,27 @@ auto DefaultFilter(const Type type) noexcept -> filter::Type
     }
 }
 
+auto DecodeSerializedGCS(const ReadView bytes) noexcept(false)
+    -> std::pair<SerializedGCS, ReadView>
+{
+    auto output = std::pair<SerializedGCS, ReadView>{};
+    auto& [header, filter] = output;
+
+    if (sizeof(header) > bytes.size()) {
+        throw std::runtime_error("Record too short");
+    }
+
+    std::memcpy(static_cast<void*>(&header), bytes.data(), sizeof(header));
+
+    if (SerializedGCS::current_version_ != header.version_.value()) {
+        throw std::runtime_error("Unknown record version");
+    }
+
+    filter = bytes.substr(sizeof(header));
+
+    return output;
+}
+
 auto Deserialize(const Type chain, const std::uint8_t type) noexcept
     -> filter::Type
 {
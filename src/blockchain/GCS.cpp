@@ -10,13 +10,14 @@
 #include <boost/core/enable_if.hpp>
 #include <boost/cstdint.hpp>
 #include <boost/endian/buffers.hpp>
+#include <boost/endian/conversion.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <memory>
 #include <optional>
 #include <stdexcept>
@@ -28,21 +29,23 @@
 #include "blockchain/bitcoin/CompactSize.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "opentxs/Pimpl.hpp"
+#include "opentxs/Proto.tpp"
 #include "opentxs/api/Core.hpp"
 #include "opentxs/api/Factory.hpp"
-#include "opentxs/api/crypto/Crypto.hpp"
-#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Log.hpp"
 #include "opentxs/core/LogSource.hpp"
-#include "opentxs/protobuf/Enums.pb.h"
 #include "opentxs/protobuf/GCS.pb.h"
 #include "util/Container.hpp"
 
-//#define OT_METHOD "opentxs::blockchain::implementation::GCS::"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#define OT_METHOD "opentxs::blockchain::implementation::GCS::"
 
 namespace be = boost::endian;
 namespace mp = boost::multiprecision;
@@ -99,6 +102,42 @@ auto GCS(const api::Core& api, const proto::GCS& in) noexcept
     }
 }
 
+auto GCS(
+    const api::Core& api,
+    const ReadView in,
+    const bool view) noexcept -> std::unique_ptr<blockchain::client::GCS>
+{
+    using Flat = blockchain::internal::SerializedGCS;
+
+    if (in.empty()) { return nullptr; }
+
+    // A serialized proto::GCS always begins with a field tag of at least 0x08
+    // so it can not be confused with a flat record
+    if (Flat::current_version_ != static_cast<std::uint8_t>(in.front())) {
+        return GCS(api, proto::Factory<proto::GCS>(in.data(), in.size()));
+    }
+
+    try {
+        const auto [header, filter] =
+            blockchain::internal::DecodeSerializedGCS(in);
+        const auto key =
+            in.substr(offsetof(Flat, key_), sizeof(header.key_));
+
+        return std::make_unique<ReturnType>(
+            api,
+            header.bits_.value(),
+            header.fp_rate_.value(),
+            header.count_.value(),
+            key,
+            filter,
+            view);
+    } catch (const std::exception& e) {
+        LogVerbose("opentxs::factory::")(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return nullptr;
+    }
+}
+
 auto GCS(
     const api::Core& api,
     const std::uint8_t bits,
@@ -176,32 +215,128 @@ auto GCS(
 
 namespace opentxs::gcs
 {
-using BitReader = blockchain::internal::BitReader;
 using BitWriter = blockchain::internal::BitWriter;
+using SipKey = std::pair<std::uint64_t, std::uint64_t>;
 
-auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
-    -> std::uint64_t;
 auto golomb_encode(
     const std::uint8_t P,
     const std::uint64_t value,
     BitWriter& stream) noexcept -> void;
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t;
+auto hash_to_range(const std::uint64_t hash, const std::uint64_t range) noexcept
+    -> std::uint64_t;
+auto siphash(const SipKey& key, const ReadView item) noexcept -> std::uint64_t;
+auto sipkey(const ReadView key) noexcept(false) -> SipKey;
 
-auto golomb_decode(const std::uint8_t P, BitReader& stream) noexcept(false)
-    -> std::uint64_t
+inline auto leading_ones(const std::uint64_t word) noexcept -> std::size_t
 {
-    auto quotient = std::uint64_t{0};
+    const auto inverted = ~word;
 
-    while (1 == stream.read(1)) { quotient++; }
+    if (0u == inverted) { return 64u; }
 
-    auto remainder = stream.read(P);
+#ifndef _MSC_VER
+    return static_cast<std::size_t>(__builtin_clzll(inverted));
+#else
+    unsigned long index{};
+    _BitScanReverse64(&index, inverted);
 
-    return std::uint64_t{(quotient << P) + remainder};
+    return 63u - static_cast<std::size_t>(index);
+#endif
 }
 
+// Reads Golomb-Rice coded deltas from a filter a 64 bit word at a time.
+//
+// buffer_ holds the unread bits left-aligned. Bits to the right of the first
+// bits_ positions may contain a copy of the prefix of the next input byte,
+// which is harmless since that byte is always merged back into the same
+// position. Reading past the end of the input yields zero bits, which matches
+// the behavior of BitReader.
+class GolombReader
+{
+public:
+    auto Next() noexcept -> std::uint64_t
+    {
+        auto quotient = std::uint64_t{0};
+
+        while (true) {
+            if (0u == bits_) { refill(); }
+
+            const auto ones = std::min(leading_ones(buffer_), bits_);
+            quotient += ones;
+
+            if (ones < bits_) {
+                consume(ones + 1u);
+
+                break;
+            }
+
+            consume(ones);
+        }
+
+        if (0u == p_) { return quotient; }
+
+        if (bits_ < p_) { refill(); }
+
+        const auto remainder = std::uint64_t{buffer_ >> (64u - p_)};
+        consume(p_);
+
+        return std::uint64_t{(quotient << p_) + remainder};
+    }
+
+    GolombReader(const std::uint8_t P, const ReadView encoded) noexcept(false)
+        : p_(P)
+        , data_(reinterpret_cast<const std::uint8_t*>(encoded.data()))
+        , remaining_(encoded.size())
+        , buffer_(0)
+        , bits_(0)
+    {
+        if (56u < p_) {
+            throw std::out_of_range(
+                "Invalid golomb parameter: " + std::to_string(p_));
+        }
+    }
+
+private:
+    const std::size_t p_;
+    const std::uint8_t* data_;
+    std::size_t remaining_;
+    std::uint64_t buffer_;
+    std::size_t bits_;
+
+    auto consume(const std::size_t count) noexcept -> void
+    {
+        buffer_ = (64u > count) ? (buffer_ << count) : std::uint64_t{0};
+        bits_ -= count;
+    }
+    auto refill() noexcept -> void
+    {
+        if (sizeof(std::uint64_t) <= remaining_) {
+            auto word = std::uint64_t{};
+            std::memcpy(&word, data_, sizeof(word));
+            be::big_to_native_inplace(word);
+            const auto bytes = std::size_t{(63u - bits_) >> 3u};
+            buffer_ |= (word >> bits_);
+            data_ += bytes;
+            remaining_ -= bytes;
+            bits_ += bytes * 8u;
+        } else {
+            while ((56u >= bits_) && (0u < remaining_)) {
+                buffer_ |= (std::uint64_t{*data_} << (56u - bits_));
+                ++data_;
+                --remaining_;
+                bits_ += 8u;
+            }
+
+            if (0u == remaining_) { bits_ = 64u; }
+        }
+    }
+
+    GolombReader() = delete;
+    GolombReader(const GolombReader&) = delete;
+    GolombReader(GolombReader&&) = delete;
+    auto operator=(const GolombReader&) -> GolombReader& = delete;
+    auto operator=(GolombReader&&) -> GolombReader& = delete;
+};
+
 auto golomb_encode(
     const std::uint8_t P,
     const std::uint64_t value,
@@ -225,14 +360,13 @@ auto GolombDecode(
     const Space& encoded) noexcept(false) -> std::vector<std::uint64_t>
 {
     auto output = std::vector<std::uint64_t>{};
-    auto stream = BitReader(encoded);
+    output.reserve(N);
+    auto stream = GolombReader{P, reader(encoded)};
     auto last = std::uint64_t{0};
 
     for (auto i = std::size_t{0}; i < N; ++i) {
-        auto delta = golomb_decode(P, stream);
-        auto value = last + delta;
-        output.emplace_back(value);
-        last = value;
+        last += stream.Next();
+        output.emplace_back(last);
     }
 
     return output;
@@ -260,54 +394,122 @@ auto GolombEncode(
     return output;
 }
 
-auto siphash(
-    const api::Core& api,
-    const ReadView key,
-    const ReadView item) noexcept(false) -> std::uint64_t
-{
-    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
-
-    auto output = std::uint64_t{};
-    auto writer = [&output](const auto size) -> WritableView {
-        if (sizeof(output) != size) { throw std::out_of_range("wrong size"); }
+inline auto rotl(const std::uint64_t x, const int b) noexcept -> std::uint64_t
+{
+    return (x << b) | (x >> (64 - b));
+}
+
+inline auto sipround(
+    std::uint64_t& v0,
+    std::uint64_t& v1,
+    std::uint64_t& v2,
+    std::uint64_t& v3) noexcept -> void
+{
+    v0 += v1;
+    v1 = rotl(v1, 13);
+    v1 ^= v0;
+    v0 = rotl(v0, 32);
+    v2 += v3;
+    v3 = rotl(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotl(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotl(v1, 17);
+    v1 ^= v2;
+    v2 = rotl(v2, 32);
+}
+
+auto hash_to_range(
+    const std::uint64_t hash,
+    const std::uint64_t range) noexcept -> std::uint64_t
+{
+#ifndef _MSC_VER
+    return static_cast<std::uint64_t>(
+        (static_cast<unsigned __int128>(hash) *
+         static_cast<unsigned __int128>(range)) >>
+        64u);
+#else
+    return ((mp::uint128_t{hash} * mp::uint128_t{range}) >> 64u)
+        .convert_to<std::uint64_t>();
+#endif
+}
+
+// SipHash-2-4 as specified by BIP-158. This produces the same result as
+// crypto::HashingProvider::HMAC with proto::HASHTYPE_SIPHASH24 without the
+// per item overhead of routing through the crypto api.
+auto siphash(const SipKey& key, const ReadView item) noexcept -> std::uint64_t
+{
+    const auto& [k0, k1] = key;
+    auto v0 = std::uint64_t{0x736f6d6570736575ULL ^ k0};
+    auto v1 = std::uint64_t{0x646f72616e646f6dULL ^ k1};
+    auto v2 = std::uint64_t{0x6c7967656e657261ULL ^ k0};
+    auto v3 = std::uint64_t{0x7465646279746573ULL ^ k1};
+    const auto* it = reinterpret_cast<const std::uint8_t*>(item.data());
+    const auto size = item.size();
+    const auto* const end = it + (size - (size % sizeof(std::uint64_t)));
+
+    for (; it != end; it += sizeof(std::uint64_t)) {
+        auto m = std::uint64_t{};
+        std::memcpy(&m, it, sizeof(m));
+        be::little_to_native_inplace(m);
+        v3 ^= m;
+        sipround(v0, v1, v2, v3);
+        sipround(v0, v1, v2, v3);
+        v0 ^= m;
+    }
 
-        return {&output, sizeof(output)};
-    };
+    auto b = std::uint64_t{static_cast<std::uint64_t>(size) << 56u};
 
-    if (false == api.Crypto().Hash().HMAC(
-                     proto::HASHTYPE_SIPHASH24, key, item, writer)) {
-        throw std::runtime_error("siphash failed");
+    for (auto i = std::size_t{0}; i < (size % sizeof(std::uint64_t)); ++i) {
+        b |= std::uint64_t{it[i]} << (8u * i);
     }
 
+    v3 ^= b;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    v0 ^= b;
+    v2 ^= 0xff;
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+    sipround(v0, v1, v2, v3);
+
+    return v0 ^ v1 ^ v2 ^ v3;
+}
+
+auto sipkey(const ReadView key) noexcept(false) -> SipKey
+{
+    if (16 != key.size()) { throw std::runtime_error("Invalid key"); }
+
+    auto output = SipKey{};
+    auto& [k0, k1] = output;
+    std::memcpy(&k0, key.data(), sizeof(k0));
+    std::memcpy(&k1, key.data() + sizeof(k0), sizeof(k1));
+    be::little_to_native_inplace(k0);
+    be::little_to_native_inplace(k1);
+
     return output;
 }
 
 auto HashToRange(
-    const api::Core& api,
     const ReadView key,
     const std::uint64_t range,
     const ReadView item) noexcept(false) -> std::uint64_t
 {
-    return ((mp::uint128_t{siphash(api, key, item)} * mp::uint128_t{range}) >>
-            64u)
-        .convert_to<std::uint64_t>();
+    return hash_to_range(siphash(sipkey(key), item), range);
 }
 
 auto HashedSetConstruct(
-    const api::Core& api,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
     const std::vector<ReadView> items) noexcept(false)
     -> std::vector<std::uint64_t>
 {
-    auto output = std::vector<std::uint64_t>{};
-    const auto range = std::uint64_t{N} * std::uint64_t{M};
-    std::transform(
-        std::begin(items),
-        std::end(items),
-        std::back_inserter(output),
-        [&](const auto& item) { return HashToRange(api, key, range, item); });
+    auto output = blockchain::implementation::GCS::HashToRange(
+        key, std::uint64_t{N} * std::uint64_t{M}, items);
     std::sort(output.begin(), output.end());
 
     return output;
@@ -322,19 +524,21 @@ GCS::GCS(
     const std::uint32_t fpRate,
     const std::uint32_t filterElementCount,
     const ReadView key,
-    const ReadView encoded) noexcept(false)
+    const ReadView encoded,
+    const bool view) noexcept(false)
     : version_(1)
     , api_(api)
     , bits_(bits)
     , false_positive_rate_(fpRate)
     , count_(filterElementCount)
     , elements_()
-    , compressed_(api_.Factory().Data(encoded))
-    , key_(api_.Factory().Data(key))
+    , storage_(view ? Space{} : store(key, encoded))
+    , key_(view ? key : reader(storage_).substr(0, key.size()))
+    , compressed_(view ? encoded : reader(storage_).substr(key.size()))
 {
-    if (16u != key_->size()) {
+    if (16u != key_.size()) {
         throw std::runtime_error(
-            "Invalid key size: " + std::to_string(key_->size()));
+            "Invalid key size: " + std::to_string(key_.size()));
     }
 }
 
@@ -350,14 +554,13 @@ GCS::GCS(
     , false_positive_rate_(fpRate)
     , count_(elements.size())
     , elements_(gcs::HashedSetConstruct(
-          api_,
           key,
           static_cast<std::uint32_t>(elements.size()),
           false_positive_rate_,
           elements))
-    , compressed_(
-          api_.Factory().Data(reader(gcs::GolombEncode(bits_, *elements_))))
-    , key_(api_.Factory().Data(key))
+    , storage_(store(key, reader(gcs::GolombEncode(bits_, *elements_))))
+    , key_(reader(storage_).substr(0, key.size()))
+    , compressed_(reader(storage_).substr(key.size()))
 {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wtautological-type-limit-compare"
@@ -368,42 +571,19 @@ GCS::GCS(
     }
 #pragma GCC diagnostic pop
 
-    if (16u != key_->size()) {
+    if (16u != key_.size()) {
         throw std::runtime_error(
-            "Invalid key size: " + std::to_string(key_->size()));
+            "Invalid key size: " + std::to_string(key_.size()));
     }
 }
 
-auto GCS::Compressed() const noexcept -> Space
-{
-    return {
-        reinterpret_cast<const std::byte*>(compressed_->data()),
-        reinterpret_cast<const std::byte*>(compressed_->data()) +
-            compressed_->size()};
-}
-
-auto GCS::decompress() const noexcept -> const Elements&
-{
-    if (false == elements_.has_value()) {
-        auto& set = const_cast<std::optional<Elements>&>(elements_);
-        set = gcs::GolombDecode(
-            count_,
-            bits_,
-            Space{
-                reinterpret_cast<const std::byte*>(compressed_->data()),
-                reinterpret_cast<const std::byte*>(compressed_->data()) +
-                    compressed_->size()});
-        std::sort(set.value().begin(), set.value().end());
-    }
-
-    return elements_.value();
-}
+auto GCS::Compressed() const noexcept -> Space { return space(compressed_); }
 
 auto GCS::Encode() const noexcept -> OTData
 {
     const auto bytes = bitcoin::CompactSize(count_).Encode();
     auto output = Data::Factory(bytes.data(), bytes.size());
-    output->Concatenate(compressed_->data(), compressed_->size());
+    output->Concatenate(compressed_.data(), compressed_.size());
 
     return output;
 }
@@ -428,14 +608,28 @@ auto GCS::hashed_set_construct(const std::vector<Space>& elements)
 auto GCS::hashed_set_construct(const std::vector<ReadView>& elements)
     const noexcept -> std::vector<std::uint64_t>
 {
-    return gcs::HashedSetConstruct(
-        api_, key_->Bytes(), count_, false_positive_rate_, elements);
+    auto output = HashToRange(key_, range(), elements);
+    std::sort(output.begin(), output.end());
+
+    return output;
 }
 
-auto GCS::hash_to_range(const ReadView in) const noexcept -> std::uint64_t
+auto GCS::HashToRange(
+    const ReadView key,
+    const std::uint64_t range,
+    const std::vector<ReadView>& items) noexcept(false)
+    -> std::vector<std::uint64_t>
 {
-    return gcs::HashToRange(
-        api_, key_->Bytes(), count_ * false_positive_rate_, in);
+    const auto hashKey = gcs::sipkey(key);
+    auto output = std::vector<std::uint64_t>{};
+    output.reserve(items.size());
+
+    for (const auto& item : items) {
+        output.emplace_back(
+            gcs::hash_to_range(gcs::siphash(hashKey, item), range));
+    }
+
+    return output;
 }
 
 auto GCS::Header(const ReadView previous) const noexcept -> OTData
@@ -443,45 +637,140 @@ auto GCS::Header(const ReadView previous) const noexcept -> OTData
     return internal::FilterToHeader(api_, Encode()->Bytes(), previous);
 }
 
+template <typename Function>
+auto GCS::intersect(
+    const std::vector<std::uint64_t>& targets,
+    Function found) const noexcept -> void
+{
+    auto target = targets.cbegin();
+    const auto end = targets.cend();
+    auto check = [&](const std::uint64_t element) -> bool {
+        while ((end != target) && (*target < element)) { ++target; }
+
+        while ((end != target) && (*target == element)) {
+            const auto index =
+                static_cast<std::size_t>(std::distance(targets.cbegin(), target));
+
+            if (false == found(index)) { return false; }
+
+            ++target;
+        }
+
+        return end != target;
+    };
+
+    if (end == target) { return; }
+
+    if (elements_.has_value()) {
+        for (const auto& element : elements_.value()) {
+            if (false == check(element)) { return; }
+        }
+
+        return;
+    }
+
+    try {
+        auto stream = gcs::GolombReader{bits_, compressed_};
+        auto element = std::uint64_t{0};
+
+        for (auto i = std::uint32_t{0}; i < count_; ++i) {
+            element += stream.Next();
+
+            if (false == check(element)) { return; }
+        }
+    } catch (const std::exception& e) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+    }
+}
+
 auto GCS::Match(const Targets& targets) const noexcept -> Matches
 {
+    using Hashed = std::pair<std::uint64_t, Targets::const_iterator>;
+
     auto output = Matches{};
-    auto hashed = std::vector<std::uint64_t>{};
-    auto matches = std::vector<std::uint64_t>{};
-    auto map = std::map<std::uint64_t, Targets::const_iterator>{};
-    const auto& set = decompress();
-
-    for (auto i = targets.cbegin(); i != targets.cend(); ++i) {
-        const auto& hash = hashed.emplace_back(hash_to_range(*i));
-        map.emplace(hash, i);
+    auto hashed = std::vector<Hashed>{};
+    hashed.reserve(targets.size());
+    auto target = targets.cbegin();
+
+    for (const auto& hash : HashToRange(key_, range(), targets)) {
+        hashed.emplace_back(hash, target++);
     }
 
-    std::sort(std::begin(hashed), std::end(hashed));
-    std::set_intersection(
+    std::sort(
         std::begin(hashed),
         std::end(hashed),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    auto sorted = std::vector<std::uint64_t>{};
+    sorted.reserve(hashed.size());
     std::transform(
-        std::begin(matches),
-        std::end(matches),
-        std::back_inserter(output),
-        [&](const auto& in) { return map.at(in); });
+        std::begin(hashed),
+        std::end(hashed),
+        std::back_inserter(sorted),
+        [](const auto& in) { return in.first; });
+    intersect(sorted, [&](const auto index) {
+        output.emplace_back(hashed.at(index).second);
+
+        return true;
+    });
 
     return output;
 }
 
+auto GCS::range() const noexcept -> std::uint64_t
+{
+    return std::uint64_t{count_} * std::uint64_t{false_positive_rate_};
+}
+
 auto GCS::Serialize() const noexcept -> proto::GCS
 {
     auto output = proto::GCS{};
     output.set_version(version_);
     output.set_bits(bits_);
     output.set_fprate(false_positive_rate_);
-    output.set_key(key_->data(), key_->size());
+    output.set_key(key_.data(), key_.size());
     output.set_count(count_);
-    output.set_filter(
-        static_cast<const char*>(compressed_->data()), compressed_->size());
+    output.set_filter(compressed_.data(), compressed_.size());
+
+    return output;
+}
+
+auto GCS::Serialize(const AllocateOutput out) const noexcept -> bool
+{
+    if (false == bool(out)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid output allocator")
+            .Flush();
+
+        return false;
+    }
+
+    try {
+        const auto header =
+            internal::SerializedGCS{bits_, false_positive_rate_, count_, key_};
+        const auto target = sizeof(header) + compressed_.size();
+        auto output = out(target);
+
+        if (false == output.valid(target)) {
+            throw std::runtime_error("Failed to allocate output space");
+        }
+
+        auto* it = output.as<std::byte>();
+        std::memcpy(it, static_cast<const void*>(&header), sizeof(header));
+        std::advance(it, sizeof(header));
+        std::memcpy(it, compressed_.data(), compressed_.size());
+
+        return true;
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+}
+
+auto GCS::store(const ReadView key, const ReadView encoded) noexcept -> Space
+{
+    auto output = space(key);
+    const auto* it = reinterpret_cast<const std::byte*>(encoded.data());
+    output.insert(output.end(), it, it + encoded.size());
 
     return output;
 }
@@ -508,16 +797,14 @@ auto GCS::Test(const std::vector<Space>& targets) const noexcept -> bool
 
 auto GCS::test(const std::vector<std::uint64_t>& targets) const noexcept -> bool
 {
-    const auto& set = decompress();
-    auto matches = std::vector<std::uint64_t>{};
-    std::set_intersection(
-        std::begin(targets),
-        std::end(targets),
-        std::begin(set),
-        std::end(set),
-        std::back_inserter(matches));
+    auto output{false};
+    intersect(targets, [&](const auto) {
+        output = true;
 
-    return 0 < matches.size();
+        return false;
+    });
+
+    return output;
 }
 
 auto GCS::transform(const std::vector<OTData>& in) noexcept
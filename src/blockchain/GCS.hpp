@@ -40,17 +40,25 @@ public:
     auto Header(const ReadView previous) const noexcept -> OTData final;
     auto Match(const Targets&) const noexcept -> Matches final;
     auto Serialize() const noexcept -> proto::GCS final;
+    auto Serialize(const AllocateOutput out) const noexcept -> bool final;
     auto Test(const Data& target) const noexcept -> bool final;
     auto Test(const ReadView target) const noexcept -> bool final;
     auto Test(const std::vector<OTData>& targets) const noexcept -> bool final;
     auto Test(const std::vector<Space>& targets) const noexcept -> bool final;
 
+    static auto HashToRange(
+        const ReadView key,
+        const std::uint64_t range,
+        const std::vector<ReadView>& items) noexcept(false)
+        -> std::vector<std::uint64_t>;
+
     GCS(const api::Core& api,
         const std::uint8_t bits,
         const std::uint32_t fpRate,
         const std::uint32_t filterElementCount,
         const ReadView key,
-        const ReadView encoded)
+        const ReadView encoded,
+        const bool view = false)
     noexcept(false);
     GCS(const api::Core& api,
         const std::uint8_t bits,
@@ -70,24 +78,31 @@ private:
     const std::uint32_t false_positive_rate_;
     const std::uint32_t count_;
     const std::optional<Elements> elements_;
-    const OTData compressed_;
-    const OTData key_;
+    // Owned copy of the key followed by the encoded filter, empty for views
+    const Space storage_;
+    const ReadView key_;
+    const ReadView compressed_;
 
+    static auto store(const ReadView key, const ReadView encoded) noexcept
+        -> Space;
     static auto transform(const std::vector<OTData>& in) noexcept
         -> std::vector<ReadView>;
     static auto transform(const std::vector<Space>& in) noexcept
         -> std::vector<ReadView>;
 
-    auto decompress() const noexcept -> const Elements&;
     auto hashed_set_construct(const std::vector<OTData>& elements)
         const noexcept -> std::vector<std::uint64_t>;
     auto hashed_set_construct(const std::vector<Space>& elements) const noexcept
         -> std::vector<std::uint64_t>;
     auto hashed_set_construct(const std::vector<ReadView>& elements)
         const noexcept -> std::vector<std::uint64_t>;
+    template <typename Function>
+    auto intersect(
+        const std::vector<std::uint64_t>& targets,
+        Function found) const noexcept -> void;
     auto test(const std::vector<std::uint64_t>& targetHashes) const noexcept
         -> bool;
-    auto hash_to_range(const ReadView in) const noexcept -> std::uint64_t;
+    auto range() const noexcept -> std::uint64_t;
 
     GCS() = delete;
     GCS(const GCS&) = delete;
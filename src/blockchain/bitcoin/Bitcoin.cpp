@@ -395,6 +395,88 @@ auto EncodedTransaction::Deserialize(
     return output;
 }
 
+auto EncodedTransaction::Measure(const ReadView in) noexcept(false)
+    -> std::size_t
+{
+    auto layout = Layout{};
+
+    return Measure(in, layout);
+}
+
+auto EncodedTransaction::Measure(const ReadView in, Layout& layout) noexcept(
+    false) -> std::size_t
+{
+    if ((nullptr == in.data()) || (0 == in.size())) {
+        throw std::runtime_error("Invalid bytes");
+    }
+
+    auto it = reinterpret_cast<ByteIterator>(in.data());
+    const auto start{it};
+    auto expectedSize = sizeof(version_);
+    auto skip = [&](const std::size_t bytes) {
+        expectedSize += bytes;
+
+        if (in.size() < expectedSize) {
+            throw std::runtime_error("Partial transaction");
+        }
+
+        std::advance(it, bytes);
+    };
+    auto count = [&]() -> std::size_t {
+        expectedSize += 1;
+
+        if (in.size() < expectedSize) {
+            throw std::runtime_error("Partial transaction (compact size)");
+        }
+
+        auto output = std::size_t{};
+
+        if (false == bb::DecodeCompactSizeFromPayload(
+                         it, expectedSize, in.size(), output)) {
+            throw std::runtime_error("Failed to decode compact size");
+        }
+
+        return output;
+    };
+
+    if (in.size() < expectedSize) {
+        throw std::runtime_error("Partial transaction (version)");
+    }
+
+    std::advance(it, sizeof(version_));
+    const auto segwit = HasSegwit(it, expectedSize, in.size());
+    layout.inputs_ = static_cast<std::size_t>(std::distance(start, it));
+    const auto inputs = count();
+
+    for (auto i = std::size_t{0}; i < inputs; ++i) {
+        skip(sizeof(EncodedInput::outpoint_));
+        skip(count());
+        skip(sizeof(EncodedInput::sequence_));
+    }
+
+    const auto outputs = count();
+
+    for (auto i = std::size_t{0}; i < outputs; ++i) {
+        skip(sizeof(EncodedOutput::value_));
+        skip(count());
+    }
+
+    layout.witnesses_ = static_cast<std::size_t>(std::distance(start, it));
+
+    if (segwit.has_value()) {
+        for (auto i = std::size_t{0}; i < inputs; ++i) {
+            const auto items = count();
+
+            for (auto w = std::size_t{0}; w < items; ++w) { skip(count()); }
+        }
+    }
+
+    skip(sizeof(lock_time_));
+    layout.size_ = static_cast<std::size_t>(std::distance(start, it));
+
+    return layout.size_;
+}
+
 auto EncodedTransaction::wtxid_preimage() const noexcept -> Space
 {
     auto output = space(size());
@@ -18,6 +18,7 @@
 #include <iterator>
 #include <limits>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <stdexcept>
@@ -28,6 +29,7 @@
 
 #include "blockchain/block/Block.hpp"
 #include "blockchain/block/bitcoin/BlockParser.hpp"
+#include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
 #include "opentxs/api/Core.hpp"
@@ -66,26 +68,26 @@ auto BitcoinBlock(
             throw std::runtime_error{"Invalid generation transaction"};
         }
 
-        const auto& gen = *pGen;
+        auto transactions = std::vector<Block::value_type>{pGen};
         auto index = Block::TxidIndex{};
-        auto map = Block::TransactionMap{};
-
-        {
-            const auto& id = gen.ID();
-            index.emplace_back(id.begin(), id.end());
-            const auto& item = index.back();
-            map.emplace(reader(item), pGen);
-        }
 
         for (const auto& tx : extra) {
             if (false == bool(tx)) {
                 throw std::runtime_error{"Invalid transaction"};
             }
 
+            transactions.emplace_back(tx);
+        }
+
+        for (const auto& tx : transactions) {
             const auto& id = tx->ID();
-            index.emplace_back(id.begin(), id.end());
-            const auto& item = index.back();
-            map.emplace(reader(item), tx);
+            auto& txid = index.emplace_back();
+
+            if (txid.size() != id.size()) {
+                throw std::runtime_error{"Invalid txid"};
+            }
+
+            std::memcpy(txid.data(), id.data(), txid.size());
         }
 
         const auto chain = previous.Type();
@@ -114,8 +116,7 @@ auto BitcoinBlock(
                     api,
                     chain,
                     std::move(header),
-                    std::move(index),
-                    std::move(map));
+                    std::move(transactions));
             }
             case blockchain::Type::PKT:
             case blockchain::Type::PKT_testnet: {
@@ -198,15 +199,16 @@ auto parse_normal_block(
 
     const auto& header = *pHeader;
     auto sizeData = ReturnType::CalculatedSize{in.size(), bb::CompactSize{}};
-    auto [index, transactions] = parse_transactions(
-        api, blockchain, chain, in, header, sizeData, it, expectedSize);
+    auto table = parse_transactions(
+        api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<ReturnType>(
         api,
+        blockchain,
         chain,
         std::move(pHeader),
-        std::move(index),
-        std::move(transactions),
+        space(in),
+        std::move(table),
         std::move(sizeData));
 }
 }  // namespace opentxs::factory
@@ -307,41 +309,69 @@ const Block::value_type Block::null_tx_{};
 
 Block::Block(
     const api::Core& api,
+    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     std::unique_ptr<const internal::Header> header,
-    TxidIndex&& index,
-    TransactionMap&& transactions,
+    Space&& bytes,
+    TransactionTable&& table,
     std::optional<CalculatedSize>&& size) noexcept(false)
     : block::implementation::Block(api, *header)
+    , blockchain_(&blockchain)
+    , chain_(chain)
     , header_p_(std::move(header))
     , header_(*header_p_)
-    , index_(std::move(index))
-    , transactions_(std::move(transactions))
+    , bytes_(std::move(bytes))
+    , table_(std::move(table))
+    , order_(make_order(table_))
+    , transactions_(table_.size())
     , size_(std::move(size))
 {
-    if (index_.size() != transactions_.size()) {
-        throw std::runtime_error("Invalid transaction index");
+    if (false == bool(header_p_)) {
+        throw std::runtime_error("Invalid header");
+    }
+
+    for (const auto& entry : table_) {
+        if ((entry.offset_ > bytes_.size()) ||
+            (entry.size_ > (bytes_.size() - entry.offset_))) {
+            throw std::runtime_error("Invalid transaction location");
+        }
     }
+}
 
+Block::Block(
+    const api::Core& api,
+    const blockchain::Type chain,
+    std::unique_ptr<const internal::Header> header,
+    std::vector<value_type>&& transactions,
+    std::optional<CalculatedSize>&& size) noexcept(false)
+    : block::implementation::Block(api, *header)
+    , blockchain_(nullptr)
+    , chain_(chain)
+    , header_p_(std::move(header))
+    , header_(*header_p_)
+    , bytes_()
+    , table_(make_table(transactions))
+    , order_(make_order(table_))
+    , transactions_(table_.size())
+    , size_(std::move(size))
+{
     if (false == bool(header_p_)) {
         throw std::runtime_error("Invalid header");
     }
 
-    for (const auto& [txid, tx] : transactions_) {
-        if (false == bool(tx)) {
-            throw std::runtime_error("Invalid transaction");
-        }
+    for (auto i = std::size_t{0}; i < table_.size(); ++i) {
+        transactions_.at(i) = transactions.at(table_.at(i).position_);
     }
 }
 
 auto Block::at(const std::size_t index) const noexcept -> const value_type&
 {
     try {
-        if (index_.size() <= index) {
+        if (order_.size() <= index) {
             throw std::out_of_range("invalid index " + std::to_string(index));
         }
 
-        return at(reader(index_.at(index)));
+        return get(order_.at(index));
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -352,8 +382,20 @@ auto Block::at(const std::size_t index) const noexcept -> const value_type&
 auto Block::at(const ReadView txid) const noexcept -> const value_type&
 {
     try {
+        const auto it = std::lower_bound(
+            table_.begin(),
+            table_.end(),
+            txid,
+            [](const auto& lhs, const auto& rhs) {
+                return reader(lhs.txid_) < rhs;
+            });
+
+        if ((table_.end() == it) || (reader(it->txid_) != txid)) {
+            throw std::out_of_range("transaction not found");
+        }
 
-        return transactions_.at(txid);
+        return get(
+            static_cast<std::size_t>(std::distance(table_.begin(), it)));
     } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": transaction ")(
             api_.Factory().Data(txid)->asHex())(" not found in block ")(
@@ -420,12 +462,41 @@ auto Block::calculate_merkle_row(
     return true;
 }
 
+auto Block::calculate_merkle_pairs(
+    const api::Core& api,
+    const Type chain,
+    const TxidIndex& txids,
+    const std::size_t start,
+    const std::size_t stop,
+    MerkleRow& row) -> bool
+{
+    OT_ASSERT(0u == (start % 2u));
+    OT_ASSERT(stop <= txids.size());
+
+    const auto count{txids.size()};
+
+    for (auto i{start}; i < stop; i += 2u) {
+        const auto offset = std::size_t{(1u == (count - i)) ? 0u : 1u};
+        auto& next = row.at(i / 2u);
+        const auto hashed = calculate_merkle_hash(
+            api,
+            chain,
+            txids.at(i),
+            txids.at(i + offset),
+            preallocated(next.size(), next.data()));
+
+        if (false == hashed) { return false; }
+    }
+
+    return true;
+}
+
 auto Block::calculate_merkle_value(
     const api::Core& api,
     const Type chain,
     const TxidIndex& txids) -> block::pHash
 {
-    using Hash = std::array<std::byte, 32>;
+    using Hash = MerkleRow::value_type;
 
     if (0 == txids.size()) {
         constexpr auto blank = Hash{};
@@ -434,14 +505,26 @@ auto Block::calculate_merkle_value(
             reinterpret_cast<const char*>(blank.data()), blank.size()});
     }
 
-    if (1 == txids.size()) { return api.Factory().Data(txids.at(0)); }
+    if (1 == txids.size()) {
+        return api.Factory().Data(reader(txids.at(0)));
+    }
+
+    auto row = MerkleRow{};
+    row.reserve(txids.size());
+    calculate_merkle_row(api, chain, txids, row);
+
+    return calculate_merkle_value(api, chain, std::move(row));
+}
 
-    auto a = std::vector<Hash>{};
-    auto b = std::vector<Hash>{};
-    a.reserve(txids.size());
-    b.reserve(txids.size());
+auto Block::calculate_merkle_value(
+    const api::Core& api,
+    const Type chain,
+    MerkleRow&& row) -> block::pHash
+{
+    auto a = std::move(row);
+    auto b = MerkleRow{};
+    b.reserve(a.size());
     auto counter{0};
-    calculate_merkle_row(api, chain, txids, a);
 
     if (1u == a.size()) { return api.Factory().Data(reader(a.at(0))); }
 
@@ -456,10 +539,17 @@ auto Block::calculate_merkle_value(
 
 auto Block::calculate_size() const noexcept -> CalculatedSize
 {
-    auto output = CalculatedSize{0, bb::CompactSize(transactions_.size())};
+    auto output = CalculatedSize{0, bb::CompactSize(order_.size())};
     auto& [bytes, cs] = output;
+
+    if (false == bytes_.empty()) {
+        bytes = bytes_.size();
+
+        return output;
+    }
+
     auto cb = [](const auto& previous, const auto& in) -> std::size_t {
-        return previous + in.second->CalculateSize();
+        return previous + in->CalculateSize();
     };
     bytes = std::accumulate(
         std::begin(transactions_),
@@ -474,16 +564,24 @@ auto Block::ExtractElements(const FilterType style) const noexcept
     -> std::vector<Space>
 {
     auto output = std::vector<Space>{};
-    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(transactions_.size())(
+    LogTrace(OT_METHOD)(__FUNCTION__)(": processing ")(order_.size())(
         " transactions")
         .Flush();
 
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->ExtractElements(style);
-        output.insert(
-            output.end(),
-            std::make_move_iterator(temp.begin()),
-            std::make_move_iterator(temp.end()));
+    try {
+        for (const auto index : order_) {
+            auto temp = peek(index)->ExtractElements(style);
+            output.insert(
+                output.end(),
+                std::make_move_iterator(temp.begin()),
+                std::make_move_iterator(temp.end()));
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": block ")(header_.Hash().asHex())(
+            ": ")(e.what())
+            .Flush();
+
+        return {};
     }
 
     LogTrace(OT_METHOD)(__FUNCTION__)(": extracted ")(output.size())(
@@ -503,12 +601,21 @@ auto Block::FindMatches(
 
     auto output = Matches{};
 
-    for (const auto& [txid, tx] : transactions_) {
-        auto temp = tx->FindMatches(blockchain, style, outpoints, patterns);
-        output.insert(
-            output.end(),
-            std::make_move_iterator(temp.begin()),
-            std::make_move_iterator(temp.end()));
+    try {
+        for (const auto index : order_) {
+            auto temp = peek(index)->FindMatches(
+                blockchain, style, outpoints, patterns);
+            output.insert(
+                output.end(),
+                std::make_move_iterator(temp.begin()),
+                std::make_move_iterator(temp.end()));
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": block ")(header_.Hash().asHex())(
+            ": ")(e.what())
+            .Flush();
+
+        return {};
     }
 
     dedup(output);
@@ -516,6 +623,22 @@ auto Block::FindMatches(
     return output;
 }
 
+auto Block::get(const std::size_t index) const noexcept(false)
+    -> const value_type&
+{
+    auto& output = transactions_.at(index);
+
+    if (std::atomic_load(&output)) { return output; }
+
+    // Another thread may decode the same transaction at the same time. Only
+    // the first result is kept.
+    auto expected = value_type{};
+    std::atomic_compare_exchange_strong(
+        &output, &expected, instantiate(table_.at(index)));
+
+    return output;
+}
+
 auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
 {
     if (false == size_.has_value()) { size_ = calculate_size(); }
@@ -525,6 +648,97 @@ auto Block::get_or_calculate_size() const noexcept -> CalculatedSize
     return size_.value();
 }
 
+auto Block::instantiate(const TransactionEntry& entry) const noexcept(false)
+    -> value_type
+{
+    if (nullptr == blockchain_) {
+        throw std::runtime_error("Missing transaction");
+    }
+
+    const auto bytes = ReadView{
+        std::next(reinterpret_cast<const char*>(bytes_.data()), entry.offset_),
+        entry.size_};
+    auto output = value_type{factory::BitcoinTransaction(
+        api_,
+        *blockchain_,
+        chain_,
+        (0u == entry.position_),
+        header_.Timestamp(),
+        bb::EncodedTransaction::Deserialize(api_, chain_, bytes))};
+
+    if (false == bool(output)) {
+        throw std::runtime_error(
+            "Failed to decode transaction " +
+            api_.Factory().Data(reader(entry.txid_))->asHex());
+    }
+
+    return output;
+}
+
+auto Block::make_order(const TransactionTable& table) noexcept(false)
+    -> std::vector<std::size_t>
+{
+    auto output = std::vector<std::size_t>(table.size());
+    auto found = std::vector<bool>(table.size(), false);
+
+    for (auto i = std::size_t{0}; i < table.size(); ++i) {
+        const auto position = table.at(i).position_;
+
+        if ((position >= table.size()) || found.at(position)) {
+            throw std::runtime_error("Invalid transaction index");
+        }
+
+        if ((0u < i) && (table.at(i - 1u).txid_ >= table.at(i).txid_)) {
+            throw std::runtime_error("Unsorted or duplicate transaction");
+        }
+
+        found.at(position) = true;
+        output.at(position) = i;
+    }
+
+    return output;
+}
+
+auto Block::make_table(const std::vector<value_type>& transactions) noexcept(
+    false) -> TransactionTable
+{
+    auto output = TransactionTable{};
+    output.reserve(transactions.size());
+
+    for (auto i = std::size_t{0}; i < transactions.size(); ++i) {
+        const auto& tx = transactions.at(i);
+
+        if (false == bool(tx)) {
+            throw std::runtime_error("Invalid transaction");
+        }
+
+        const auto& id = tx->ID();
+        auto& entry = output.emplace_back();
+
+        if (entry.txid_.size() != id.size()) {
+            throw std::runtime_error("Invalid txid");
+        }
+
+        std::memcpy(entry.txid_.data(), id.data(), entry.txid_.size());
+        entry.position_ = i;
+    }
+
+    std::sort(output.begin(), output.end(), [](const auto& l, const auto& r) {
+        return l.txid_ < r.txid_;
+    });
+
+    return output;
+}
+
+auto Block::peek(const std::size_t index) const noexcept(false) -> value_type
+{
+    if (auto output = std::atomic_load(&transactions_.at(index)); output) {
+        return output;
+    }
+
+    return instantiate(table_.at(index));
+}
+
 auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
 {
     if (false == bool(bytes)) {
@@ -547,6 +761,14 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
     LogInsane(OT_METHOD)(__FUNCTION__)(": Serializing ")(txCount.Value())(
         " transactions into ")(size)(" bytes.")
         .Flush();
+
+    // A parsed block already holds its serialized form
+    if (false == bytes_.empty()) {
+        std::memcpy(out.data(), bytes_.data(), bytes_.size());
+
+        return true;
+    }
+
     auto remaining = std::size_t{size};
     auto it = static_cast<std::byte*>(out.data());
 
@@ -579,30 +801,26 @@ auto Block::Serialize(AllocateOutput bytes) const noexcept -> bool
     remaining -= txCount.Size();
     std::advance(it, txCount.Size());
 
-    for (const auto& txid : index_) {
-        try {
-            const auto& pTX = transactions_.at(reader(txid));
-
-            OT_ASSERT(pTX);
-
-            const auto& tx = *pTX;
-            const auto encoded = tx.Serialize(preallocated(remaining, it));
+    for (const auto& pTX : *this) {
+        if (false == bool(pTX)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": missing transaction").Flush();
 
-            if (false == encoded.has_value()) {
-                LogOutput(OT_METHOD)(__FUNCTION__)(
-                    ": failed to serialize transaction ")(tx.ID().asHex())
-                    .Flush();
+            return false;
+        }
 
-                return false;
-            }
+        const auto& tx = *pTX;
+        const auto encoded = tx.Serialize(preallocated(remaining, it));
 
-            remaining -= encoded.value();
-            std::advance(it, encoded.value());
-        } catch (...) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": missing transaction").Flush();
+        if (false == encoded.has_value()) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": failed to serialize transaction ")(tx.ID().asHex())
+                .Flush();
 
             return false;
         }
+
+        remaining -= encoded.value();
+        std::advance(it, encoded.value());
     }
 
     if (0 != remaining) {
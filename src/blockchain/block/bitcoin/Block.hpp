@@ -5,9 +5,9 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <iosfwd>
-#include <map>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -61,8 +61,20 @@ class Block : public bitcoin::Block, public block::implementation::Block
 public:
     using CalculatedSize =
         std::pair<std::size_t, blockchain::bitcoin::CompactSize>;
-    using TxidIndex = std::vector<Space>;
-    using TransactionMap = std::map<ReadView, value_type>;
+    using Txid = std::array<std::byte, 32>;
+    using TxidIndex = std::vector<Txid>;
+    using MerkleRow = std::vector<Txid>;
+
+    /// Locates one transaction inside the serialized block. Offset and size
+    /// are zero for blocks which were not parsed from serialized bytes.
+    struct TransactionEntry {
+        Txid txid_{};
+        std::size_t position_{};
+        std::size_t offset_{};
+        std::size_t size_{};
+    };
+    /// Sorted by txid
+    using TransactionTable = std::vector<TransactionEntry>;
 
     static const std::size_t header_bytes_;
 
@@ -79,10 +91,24 @@ public:
         const Type chain,
         const InputContainer& in,
         OutputContainer& out) -> bool;
+    /// Calculates the parents of txids in the range [start, stop) into the
+    /// corresponding positions of row. start must be even.
+    static auto calculate_merkle_pairs(
+        const api::Core& api,
+        const Type chain,
+        const TxidIndex& txids,
+        const std::size_t start,
+        const std::size_t stop,
+        MerkleRow& row) -> bool;
     static auto calculate_merkle_value(
         const api::Core& api,
         const Type chain,
         const TxidIndex& txids) -> block::pHash;
+    /// Finishes the calculation from the first row above the txids
+    static auto calculate_merkle_value(
+        const api::Core& api,
+        const Type chain,
+        MerkleRow&& row) -> block::pHash;
 
     auto at(const std::size_t index) const noexcept -> const value_type& final;
     auto at(const ReadView txid) const noexcept -> const value_type& final;
@@ -91,13 +117,24 @@ public:
     {
         return get_or_calculate_size().first;
     }
+    /// Number of transactions which have been decoded and cached
+    auto Decoded() const noexcept -> std::size_t
+    {
+        auto output = std::size_t{0};
+
+        for (const auto& tx : transactions_) {
+            if (std::atomic_load(&tx)) { ++output; }
+        }
+
+        return output;
+    }
     auto cbegin() const noexcept -> const_iterator final
     {
         return const_iterator(this, 0);
     }
     auto cend() const noexcept -> const_iterator final
     {
-        return const_iterator(this, index_.size());
+        return const_iterator(this, order_.size());
     }
     auto end() const noexcept -> const_iterator final { return cend(); }
     auto ExtractElements(const FilterType style) const noexcept
@@ -108,14 +145,22 @@ public:
         const Patterns& outpoints,
         const Patterns& scripts) const noexcept -> Matches final;
     auto Serialize(AllocateOutput bytes) const noexcept -> bool final;
-    auto size() const noexcept -> std::size_t final { return index_.size(); }
+    auto size() const noexcept -> std::size_t final { return order_.size(); }
 
+    /// Transactions are decoded from bytes on first use
+    Block(
+        const api::Core& api,
+        const api::client::Blockchain& blockchain,
+        const blockchain::Type chain,
+        std::unique_ptr<const internal::Header> header,
+        Space&& bytes,
+        TransactionTable&& table,
+        std::optional<CalculatedSize>&& size = {}) noexcept(false);
     Block(
         const api::Core& api,
         const blockchain::Type chain,
         std::unique_ptr<const internal::Header> header,
-        TxidIndex&& index,
-        TransactionMap&& transactions,
+        std::vector<value_type>&& transactions,
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
     ~Block() override;
 
@@ -125,15 +170,35 @@ protected:
 private:
     static const value_type null_tx_;
 
+    const api::client::Blockchain* const blockchain_;
+    const blockchain::Type chain_;
     const std::unique_ptr<const internal::Header> header_p_;
     const internal::Header& header_;
-    const TxidIndex index_;
-    const TransactionMap transactions_;
+    const Space bytes_;
+    const TransactionTable table_;
+    // Position in table_ of each transaction, in block order
+    const std::vector<std::size_t> order_;
+    // Same order as table_. Each element is only ever written once, by
+    // atomic compare exchange, so references to it remain valid. Only
+    // transactions handed out by at() or iteration are cached; the serialized
+    // bytes are the only copy of the others.
+    mutable std::vector<value_type> transactions_;
     mutable std::optional<CalculatedSize> size_;
 
+    static auto make_order(const TransactionTable& table) noexcept(false)
+        -> std::vector<std::size_t>;
+    static auto make_table(const std::vector<value_type>& transactions)
+        noexcept(false) -> TransactionTable;
+
     auto calculate_size() const noexcept -> CalculatedSize;
     virtual auto extra_bytes() const noexcept -> std::size_t { return 0; }
+    auto get(const std::size_t index) const noexcept(false)
+        -> const value_type&;
     auto get_or_calculate_size() const noexcept -> CalculatedSize;
+    auto instantiate(const TransactionEntry& entry) const noexcept(false)
+        -> value_type;
+    // Returns the cached transaction, or decodes one without caching it
+    auto peek(const std::size_t index) const noexcept(false) -> value_type;
     virtual auto serialize_post_header(ByteIterator& it, std::size_t& remaining)
         const noexcept -> bool;
 
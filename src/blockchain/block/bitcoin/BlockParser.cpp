@@ -8,8 +8,11 @@
 #include "blockchain/block/bitcoin/BlockParser.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <stdexcept>
 #include <string_view>
 #include <vector>
@@ -18,12 +21,24 @@
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "internal/blockchain/block/Block.hpp"
 #include "internal/blockchain/block/bitcoin/Bitcoin.hpp"
+#include "internal/blockchain/client/Client.hpp"
 #include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Endpoints.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/block/bitcoin/Header.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/Frame.hpp"
+#include "opentxs/network/zeromq/FrameSection.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/socket/Push.hpp"
+#include "opentxs/network/zeromq/socket/Sender.tpp"  // IWYU pragma: keep
+#include "opentxs/network/zeromq/socket/Socket.hpp"
 
 namespace opentxs::factory
 {
+// Version, input count, output count, and lock time
+constexpr auto min_transaction_size_ = std::size_t{10};
+
 auto parse_header(
     const api::Core& api,
     const blockchain::Type chain,
@@ -59,7 +74,6 @@ auto parse_header(
 
 auto parse_transactions(
     const api::Core& api,
-    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     const ReadView in,
     const blockchain::block::bitcoin::Header& header,
@@ -67,6 +81,8 @@ auto parse_transactions(
     ByteIterator& it,
     std::size_t& expectedSize) -> ParsedTransactions
 {
+    using Pool = blockchain::client::internal::ThreadPool;
+
     expectedSize += 1;
 
     if (in.size() < expectedSize) {
@@ -84,32 +100,55 @@ auto parse_transactions(
 
     if (0 == transactionCount) { throw std::runtime_error("Empty block"); }
 
-    auto counter = int{-1};
-    auto output = ParsedTransactions{};
-    auto& [index, transactions] = output;
+    // Locate every transaction before hashing any of them so the hashing can
+    // be divided between threads
+    auto locations = std::vector<TransactionParser::Location>{};
+    locations.reserve(std::min<std::size_t>(
+        transactionCount, (in.size() - expectedSize) / min_transaction_size_));
 
-    while (transactions.size() < transactionCount) {
-        auto data = bb::EncodedTransaction::Deserialize(
-            api,
-            chain,
+    while (locations.size() < transactionCount) {
+        auto& [offset, layout] = locations.emplace_back();
+        offset = expectedSize;
+        const auto txBytes = bb::EncodedTransaction::Measure(
             ReadView{
-                reinterpret_cast<const char*>(it), in.size() - expectedSize});
-        const auto txBytes = data.size();
+                reinterpret_cast<const char*>(it), in.size() - expectedSize},
+            layout);
         std::advance(it, txBytes);
         expectedSize += txBytes;
-        auto& txid = index.emplace_back(data.txid_);
-        transactions.emplace(
-            reader(txid),
-            BitcoinTransaction(
-                api,
-                blockchain,
-                chain,
-                (0 == ++counter),
-                header.Timestamp(),
-                std::move(data)));
     }
 
-    const auto merkle = ReturnType::calculate_merkle_value(api, chain, index);
+    auto job = std::make_shared<TransactionParser>(
+        api, chain, in, std::move(locations));
+    const auto helpers =
+        std::min(std::max(Pool::Capacity(), std::size_t{1}), job->Chunks()) -
+        1u;
+
+    if (0u < helpers) {
+        auto pool = api.ZeroMQ().PushSocket(
+            network::zeromq::socket::Socket::Direction::Connect);
+
+        if (pool->Start(api.Endpoints().InternalBlockchainThreadPool())) {
+            for (auto i = std::size_t{0}; i < helpers; ++i) {
+                auto pointer =
+                    std::make_unique<TransactionParser::Pointer>(job);
+                auto work = Pool::MakeWork(api, chain, Pool::Work::BlockParser);
+                work->AddFrame(reinterpret_cast<std::uintptr_t>(pointer.get()));
+
+                // The parsing thread runs any chunks the pool does not claim
+                if (false == pool->Send(work)) { break; }
+
+                // Now owned by the thread pool job
+                pointer.release();
+            }
+        }
+    }
+
+    job->Run();
+    auto output = ParsedTransactions{};
+    auto row = ReturnType::MerkleRow{};
+    job->Finish(output, row);
+    const auto merkle =
+        ReturnType::calculate_merkle_value(api, chain, std::move(row));
 
     if (header.MerkleRoot() != merkle) {
         throw std::runtime_error("Invalid merkle hash");
@@ -117,4 +156,173 @@ auto parse_transactions(
 
     return output;
 }
+
+TransactionParser::TransactionParser(
+    const api::Core& api,
+    const blockchain::Type chain,
+    const ReadView block,
+    std::vector<Location>&& transactions) noexcept
+    : api_(api)
+    , chain_(chain)
+    , block_(block)
+    , locations_(std::move(transactions))
+    , chunks_((locations_.size() + chunk_size_ - 1u) / chunk_size_)
+    , txids_(locations_.size())
+    , row_((locations_.size() + 1u) / 2u)
+    , next_(0)
+    , finished_(0)
+    , failed_(false)
+    , promise_()
+    , done_(promise_.get_future())
+{
+    static_assert(0u == (chunk_size_ % 2u));
+
+    if (0u == chunks_) { promise_.set_value(); }
+}
+
+auto TransactionParser::calculate_txid(
+    const std::size_t index,
+    Space& preimage) noexcept(false) -> bool
+{
+    constexpr auto version = sizeof(bb::EncodedTransaction::version_);
+    constexpr auto lockTime = sizeof(bb::EncodedTransaction::lock_time_);
+    const auto& [offset, layout] = locations_.at(index);
+    const auto* bytes = std::next(block_.data(), offset);
+    auto& txid = txids_.at(index);
+
+    // Without a segwit marker the entire transaction is the txid preimage
+    if (version == layout.inputs_) {
+        return TransactionHash(
+            api_,
+            chain_,
+            ReadView{bytes, layout.size_},
+            preallocated(txid.size(), txid.data()));
+    }
+
+    const auto body = layout.witnesses_ - layout.inputs_;
+    preimage.resize(version + body + lockTime);
+    auto* it = preimage.data();
+    std::memcpy(it, bytes, version);
+    std::advance(it, version);
+    std::memcpy(it, std::next(bytes, layout.inputs_), body);
+    std::advance(it, body);
+    std::memcpy(it, std::next(bytes, layout.size_ - lockTime), lockTime);
+
+    return TransactionHash(
+        api_, chain_, reader(preimage), preallocated(txid.size(), txid.data()));
+}
+
+// Every field was bounds checked by Measure while the transactions were
+// located. This verifies the resulting layout, which both the txid preimage
+// and the later decode of the transaction rely on.
+auto TransactionParser::check_bounds(const std::size_t index) const noexcept
+    -> bool
+{
+    constexpr auto version = sizeof(bb::EncodedTransaction::version_);
+    constexpr auto lockTime = sizeof(bb::EncodedTransaction::lock_time_);
+    const auto& [offset, layout] = locations_.at(index);
+    const auto& [inputs, witnesses, size] = layout;
+
+    return (min_transaction_size_ <= size) && (offset <= block_.size()) &&
+           (size <= (block_.size() - offset)) && (version <= inputs) &&
+           (inputs < witnesses) && ((witnesses + lockTime) <= size);
+}
+
+auto TransactionParser::Finish(
+    ParsedTransactions& output,
+    ReturnType::MerkleRow& row) noexcept(false) -> void
+{
+    done_.wait();
+
+    if (failed_) { throw std::runtime_error("Invalid transaction"); }
+
+    output.clear();
+    output.reserve(txids_.size());
+
+    for (auto i = std::size_t{0}; i < txids_.size(); ++i) {
+        const auto& [offset, layout] = locations_.at(i);
+        output.push_back({txids_.at(i), i, offset, layout.size_});
+    }
+
+    std::sort(output.begin(), output.end(), [](const auto& l, const auto& r) {
+        return l.txid_ < r.txid_;
+    });
+    const auto duplicate = std::adjacent_find(
+        output.begin(), output.end(), [](const auto& l, const auto& r) {
+            return l.txid_ == r.txid_;
+        });
+
+    if (output.end() != duplicate) {
+        throw std::runtime_error("Duplicate transaction");
+    }
+
+    // A block with a single transaction uses the txid as the merkle root
+    if (1u == txids_.size()) { row_.at(0) = txids_.at(0); }
+
+    row = std::move(row_);
+}
+
+auto TransactionParser::Run() noexcept -> void
+{
+    for (auto chunk = next_++; chunk < chunks_; chunk = next_++) {
+        run(chunk);
+    }
+}
+
+auto TransactionParser::run(const std::size_t chunk) noexcept -> void
+{
+    const auto start = chunk * chunk_size_;
+    const auto stop = std::min(start + chunk_size_, locations_.size());
+
+    try {
+        if (false == failed_) {
+            auto preimage = Space{};
+
+            for (auto i{start}; i < stop; ++i) {
+                if ((false == check_bounds(i)) ||
+                    (false == calculate_txid(i, preimage))) {
+                    failed_ = true;
+
+                    break;
+                }
+            }
+
+            if ((false == failed_) && (1u < locations_.size()) &&
+                (false == ReturnType::calculate_merkle_pairs(
+                              api_, chain_, txids_, start, stop, row_))) {
+                failed_ = true;
+            }
+        }
+    } catch (...) {
+        failed_ = true;
+    }
+
+    if (chunks_ == ++finished_) { promise_.set_value(); }
+}
 }  // namespace opentxs::factory
+
+namespace opentxs::blockchain::block::bitcoin::internal
+{
+auto ProcessThreadPool(const network::zeromq::Message& in) noexcept -> void
+{
+    using Job = factory::TransactionParser::Pointer;
+
+    const auto body = in.Body();
+
+    if (1 > body.size()) {
+        LogOutput("opentxs::blockchain::block::bitcoin::internal::")(
+            __FUNCTION__)(": Invalid message")
+            .Flush();
+
+        OT_FAIL;
+    }
+
+    auto job = std::unique_ptr<Job>{
+        reinterpret_cast<Job*>(body.at(0).as<std::uintptr_t>())};
+
+    OT_ASSERT(job);
+    OT_ASSERT(*job);
+
+    (*job)->Run();
+}
+}  // namespace opentxs::blockchain::block::bitcoin::internal
@@ -8,10 +8,12 @@
 #include <boost/endian/buffers.hpp>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -85,8 +87,63 @@ namespace opentxs::factory
 {
 using ReturnType = blockchain::block::bitcoin::implementation::Block;
 using ByteIterator = const std::byte*;
-using ParsedTransactions =
-    std::pair<ReturnType::TxidIndex, ReturnType::TransactionMap>;
+using ParsedTransactions = ReturnType::TransactionTable;
+
+// Hashes the transactions of a block in fixed size chunks directly from the
+// serialized block. Each chunk checks the bounds of its transactions before
+// hashing them, and also produces its part of the first merkle row. Chunks
+// are claimed by the parsing thread and by any thread pool workers which join
+// the job, so the job completes even if no worker is available.
+class TransactionParser
+{
+public:
+    using Pointer = std::shared_ptr<TransactionParser>;
+    /// Offset of the transaction in the block, and its layout
+    using Location = std::pair<std::size_t, bb::EncodedTransaction::Layout>;
+
+    static constexpr auto chunk_size_ = std::size_t{128};
+
+    auto Chunks() const noexcept { return chunks_; }
+
+    /// Waits for every chunk then moves the results out
+    ///
+    /// Throws std::runtime_error if any transaction is out of bounds or
+    /// failed to hash, or if the block contains duplicate transactions
+    auto Finish(ParsedTransactions& output, ReturnType::MerkleRow& row)
+        noexcept(false) -> void;
+    auto Run() noexcept -> void;
+
+    TransactionParser(
+        const api::Core& api,
+        const blockchain::Type chain,
+        const ReadView block,
+        std::vector<Location>&& transactions) noexcept;
+
+private:
+    const api::Core& api_;
+    const blockchain::Type chain_;
+    const ReadView block_;
+    const std::vector<Location> locations_;
+    const std::size_t chunks_;
+    ReturnType::TxidIndex txids_;
+    ReturnType::MerkleRow row_;
+    std::atomic<std::size_t> next_;
+    std::atomic<std::size_t> finished_;
+    std::atomic<bool> failed_;
+    std::promise<void> promise_;
+    std::future<void> done_;
+
+    auto calculate_txid(const std::size_t index, Space& preimage) noexcept(
+        false) -> bool;
+    auto check_bounds(const std::size_t index) const noexcept -> bool;
+    auto run(const std::size_t chunk) noexcept -> void;
+
+    TransactionParser() = delete;
+    TransactionParser(const TransactionParser&) = delete;
+    TransactionParser(TransactionParser&&) = delete;
+    auto operator=(const TransactionParser&) -> TransactionParser& = delete;
+    auto operator=(TransactionParser&&) -> TransactionParser& = delete;
+};
 
 auto parse_header(
     const api::Core& api,
@@ -109,7 +166,6 @@ auto parse_pkt_block(
     -> std::shared_ptr<blockchain::block::bitcoin::Block>;
 auto parse_transactions(
     const api::Core& api,
-    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     const ReadView in,
     const blockchain::block::bitcoin::Header& header,
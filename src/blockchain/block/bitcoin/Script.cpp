@@ -48,132 +48,32 @@ auto BitcoinScript(
     const auto role = isOutput ? ReturnType::Position::Output
                                : (isCoinbase ? ReturnType::Position::Coinbase
                                              : ReturnType::Position::Input);
-    auto elements = blockchain::block::bitcoin::ScriptElements{};
 
     if ((nullptr == bytes.data()) || (0 == bytes.size()) ||
         (ReturnType::Position::Coinbase == role)) {
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), 0);
+            chain, role, blockchain::block::bitcoin::ScriptElements{}, 0);
     }
 
-    elements.reserve(bytes.size());
-    auto it = reinterpret_cast<const std::byte*>(bytes.data());
-    auto read = std::size_t{0};
-    const auto target = bytes.size();
-
-    try {
-        while (read < target) {
-            auto& element = elements.emplace_back();
-            auto& [opcode, invalid, size, data] = element;
-
-            try {
-                opcode = ReturnType::decode(*it);
-            } catch (...) {
-                if (allowInvalidOpcodes) {
-                    opcode = blockchain::block::bitcoin::OP::INVALIDOPCODE;
-                    invalid = *it;
-                } else {
-                    throw;
-                }
-            }
-
-            read += 1;
-            std::advance(it, 1);
-            const auto direct = ReturnType::is_direct_push(opcode);
-
-            if (direct.has_value()) {
-                const auto& pushSize = direct.value();
-                const auto remaining = target - read;
-                const auto effectiveSize = allowInvalidOpcodes
-                                               ? std::min(pushSize, remaining)
-                                               : pushSize;
-
-                if ((read + effectiveSize) > target) {
-                    LogVerbose("opentxs::factory::")(__FUNCTION__)(
-                        ": Incomplete direct data push")
-                        .Flush();
-
-                    return {};
-                }
-
-                data = space(effectiveSize);
-                std::memcpy(data.value().data(), it, effectiveSize);
-                read += effectiveSize;
-                std::advance(it, effectiveSize);
+    if (ReturnType::Position::Output == role) {
+        using Template = blockchain::block::bitcoin::internal::ScriptTemplate;
 
-                continue;
-            }
-
-            const auto push = ReturnType::is_push(opcode);
-
-            if (push.has_value()) {
-                auto buf = be::little_uint32_buf_t{};
-
-                {
-                    const auto& sizeBytes = push.value();
-
-                    OT_ASSERT(0 < sizeBytes);
-                    OT_ASSERT(5 > sizeBytes);
-
-                    const auto remaining = target - read;
-                    const auto effectiveSize =
-                        allowInvalidOpcodes ? std::min(sizeBytes, remaining)
-                                            : sizeBytes;
-
-                    if ((read + effectiveSize) > target) {
-                        LogVerbose("opentxs::factory::")(__FUNCTION__)(
-                            ": Incomplete data push")
-                            .Flush();
-
-                        return {};
-                    }
-
-                    size = space(effectiveSize);
-                    std::memcpy(size.value().data(), it, effectiveSize);
-                    read += effectiveSize;
-                    std::advance(it, effectiveSize);
-                    std::memcpy(
-                        static_cast<void*>(&buf),
-                        size.value().data(),
-                        effectiveSize);
-                }
-
-                {
-                    const auto pushSize = std::size_t{buf.value()};
-                    const auto remaining = target - read;
-                    const auto effectiveSize =
-                        allowInvalidOpcodes ? std::min(pushSize, remaining)
-                                            : pushSize;
+        const auto standard =
+            blockchain::block::bitcoin::internal::ClassifyScript(bytes);
 
-                    if ((read + effectiveSize) > target) {
-                        LogVerbose("opentxs::factory::")(__FUNCTION__)(
-                            ": Data push bytes missing")
-                            .Flush();
-
-                        return {};
-                    }
-
-                    data = space(effectiveSize);
-                    std::memcpy(data.value().data(), it, effectiveSize);
-                    read += effectiveSize;
-                    std::advance(it, effectiveSize);
-                }
-
-                continue;
-            }
+        if (Template::Nonstandard != standard.template_) {
+            return std::make_unique<ReturnType>(
+                chain, role, bytes, standard.Pattern());
         }
-    } catch (...) {
-        LogVerbose("opentxs::factory::")(__FUNCTION__)(": Unknown opcode")
-            .Flush();
-
-        return {};
     }
 
-    elements.shrink_to_fit();
+    auto elements = ReturnType::parse(bytes, allowInvalidOpcodes);
+
+    if (false == elements.has_value()) { return {}; }
 
     try {
         return std::make_unique<ReturnType>(
-            chain, role, std::move(elements), bytes.size());
+            chain, role, std::move(elements.value()), bytes.size());
     } catch (const std::exception& e) {
         LogVerbose("opentxs::factory::")(__FUNCTION__)(": ")(e.what()).Flush();
 
@@ -230,6 +130,134 @@ auto Script::blank_pubkey(
 
     return mode ? compressed : uncompressed;
 }
+
+auto ClassifyScript(const ReadView bytes) noexcept -> StandardScript
+{
+    auto output = StandardScript{};
+    const auto size = bytes.size();
+
+    if ((nullptr == bytes.data()) || (0 == size)) { return output; }
+
+    auto byte = [&](const std::size_t position) -> std::uint8_t {
+        return static_cast<std::uint8_t>(bytes[position]);
+    };
+    auto push = [&](const std::size_t position, const std::size_t length) {
+        output.pushes_.at(output.count_++) = bytes.substr(position, length);
+    };
+    // OP_1 through OP_16
+    auto number = [&](const std::size_t position) -> std::uint8_t {
+        const auto value = byte(position);
+
+        if ((0x51 > value) || (0x60 < value)) { return 0u; }
+
+        return value - 0x50;
+    };
+
+    // OP_DUP OP_HASH160 <20> OP_EQUALVERIFY OP_CHECKSIG
+    if ((25u == size) && (0x76 == byte(0)) && (0xa9 == byte(1)) &&
+        (0x14 == byte(2)) && (0x88 == byte(23)) && (0xac == byte(24))) {
+        push(3, 20);
+        output.template_ = ScriptTemplate::PayToPubkeyHash;
+
+        return output;
+    }
+
+    // OP_HASH160 <20> OP_EQUAL
+    if ((23u == size) && (0xa9 == byte(0)) && (0x14 == byte(1)) &&
+        (0x87 == byte(22))) {
+        push(2, 20);
+        output.template_ = ScriptTemplate::PayToScriptHash;
+
+        return output;
+    }
+
+    // OP_0 <20>
+    if ((22u == size) && (0x00 == byte(0)) && (0x14 == byte(1))) {
+        push(2, 20);
+        output.template_ = ScriptTemplate::PayToWitnessPubkeyHash;
+
+        return output;
+    }
+
+    // OP_0 <32>
+    if ((34u == size) && (0x00 == byte(0)) && (0x20 == byte(1))) {
+        push(2, 32);
+        output.template_ = ScriptTemplate::PayToWitnessScriptHash;
+
+        return output;
+    }
+
+    // <33 or 65> OP_CHECKSIG
+    if ((0xac == byte(size - 1u)) && (size == (2u + byte(0))) &&
+        ((0x21 == byte(0)) || (0x41 == byte(0)))) {
+        push(1, byte(0));
+        output.template_ = ScriptTemplate::PayToPubkey;
+
+        return output;
+    }
+
+    // OP_M <33 or 65>... OP_N OP_CHECKMULTISIG
+    if ((4u <= size) && (0xae == byte(size - 1u))) {
+        const auto m = number(0);
+        const auto n = number(size - 2u);
+
+        if ((0u == m) || (m > n)) { return output; }
+
+        auto position = std::size_t{1};
+
+        for (auto i = std::uint8_t{0}; i < n; ++i) {
+            if ((size - 2u) <= position) { return {}; }
+
+            const auto length = std::size_t{byte(position)};
+
+            if ((0x21 != length) && (0x41 != length)) { return {}; }
+            if ((size - 2u) < (position + 1u + length)) { return {}; }
+
+            push(position + 1u, length);
+            position += 1u + length;
+        }
+
+        if ((size - 2u) != position) { return {}; }
+
+        output.m_ = m;
+        output.template_ = ScriptTemplate::PayToMultisig;
+
+        return output;
+    }
+
+    return output;
+}
+
+auto StandardScript::Pattern() const noexcept -> bitcoin::Script::Pattern
+{
+    using Type = bitcoin::Script::Pattern;
+
+    switch (template_) {
+        case ScriptTemplate::PayToMultisig: {
+
+            return Type::PayToMultisig;
+        }
+        case ScriptTemplate::PayToPubkey: {
+
+            return Type::PayToPubkey;
+        }
+        case ScriptTemplate::PayToPubkeyHash: {
+
+            return Type::PayToPubkeyHash;
+        }
+        case ScriptTemplate::PayToScriptHash: {
+
+            return Type::PayToScriptHash;
+        }
+        case ScriptTemplate::PayToWitnessPubkeyHash:
+        case ScriptTemplate::PayToWitnessScriptHash:
+        case ScriptTemplate::Nonstandard:
+        default: {
+
+            return Type::Custom;
+        }
+    }
+}
 }  // namespace opentxs::blockchain::block::bitcoin::internal
 
 namespace opentxs::blockchain::block::bitcoin::implementation
@@ -241,16 +269,36 @@ Script::Script(
     std::optional<std::size_t> size) noexcept
     : chain_(chain)
     , role_(role)
+    , serialized_()
+    , decoded_()
     , elements_(std::move(elements))
     , type_(get_type(role_, elements_))
     , size_(size)
 {
 }
 
+Script::Script(
+    const blockchain::Type chain,
+    const Position role,
+    const ReadView bytes,
+    const Pattern type) noexcept
+    : chain_(chain)
+    , role_(role)
+    , serialized_(space(bytes))
+    , decoded_()
+    , elements_()
+    , type_(type)
+    , size_(bytes.size())
+{
+}
+
 Script::Script(const Script& rhs) noexcept
     : chain_(rhs.chain_)
     , role_(rhs.role_)
-    , elements_(rhs.elements_)
+    , serialized_(rhs.serialized_)
+    , decoded_()
+    , elements_(
+          rhs.serialized_.has_value() ? ScriptElements{} : rhs.elements_)
     , type_(rhs.type_)
     , size_(rhs.size_)
 {
@@ -293,7 +341,7 @@ auto Script::CalculateHash160(const api::Core& api, const AllocateOutput output)
 
 auto Script::CalculateSize() const noexcept -> std::size_t
 {
-    if (false == size_.has_value()) { size_ = bytes(elements_); }
+    if (false == size_.has_value()) { size_ = bytes(elements()); }
 
     return size_.value();
 }
@@ -585,9 +633,76 @@ auto Script::evaluate_script_hash(const ScriptElements& script) noexcept
     return Pattern::PayToScriptHash;
 }
 
+auto Script::classified() const noexcept -> internal::StandardScript
+{
+    OT_ASSERT(serialized_.has_value());
+
+    return internal::ClassifyScript(reader(serialized_.value()));
+}
+
+auto Script::elements() const noexcept -> const ScriptElements&
+{
+    if (serialized_.has_value()) {
+        std::call_once(decoded_, [this] {
+            auto decoded = parse(reader(serialized_.value()), false);
+
+            // Scripts which match a standard template always decode
+            OT_ASSERT(decoded.has_value());
+
+            elements_ = std::move(decoded.value());
+        });
+    }
+
+    return elements_;
+}
+
+auto Script::extract_data(
+    const ReadView data,
+    std::vector<Space>& output) noexcept -> void
+{
+    auto it = reinterpret_cast<const std::byte*>(data.data());
+
+    switch (data.size()) {
+        case 65: {
+            std::advance(it, 1);
+            [[fallthrough]];
+        }
+        case 64: {
+            output.emplace_back(it, it + 32);
+            std::advance(it, 32);
+            output.emplace_back(it, it + 32);
+            [[fallthrough]];
+        }
+        case 33:
+        case 32:
+        case 20: {
+            const auto* start = reinterpret_cast<const std::byte*>(data.data());
+            output.emplace_back(start, start + data.size());
+        } break;
+        default: {
+        }
+    }
+}
+
 auto Script::ExtractElements(const filter::Type style) const noexcept
     -> std::vector<Space>
 {
+    // Standard scripts provide their data pushes without being decoded
+    if (serialized_.has_value()) {
+        auto output = std::vector<Space>{};
+
+        if (filter::Type::Extended_opentxs == style) {
+            for (const auto& data : classified()) {
+                extract_data(data, output);
+            }
+        } else {
+            const auto& bytes = serialized_.value();
+            output.emplace_back(bytes.cbegin(), bytes.cend());
+        }
+
+        return output;
+    }
+
     if (0 == elements_.size()) {
         LogTrace(OT_METHOD)(__FUNCTION__)(": skipping empty script").Flush();
 
@@ -603,28 +718,7 @@ auto Script::ExtractElements(const filter::Type style) const noexcept
 
             for (const auto& element : *this) {
                 if (is_data_push(element)) {
-                    const auto& data = element.data_.value();
-                    auto it{data.data()};
-
-                    switch (data.size()) {
-                        case 65: {
-                            std::advance(it, 1);
-                            [[fallthrough]];
-                        }
-                        case 64: {
-                            output.emplace_back(it, it + 32);
-                            std::advance(it, 32);
-                            output.emplace_back(it, it + 32);
-                            [[fallthrough]];
-                        }
-                        case 33:
-                        case 32:
-                        case 20: {
-                            output.emplace_back(data.cbegin(), data.cend());
-                        } break;
-                        default: {
-                        }
-                    }
+                    extract_data(reader(element.data_.value()), output);
                 }
             }
 
@@ -686,7 +780,7 @@ auto Script::first_opcode(const ScriptElements& script) noexcept -> OP
 auto Script::get_data(const std::size_t position) const noexcept(false)
     -> ReadView
 {
-    auto& data = elements_.at(position).data_;
+    auto& data = elements().at(position).data_;
 
     if (false == data.has_value()) {
         throw std::out_of_range("No data at specified script position");
@@ -697,7 +791,7 @@ auto Script::get_data(const std::size_t position) const noexcept(false)
 
 auto Script::get_opcode(const std::size_t position) const noexcept(false) -> OP
 {
-    return elements_.at(position).opcode_;
+    return elements().at(position).opcode_;
 }
 
 auto Script::get_type(
@@ -841,6 +935,21 @@ auto Script::LikelyPubkeyHashes(const api::Core& api) const noexcept
         case Pattern::NullData:
         case Pattern::Input:
         default: {
+            if (serialized_.has_value()) {
+                for (const auto& data : classified()) {
+                    if (20 == data.size()) {
+                        output.emplace_back(api.Factory().Data(data));
+                    } else if ((33 == data.size()) || (65 == data.size())) {
+                        auto hash = api.Factory().Data();
+                        blockchain::PubkeyHash(
+                            api, chain_, data, hash->WriteInto());
+                        output.emplace_back(std::move(hash));
+                    }
+                }
+
+                break;
+            }
+
             for (const auto& element : elements_) {
                 if (is_hash160(element)) {
                     OT_ASSERT(element.data_.has_value());
@@ -868,6 +977,7 @@ auto Script::LikelyPubkeyHashes(const api::Core& api) const noexcept
 auto Script::M() const noexcept -> std::optional<std::uint8_t>
 {
     if (Pattern::PayToMultisig != type_) { return {}; }
+    if (serialized_.has_value()) { return classified().m_; }
 
     return to_number(get_opcode(0));
 }
@@ -880,6 +990,7 @@ auto Script::MultisigPubkey(const std::size_t position) const noexcept
     const auto index = std::size_t{position + 1u};
 
     if (index > N()) { return {}; }
+    if (serialized_.has_value()) { return classified().pushes_.at(position); }
 
     return get_data(index);
 }
@@ -888,9 +999,136 @@ auto Script::N() const noexcept -> std::optional<std::uint8_t>
 {
     if (Pattern::PayToMultisig != type_) { return {}; }
 
+    if (serialized_.has_value()) {
+        return static_cast<std::uint8_t>(classified().count_);
+    }
+
     return to_number(get_opcode(elements_.size() - 2));
 }
 
+auto Script::parse(
+    const ReadView bytes,
+    const bool allowInvalidOpcodes) noexcept -> std::optional<ScriptElements>
+{
+    auto elements = ScriptElements{};
+    elements.reserve(bytes.size());
+    auto it = reinterpret_cast<const std::byte*>(bytes.data());
+    auto read = std::size_t{0};
+    const auto target = bytes.size();
+
+    try {
+        while (read < target) {
+            auto& element = elements.emplace_back();
+            auto& [opcode, invalid, size, data] = element;
+
+            try {
+                opcode = decode(*it);
+            } catch (...) {
+                if (allowInvalidOpcodes) {
+                    opcode = OP::INVALIDOPCODE;
+                    invalid = *it;
+                } else {
+                    throw;
+                }
+            }
+
+            read += 1;
+            std::advance(it, 1);
+            const auto direct = is_direct_push(opcode);
+
+            if (direct.has_value()) {
+                const auto& pushSize = direct.value();
+                const auto remaining = target - read;
+                const auto effectiveSize = allowInvalidOpcodes
+                                               ? std::min(pushSize, remaining)
+                                               : pushSize;
+
+                if ((read + effectiveSize) > target) {
+                    LogVerbose(OT_METHOD)(__FUNCTION__)(
+                        ": Incomplete direct data push")
+                        .Flush();
+
+                    return std::nullopt;
+                }
+
+                data = space(effectiveSize);
+                std::memcpy(data.value().data(), it, effectiveSize);
+                read += effectiveSize;
+                std::advance(it, effectiveSize);
+
+                continue;
+            }
+
+            const auto push = is_push(opcode);
+
+            if (push.has_value()) {
+                auto buf = be::little_uint32_buf_t{};
+
+                {
+                    const auto& sizeBytes = push.value();
+
+                    OT_ASSERT(0 < sizeBytes);
+                    OT_ASSERT(5 > sizeBytes);
+
+                    const auto remaining = target - read;
+                    const auto effectiveSize =
+                        allowInvalidOpcodes ? std::min(sizeBytes, remaining)
+                                            : sizeBytes;
+
+                    if ((read + effectiveSize) > target) {
+                        LogVerbose(OT_METHOD)(__FUNCTION__)(
+                            ": Incomplete data push")
+                            .Flush();
+
+                        return std::nullopt;
+                    }
+
+                    size = space(effectiveSize);
+                    std::memcpy(size.value().data(), it, effectiveSize);
+                    read += effectiveSize;
+                    std::advance(it, effectiveSize);
+                    std::memcpy(
+                        static_cast<void*>(&buf),
+                        size.value().data(),
+                        effectiveSize);
+                }
+
+                {
+                    const auto pushSize = std::size_t{buf.value()};
+                    const auto remaining = target - read;
+                    const auto effectiveSize =
+                        allowInvalidOpcodes ? std::min(pushSize, remaining)
+                                            : pushSize;
+
+                    if ((read + effectiveSize) > target) {
+                        LogVerbose(OT_METHOD)(__FUNCTION__)(
+                            ": Data push bytes missing")
+                            .Flush();
+
+                        return std::nullopt;
+                    }
+
+                    data = space(effectiveSize);
+                    std::memcpy(data.value().data(), it, effectiveSize);
+                    read += effectiveSize;
+                    std::advance(it, effectiveSize);
+                }
+
+                continue;
+            }
+        }
+    } catch (...) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Unknown opcode")
+            .Flush();
+
+        return std::nullopt;
+    }
+
+    elements.shrink_to_fit();
+
+    return elements;
+}
+
 auto Script::potential_data(const ScriptElements& script) noexcept -> bool
 {
     return (OP::RETURN == first_opcode(script)) && (2 <= script.size());
@@ -922,6 +1160,7 @@ auto Script::potential_script_hash(const ScriptElements& script) noexcept
 auto Script::Pubkey() const noexcept -> std::optional<ReadView>
 {
     if (Pattern::PayToPubkey != type_) { return {}; }
+    if (serialized_.has_value()) { return classified().pushes_.at(0); }
 
     return get_data(0);
 }
@@ -929,6 +1168,7 @@ auto Script::Pubkey() const noexcept -> std::optional<ReadView>
 auto Script::PubkeyHash() const noexcept -> std::optional<ReadView>
 {
     if (Pattern::PayToPubkeyHash != type_) { return {}; }
+    if (serialized_.has_value()) { return classified().pushes_.at(0); }
 
     return get_data(2);
 }
@@ -936,9 +1176,11 @@ auto Script::PubkeyHash() const noexcept -> std::optional<ReadView>
 auto Script::RedeemScript() const noexcept -> std::unique_ptr<bitcoin::Script>
 {
     if (Position::Input != role_) { return {}; }
-    if (0 == elements_.size()) { return {}; }
+    const auto& script = elements();
+
+    if (0 == script.size()) { return {}; }
 
-    const auto& element = *elements_.crbegin();
+    const auto& element = *script.crbegin();
 
     if (false == is_data_push(element)) { return {}; }
 
@@ -949,6 +1191,7 @@ auto Script::RedeemScript() const noexcept -> std::unique_ptr<bitcoin::Script>
 auto Script::ScriptHash() const noexcept -> std::optional<ReadView>
 {
     if (Pattern::PayToScriptHash != type_) { return {}; }
+    if (serialized_.has_value()) { return classified().pushes_.at(0); }
 
     return get_data(1);
 }
@@ -977,6 +1220,12 @@ auto Script::Serialize(const AllocateOutput destination) const noexcept -> bool
 
     auto it = static_cast<std::byte*>(output.data());
 
+    if (serialized_.has_value()) {
+        std::memcpy(it, serialized_.value().data(), size);
+
+        return true;
+    }
+
     for (const auto& element : elements_) {
         const auto& [opcode, invalid, bytes, data] = element;
 
@@ -1017,7 +1266,7 @@ auto Script::str() const noexcept -> std::string
 {
     auto output = std::stringstream{};
 
-    for (const auto& [opcode, invalid, push, data] : elements_) {
+    for (const auto& [opcode, invalid, push, data] : elements()) {
         output << "op: " << std::to_string(static_cast<std::uint8_t>(opcode));
 
         if (invalid) {
@@ -1120,7 +1369,7 @@ auto Script::Value(const std::size_t position) const noexcept
 
     const auto index = position + 1u;
 
-    if (index > elements_.size()) { return {}; }
+    if (index > elements().size()) { return {}; }
 
     return get_data(index);
 }
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -45,12 +46,14 @@ public:
         -> std::optional<std::size_t>;
     static auto is_push(const OP opcode) noexcept(false)
         -> std::optional<std::size_t>;
+    static auto parse(const ReadView bytes, const bool allowInvalidOpcodes)
+        noexcept -> std::optional<ScriptElements>;
     static auto validate(const ScriptElements& elements) noexcept -> bool;
 
     auto at(const std::size_t position) const noexcept(false)
         -> const value_type& final
     {
-        return elements_.at(position);
+        return elements().at(position);
     }
     auto begin() const noexcept -> const_iterator final { return cbegin(); }
     auto CalculateHash160(const api::Core& api, const AllocateOutput output)
@@ -62,7 +65,7 @@ public:
     }
     auto cend() const noexcept -> const_iterator final
     {
-        return const_iterator(this, elements_.size());
+        return const_iterator(this, elements().size());
     }
     auto end() const noexcept -> const_iterator final { return cend(); }
     auto ExtractElements(const filter::Type style) const noexcept
@@ -91,7 +94,10 @@ public:
         -> bool final;
     auto SigningSubscript(const blockchain::Type chain) const noexcept
         -> std::unique_ptr<internal::Script> final;
-    auto size() const noexcept -> std::size_t final { return elements_.size(); }
+    auto size() const noexcept -> std::size_t final
+    {
+        return elements().size();
+    }
     auto str() const noexcept -> std::string final;
     auto Type() const noexcept -> Pattern final { return type_; }
     auto Value(const std::size_t position) const noexcept
@@ -102,6 +108,13 @@ public:
         const Position role,
         ScriptElements&& elements,
         std::optional<std::size_t> size = {}) noexcept;
+    /// Elements are decoded from bytes on first use. Only for scripts which
+    /// match a standard template.
+    Script(
+        const blockchain::Type chain,
+        const Position role,
+        const ReadView bytes,
+        const Pattern type) noexcept;
     Script(const Script&) noexcept;
 
     ~Script() final = default;
@@ -109,7 +122,9 @@ public:
 private:
     const blockchain::Type chain_;
     const Position role_;
-    const ScriptElements elements_;
+    const std::optional<Space> serialized_;
+    mutable std::once_flag decoded_;
+    mutable ScriptElements elements_;
     const Pattern type_;
     mutable std::optional<std::size_t> size_;
 
@@ -118,6 +133,9 @@ private:
     static auto is_data_push(const value_type& element) noexcept -> bool;
     static auto is_hash160(const value_type& element) noexcept -> bool;
     static auto is_public_key(const value_type& element) noexcept -> bool;
+    static auto extract_data(
+        const ReadView data,
+        std::vector<Space>& output) noexcept -> void;
     static auto evaluate_data(const ScriptElements& script) noexcept -> Pattern;
     static auto evaluate_multisig(const ScriptElements& script) noexcept
         -> Pattern;
@@ -145,6 +163,8 @@ private:
         const ScriptElement& element,
         const bool checkForData = false) noexcept -> bool;
 
+    auto classified() const noexcept -> internal::StandardScript;
+    auto elements() const noexcept -> const ScriptElements&;
     auto get_data(const std::size_t position) const noexcept(false) -> ReadView;
     auto get_opcode(const std::size_t position) const noexcept(false) -> OP;
 
@@ -88,16 +88,17 @@ auto parse_pkt_block(
 
     const auto proofEnd{it};
     auto sizeData = ReturnType::CalculatedSize{in.size(), bb::CompactSize{}};
-    auto [index, transactions] = parse_transactions(
-        api, blockchain, chain, in, header, sizeData, it, expectedSize);
+    auto table = parse_transactions(
+        api, chain, in, header, sizeData, it, expectedSize);
 
     return std::make_shared<ReturnType>(
         api,
+        blockchain,
         chain,
         std::move(pHeader),
         std::move(proofs),
-        std::move(index),
-        std::move(transactions),
+        space(in),
+        std::move(table),
         static_cast<std::size_t>(std::distance(proofStart, proofEnd)),
         std::move(sizeData));
 }
@@ -107,19 +108,21 @@ namespace opentxs::blockchain::block::pkt
 {
 Block::Block(
     const api::Core& api,
+    const api::client::Blockchain& blockchain,
     const blockchain::Type chain,
     std::unique_ptr<const bitcoin::internal::Header> header,
     Proofs&& proofs,
-    TxidIndex&& index,
-    TransactionMap&& transactions,
+    Space&& bytes,
+    TransactionTable&& table,
     std::optional<std::size_t>&& proofBytes,
     std::optional<CalculatedSize>&& size) noexcept(false)
     : ot_super(
           api,
+          blockchain,
           chain,
           std::move(header),
-          std::move(index),
-          std::move(transactions),
+          std::move(bytes),
+          std::move(table),
           std::move(size))
     , proofs_(std::move(proofs))
     , proof_bytes_(std::move(proofBytes))
@@ -56,11 +56,12 @@ public:
 
     Block(
         const api::Core& api,
+        const api::client::Blockchain& blockchain,
         const blockchain::Type chain,
         std::unique_ptr<const bitcoin::internal::Header> header,
         Proofs&& proofs,
-        TxidIndex&& index,
-        TransactionMap&& transactions,
+        Space&& bytes,
+        TransactionTable&& table,
         std::optional<std::size_t>&& proofBytes = {},
         std::optional<CalculatedSize>&& size = {}) noexcept(false);
 
@@ -7,10 +7,11 @@
 
 #include <boost/container/flat_map.hpp>
 #include <chrono>
-#include <deque>
+#include <cstddef>
 #include <functional>
 #include <future>
 #include <iosfwd>
+#include <list>
 #include <map>
 #include <mutex>
 #include <string>
@@ -54,6 +55,54 @@ class BlockOracle final : public internal::BlockOracle,
                           public Worker<BlockOracle, api::Core>
 {
 public:
+    // Least recently used blocks are evicted once the combined estimated
+    // size of the cached blocks exceeds the limit
+    struct Mem {
+        // Approximate heap usage of each decoded object, including its
+        // shared_ptr control block, its copies of the txid and its cached
+        // patterns
+        static constexpr std::size_t transaction_overhead_{512};
+        static constexpr std::size_t input_overhead_{384};
+        static constexpr std::size_t output_overhead_{256};
+
+        /// Approximate memory used by a parsed block: its serialized size
+        /// plus the decoded transaction, input and output objects
+        static auto EstimateSize(
+            const block::bitcoin::Block& block) noexcept -> std::size_t;
+
+        auto bytes() const noexcept { return bytes_; }
+        auto hits() const noexcept { return hits_; }
+        auto misses() const noexcept { return misses_; }
+
+        auto clear() noexcept -> void;
+        auto find(const ReadView& id) noexcept -> BitcoinBlockFuture;
+        auto push(
+            block::pHash&& id,
+            BitcoinBlockFuture future,
+            const std::size_t bytes) noexcept -> void;
+
+        Mem(const std::size_t limit) noexcept;
+
+    private:
+        struct Item {
+            block::pHash id_;
+            BitcoinBlockFuture future_;
+            std::size_t bytes_;
+        };
+
+        using Completed = std::list<Item>;
+        using Index = boost::container::flat_map<ReadView, Completed::iterator>;
+
+        const std::size_t limit_;
+        Completed queue_;
+        Index index_;
+        std::size_t bytes_;
+        std::size_t hits_;
+        std::size_t misses_;
+
+        auto erase(const Completed::iterator it) noexcept -> void;
+    };
+
     auto Heartbeat() const noexcept -> void final { trigger(); }
     auto LoadBitcoin(const block::Hash& block) const noexcept
         -> BitcoinBlockFuture final;
@@ -101,29 +150,8 @@ private:
         ~Cache() { Shutdown(); }
 
     private:
-        static const std::size_t cache_limit_;
         static const std::chrono::seconds download_timeout_;
 
-        struct Mem {
-            auto find(const ReadView& id) const noexcept -> BitcoinBlockFuture;
-
-            auto clear() noexcept -> void;
-            auto push(block::pHash&& id, BitcoinBlockFuture&& future) noexcept
-                -> void;
-
-            Mem(const std::size_t limit) noexcept;
-
-        private:
-            using Completed =
-                std::deque<std::pair<block::pHash, BitcoinBlockFuture>>;
-            using Index = boost::container::
-                flat_map<ReadView, Completed::const_reverse_iterator>;
-
-            const std::size_t limit_;
-            Completed queue_;
-            Index index_;
-        };
-
         const api::Core& api_;
         const internal::Network& network_;
         const internal::BlockDatabase& db_;
@@ -30,12 +30,9 @@ namespace opentxs::blockchain::client::internal
 {
 IO::IO(const api::Core& api) noexcept
     : api_(api)
-    , lock_()
     , cb_(zmq::ListenCallback::Factory([this](auto& in) { callback(in); }))
     , socket_(
           api.ZeroMQ().RouterSocket(cb_, zmq::socket::Socket::Direction::Bind))
-    , next_buffer_(-1)
-    , buffers_()
     , context_()
     , work_(std::make_unique<boost::asio::io_context::work>(context_))
     , thread_pool_()
@@ -81,12 +78,6 @@ auto IO::callback(zmq::Message& in) noexcept -> void
     }
 }
 
-auto IO::clear_buffer(const int id) const noexcept -> void
-{
-    Lock lock(lock_);
-    buffers_.erase(id);
-}
-
 auto IO::Connect(
     const Space& id,
     const tcp::endpoint& endpoint,
@@ -102,45 +93,6 @@ auto IO::Connect(
     });
 }
 
-auto IO::get_buffer(const std::size_t bytes) const noexcept
-    -> std::pair<int, WritableView>
-{
-    Lock lock(lock_);
-    auto id = ++next_buffer_;
-    auto& buffer = buffers_[id];
-
-    return {id, writer(buffer)(bytes)};
-}
-
-auto IO::Receive(
-    const Space& id,
-    const OTZMQWorkType type,
-    const std::size_t bytes,
-    tcp::socket& socket) const noexcept -> void
-{
-    OT_ASSERT(0 < id.size());
-
-    auto space = get_buffer(bytes);
-    auto asioBuffer =
-        boost::asio::buffer(space.second.data(), space.second.size());
-    boost::asio::async_read(
-        socket,
-        asioBuffer,
-        [this, id, type, space{std::move(space)}](const auto& e, auto size) {
-            auto work = api_.ZeroMQ().TaggedReply(
-                reader(id), e ? OT_ZMQ_DISCONNECT_SIGNAL : type);
-
-            if (e) {
-                LogVerbose("asio receive error: ")(e.message()).Flush();
-            } else {
-                work->AddFrame(space.second);
-            }
-
-            socket_->Send(work);
-            clear_buffer(space.first);
-        });
-}
-
 auto IO::Shutdown() noexcept -> void
 {
     context_.stop();
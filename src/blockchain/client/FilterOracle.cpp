@@ -8,8 +8,12 @@
 #include "blockchain/client/FilterOracle.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <type_traits>
@@ -77,6 +81,20 @@ auto FilterOracle::ProcessThreadPool(const zmq::Message& in) noexcept -> void
         OT_FAIL;
     }
 
+    if (ReturnType::Work::scan_filters == body.at(0).as<ReturnType::Work>()) {
+        using Job = ReturnType::ScanJob::Pointer;
+
+        auto job = std::unique_ptr<Job>{
+            reinterpret_cast<Job*>(body.at(1).as<std::uintptr_t>())};
+
+        OT_ASSERT(job);
+        OT_ASSERT(*job);
+
+        (*job)->Run();
+
+        return;
+    }
+
     using Queue = ReturnType::BlockQueue;
 
     auto* p = reinterpret_cast<Queue*>(body.at(1).as<std::uintptr_t>());
@@ -400,14 +418,70 @@ auto FilterOracle::LoadFilterOrResetTip(
 
     if (output) { return output; }
 
-    auto work = MakeWork(Work::reset_filter_tip);
-    work->AddFrame(type);
-    work->AddFrame(position.first);
-    pipeline_->Push(work);
+    reset_filter_tip(type, position);
 
     return {};
 }
 
+auto FilterOracle::MatchFilters(
+    const filter::Type type,
+    const block::Height first,
+    const block::Height last,
+    const GCS::Targets& targets) const noexcept -> ScanResults
+{
+    using Pool = internal::ThreadPool;
+
+    if (last < first) { return {}; }
+
+    const auto blank = api_.Factory().Data();
+    auto blocks = std::vector<block::Position>{};
+    auto height{first};
+
+    for (auto& hash : header_.BestHashes(
+             first, blank, static_cast<std::size_t>(last - first + 1))) {
+        blocks.emplace_back(height++, std::move(hash));
+    }
+
+    if (blocks.empty()) { return {}; }
+
+    auto job =
+        std::make_shared<ScanJob>(database_, type, std::move(blocks), targets);
+    const auto helpers =
+        std::min(std::max(Pool::Capacity(), std::size_t{1}), job->Chunks()) -
+        1u;
+
+    for (auto i = std::size_t{0}; i < helpers; ++i) {
+        auto pointer = std::make_unique<ScanJob::Pointer>(job);
+        auto work = Pool::MakeWork(api_, chain_, Pool::Work::FilterOracle);
+        work->AddFrame(Work::scan_filters);
+        work->AddFrame(reinterpret_cast<std::uintptr_t>(pointer.get()));
+
+        // The calling thread scans any chunks the pool does not claim
+        if (false == thread_pool().Send(work)) { break; }
+
+        // Now owned by the thread pool job
+        pointer.release();
+    }
+
+    job->Run();
+    job->Wait();
+
+    if (job->Failed()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to read filters").Flush();
+    }
+
+    const auto missing = job->Missing();
+
+    if (missing.has_value()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Filter at height ")(
+            missing.value().first)(" not found ")
+            .Flush();
+        reset_filter_tip(type, missing.value());
+    }
+
+    return job->Results();
+}
+
 auto FilterOracle::notify_new_filter(
     const filter::Type type,
     const block::Position& position) const noexcept -> void
@@ -483,11 +557,10 @@ auto FilterOracle::PreviousHeader(
     const filter::Type type,
     const block::Height& block) const noexcept -> Header
 {
-    static const auto blank = api_.Factory().Data(
-        "0x0000000000000000000000000000000000000000000000000000000000000000",
-        StringStyle::Hex);
-
-    if (0 == block) { return blank; }
+    if (0 == block) {
+        return api_.Factory().Data(
+            "0x" + std::string(64, '0'), StringStyle::Hex);
+    }
 
     const auto hash = header_.BestHash(block - 1u);
 
@@ -874,6 +947,16 @@ auto FilterOracle::process_reset_filter_tip(const zmq::Message& in) noexcept
     reset_tips_to(type, block::Position{parent, hash}, false, true);
 }
 
+auto FilterOracle::reset_filter_tip(
+    const filter::Type type,
+    const block::Position& position) const noexcept -> void
+{
+    auto work = MakeWork(Work::reset_filter_tip);
+    work->AddFrame(type);
+    work->AddFrame(position.first);
+    pipeline_->Push(work);
+}
+
 auto FilterOracle::reset_tips_to(
     const filter::Type type,
     const block::Position& position,
@@ -8,6 +8,8 @@
 #include <boost/circular_buffer.hpp>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <future>
 #include <iosfwd>
@@ -117,6 +119,11 @@ public:
         const filter::Type type,
         const block::Position& position) const noexcept
         -> std::unique_ptr<const GCS> final;
+    auto MatchFilters(
+        const filter::Type type,
+        const block::Height first,
+        const block::Height last,
+        const GCS::Targets& targets) const noexcept -> ScanResults final;
     auto PreviousHeader(const filter::Type type, const block::Height& block)
         const noexcept -> Header final;
     auto ProcessBlock(const block::bitcoin::Block& block) const noexcept
@@ -149,6 +156,7 @@ private:
         reset_filter_tip = OT_ZMQ_INTERNAL_SIGNAL + 2,
         index_block = OT_ZMQ_INTERNAL_SIGNAL + 3,
         calculate_headers = OT_ZMQ_INTERNAL_SIGNAL + 4,
+        scan_filters = OT_ZMQ_INTERNAL_SIGNAL + 5,
         peer = value(WorkType::BlockchainPeerAdded),
         block = value(WorkType::BlockchainNewHeader),
         reorg = value(WorkType::BlockchainReorg),
@@ -357,6 +365,63 @@ private:
         mutable std::map<block::pHash, Time> hashes_;
     };
 
+    // Shared state for a filter scan which is divided among the caller and
+    // the blockchain thread pool. Each thread pool job holds a Pointer so the
+    // state outlives jobs which start after the caller has returned.
+    struct ScanJob {
+        using Pointer = std::shared_ptr<ScanJob>;
+
+        static constexpr auto batch_size_ = std::size_t{250};
+
+        auto Chunks() const noexcept -> std::size_t { return chunks_; }
+        /// True if the filter database could not be read
+        auto Failed() const noexcept -> bool
+        {
+            return failed_.load() < blocks_.size();
+        }
+        auto Missing() const noexcept -> std::optional<block::Position>;
+        auto Results() const noexcept -> ScanResults;
+
+        auto Run() noexcept -> void;
+        auto Wait() noexcept -> void { done_.get(); }
+
+        ScanJob(
+            const internal::FilterDatabase& db,
+            const filter::Type type,
+            std::vector<block::Position>&& blocks,
+            const GCS::Targets& targets) noexcept;
+
+    private:
+        const internal::FilterDatabase& db_;
+        const filter::Type type_;
+        const std::vector<block::Position> blocks_;
+        // Thread pool jobs may outlive the caller's targets
+        const std::vector<Space> target_bytes_;
+        const GCS::Targets targets_;
+        const std::size_t chunks_;
+        std::vector<std::uint8_t> matches_;
+        std::atomic<std::size_t> next_;
+        std::atomic<std::size_t> finished_;
+        // Index of the first block whose filter was not found
+        std::atomic<std::size_t> missing_;
+        // Index of the first block whose filter could not be read
+        std::atomic<std::size_t> failed_;
+        std::promise<void> promise_;
+        std::shared_future<void> done_;
+
+        static auto set_first(
+            std::atomic<std::size_t>& first,
+            const std::size_t index) noexcept -> void;
+
+        auto run(const std::size_t chunk) noexcept -> void;
+
+        ScanJob() = delete;
+        ScanJob(const ScanJob&) = delete;
+        ScanJob(ScanJob&&) = delete;
+        auto operator=(const ScanJob&) -> ScanJob& = delete;
+        auto operator=(ScanJob&&) -> ScanJob& = delete;
+    };
+
     using FilterHeaderHex = std::string;
     using FilterHeaderMap = std::map<filter::Type, FilterHeaderHex>;
     using ChainMap = std::map<block::Height, FilterHeaderMap>;
@@ -383,6 +448,9 @@ private:
         const block::Position& position) const noexcept -> void;
     auto oldest_checkpoint_before(const block::Height height) const noexcept
         -> block::Height;
+    auto reset_filter_tip(
+        const filter::Type type,
+        const block::Position& position) const noexcept -> void;
     auto thread_pool() const noexcept -> const zmq::socket::Push&
     {
         return thread_pool_.get();
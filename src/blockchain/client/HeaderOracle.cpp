@@ -338,31 +338,7 @@ auto HeaderOracle::best_hashes(
     const block::Hash& stop,
     const std::size_t limit) const noexcept -> Hashes
 {
-    auto output = Hashes{};
-    const auto limitIsZero = (0 == limit);
-    auto current{start};
-    const auto last{
-        current + static_cast<block::Height>(limit) -
-        static_cast<block::Height>(1)};
-
-    while (limitIsZero || (current <= last)) {
-        try {
-            auto hash = database_.BestBlock(current++);
-
-            // TODO this check shouldn't be necessary but BestBlock doesn't
-            // throw the exception documented in its declaration.
-            if (hash->empty()) { break; }
-
-            const auto stopHere = stop.empty() ? false : (stop == hash);
-            output.emplace_back(std::move(hash));
-
-            if (stopHere) { break; }
-        } catch (...) {
-            break;
-        }
-    }
-
-    return output;
+    return database_.BestBlocks(start, stop, limit);
 }
 
 auto HeaderOracle::CalculateReorg(const block::Position tip) const
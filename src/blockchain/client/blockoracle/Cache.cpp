@@ -29,7 +29,6 @@
 
 namespace opentxs::blockchain::client::implementation
 {
-const std::size_t BlockOracle::Cache::cache_limit_{16};
 const std::chrono::seconds BlockOracle::Cache::download_timeout_{60};
 
 BlockOracle::Cache::Cache(
@@ -43,7 +42,7 @@ BlockOracle::Cache::Cache(
     , chain_(chain)
     , lock_()
     , pending_()
-    , mem_(cache_limit_)
+    , mem_(db.BlockCacheLimit())
     , running_(true)
 {
 }
@@ -84,9 +83,10 @@ auto BlockOracle::Cache::ReceiveBlock(const zmq::Frame& in) const noexcept
     }
 
     auto& [time, promise, future, queued] = pending->second;
+    const auto bytes = Mem::EstimateSize(block);
     promise.set_value(std::move(pBlock));
     LogVerbose(OT_METHOD)(__FUNCTION__)(": Cached block ")(id.asHex()).Flush();
-    mem_.push(std::move(id), std::move(future));
+    mem_.push(std::move(id), std::move(future), bytes);
     pending_.erase(pending);
 }
 
@@ -141,10 +141,12 @@ auto BlockOracle::Cache::Request(const BlockHashes& hashes) const noexcept
         if (found) { continue; }
 
         if (auto pBlock = db_.BlockLoadBitcoin(block); bool(pBlock)) {
+            const auto bytes = Mem::EstimateSize(*pBlock);
             auto promise = Promise{};
             promise.set_value(std::move(pBlock));
-            mem_.push(OTData{block}, promise.get_future());
-            output.emplace_back(mem_.find(block->Bytes()));
+            auto future = BitcoinBlockFuture{promise.get_future()};
+            mem_.push(OTData{block}, future, bytes);
+            output.emplace_back(std::move(future));
             found = true;
         }
 
@@ -189,6 +191,10 @@ auto BlockOracle::Cache::Shutdown() noexcept -> void
 
     if (running_) {
         running_ = false;
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": Block cache hits: ")(
+            mem_.hits())(", misses: ")(mem_.misses())(", bytes in use: ")(
+            mem_.bytes())
+            .Flush();
         mem_.clear();
 
         for (auto& [hash, item] : pending_) {
@@ -206,6 +212,10 @@ auto BlockOracle::Cache::StateMachine() const noexcept -> bool
 
     if (false == running_) { return false; }
 
+    LogTrace(OT_METHOD)(__FUNCTION__)(": Block cache hits: ")(mem_.hits())(
+        ", misses: ")(mem_.misses())(", bytes in use: ")(mem_.bytes())
+        .Flush();
+
     for (auto& [hash, item] : pending_) {
         auto& [time, promise, future, queued] = item;
         const auto now = Clock::now();
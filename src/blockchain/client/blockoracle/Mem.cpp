@@ -7,57 +7,100 @@
 #include "1_Internal.hpp"                     // IWYU pragma: associated
 #include "blockchain/client/BlockOracle.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <iterator>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Pimpl.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Inputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Outputs.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/blockchain/client/BlockOracle.hpp"
 
 // #define OT_METHOD
-// "opentxs::blockchain::client::implementation::BlockOracle::Cache::Mem::"
+// "opentxs::blockchain::client::implementation::BlockOracle::Mem::"
 
 namespace opentxs::blockchain::client::implementation
 {
-BlockOracle::Cache::Mem::Mem(const std::size_t limit) noexcept
+BlockOracle::Mem::Mem(const std::size_t limit) noexcept
     : limit_(limit)
     , queue_()
     , index_()
+    , bytes_(0)
+    , hits_(0)
+    , misses_(0)
 {
 }
 
-auto BlockOracle::Cache::Mem::clear() noexcept -> void
+auto BlockOracle::Mem::EstimateSize(
+    const block::bitcoin::Block& block) noexcept -> std::size_t
+{
+    auto output = block.CalculateSize();
+
+    for (const auto& tx : block) {
+        output += transaction_overhead_;
+
+        if (false == bool(tx)) { continue; }
+
+        output += tx->Inputs().size() * input_overhead_;
+        output += tx->Outputs().size() * output_overhead_;
+    }
+
+    return output;
+}
+
+auto BlockOracle::Mem::clear() noexcept -> void
 {
     index_.clear();
     queue_.clear();
+    bytes_ = 0;
 }
 
-auto BlockOracle::Cache::Mem::find(const ReadView& id) const noexcept
+auto BlockOracle::Mem::erase(const Completed::iterator it) noexcept
+    -> void
+{
+    index_.erase(it->id_->Bytes());
+    bytes_ -= it->bytes_;
+    queue_.erase(it);
+}
+
+auto BlockOracle::Mem::find(const ReadView& id) noexcept
     -> BitcoinBlockFuture
 {
     if ((nullptr == id.data()) || (0 == id.size())) { return {}; }
 
-    try {
+    auto it = index_.find(id);
 
-        return index_.at(id)->second;
-    } catch (...) {
+    if (index_.end() == it) {
+        ++misses_;
 
         return {};
     }
+
+    ++hits_;
+    queue_.splice(queue_.begin(), queue_, it->second);
+
+    return it->second->future_;
 }
 
-auto BlockOracle::Cache::Mem::push(
+auto BlockOracle::Mem::push(
     block::pHash&& id,
-    BitcoinBlockFuture&& future) noexcept -> void
+    BitcoinBlockFuture future,
+    const std::size_t bytes) noexcept -> void
 {
     if (0 == id->size()) { return; }
 
-    const auto& item = queue_.emplace_back(std::move(id), std::move(future));
-    index_[item.first->Bytes()] = queue_.crbegin();
-
-    while (queue_.size() > limit_) {
-        const auto& item = queue_.front();
-        index_.erase(item.first->Bytes());
-        queue_.pop_front();
+    if (auto it = index_.find(id->Bytes()); index_.end() != it) {
+        erase(it->second);
     }
+
+    if (bytes > limit_) { return; }
+
+    auto& item = queue_.emplace_front(Item{std::move(id), future, bytes});
+    index_.emplace(item.id_->Bytes(), queue_.begin());
+    bytes_ += bytes;
+
+    while (bytes_ > limit_) { erase(std::prev(queue_.end())); }
 }
 }  // namespace opentxs::blockchain::client::implementation
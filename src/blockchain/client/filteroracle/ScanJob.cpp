@@ -0,0 +1,153 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                        // IWYU pragma: associated
+#include "1_Internal.hpp"                      // IWYU pragma: associated
+#include "blockchain/client/FilterOracle.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "internal/blockchain/Blockchain.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/blockchain/client/FilterOracle.hpp"
+
+// #define OT_METHOD
+// "opentxs::blockchain::client::implementation::FilterOracle::ScanJob::"
+
+namespace opentxs::blockchain::client::implementation
+{
+namespace
+{
+auto copy(const GCS::Targets& targets) noexcept -> std::vector<Space>
+{
+    auto output = std::vector<Space>{};
+    output.reserve(targets.size());
+
+    for (const auto& target : targets) { output.emplace_back(space(target)); }
+
+    return output;
+}
+
+auto view(const std::vector<Space>& targets) noexcept -> GCS::Targets
+{
+    auto output = GCS::Targets{};
+    output.reserve(targets.size());
+
+    for (const auto& target : targets) { output.emplace_back(reader(target)); }
+
+    return output;
+}
+}  // namespace
+
+FilterOracle::ScanJob::ScanJob(
+    const internal::FilterDatabase& db,
+    const filter::Type type,
+    std::vector<block::Position>&& blocks,
+    const GCS::Targets& targets) noexcept
+    : db_(db)
+    , type_(type)
+    , blocks_(std::move(blocks))
+    , target_bytes_(copy(targets))
+    , targets_(view(target_bytes_))
+    , chunks_((blocks_.size() + batch_size_ - 1u) / batch_size_)
+    , matches_(blocks_.size(), 0u)
+    , next_(0)
+    , finished_(0)
+    , missing_(blocks_.size())
+    , failed_(blocks_.size())
+    , promise_()
+    , done_(promise_.get_future())
+{
+    if (0u == chunks_) { promise_.set_value(); }
+}
+
+auto FilterOracle::ScanJob::Missing() const noexcept
+    -> std::optional<block::Position>
+{
+    const auto index = missing_.load();
+
+    // A missing filter past a read failure may not really be missing
+    if (index < failed_.load()) { return blocks_.at(index); }
+
+    return std::nullopt;
+}
+
+auto FilterOracle::ScanJob::Results() const noexcept -> ScanResults
+{
+    auto output = ScanResults{};
+    auto& [matches, last] = output;
+    const auto stop = std::min(missing_.load(), failed_.load());
+
+    for (auto i = std::size_t{0}; i < stop; ++i) {
+        if (0u != matches_.at(i)) { matches.emplace_back(blocks_.at(i)); }
+    }
+
+    if (0u < stop) { last = blocks_.at(stop - 1u); }
+
+    return output;
+}
+
+auto FilterOracle::ScanJob::Run() noexcept -> void
+{
+    for (auto chunk = next_++; chunk < chunks_; chunk = next_++) {
+        run(chunk);
+    }
+}
+
+auto FilterOracle::ScanJob::run(const std::size_t chunk) noexcept -> void
+{
+    const auto start = chunk * batch_size_;
+    const auto stop = std::min(start + batch_size_, blocks_.size());
+
+    // Chunks past a missing or unreadable filter will be discarded so don't
+    // load them
+    if (start < std::min(missing_.load(), failed_.load())) {
+        auto hashes = std::vector<block::pHash>{};
+        hashes.reserve(stop - start);
+
+        for (auto i{start}; i < stop; ++i) {
+            hashes.emplace_back(blocks_.at(i).second);
+        }
+
+        const auto read = db_.ReadFilters(
+            type_,
+            hashes,
+            [&](const auto index, const auto* filter) -> bool {
+                const auto i = start + index;
+
+                if (nullptr == filter) {
+                    set_first(missing_, i);
+
+                    return true;
+                }
+
+                const auto matches = filter->Match(targets_);
+                matches_.at(i) = matches.empty() ? 0u : 1u;
+
+                return true;
+            });
+
+        if (false == read) { set_first(failed_, start); }
+    }
+
+    if (chunks_ == ++finished_) { promise_.set_value(); }
+}
+
+auto FilterOracle::ScanJob::set_first(
+    std::atomic<std::size_t>& first,
+    const std::size_t index) noexcept -> void
+{
+    auto current = first.load();
+
+    while (index < current) {
+        if (first.compare_exchange_weak(current, index)) { break; }
+    }
+}
+}  // namespace opentxs::blockchain::client::implementation
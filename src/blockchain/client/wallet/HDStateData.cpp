@@ -13,6 +13,7 @@
 #include <future>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <string_view>
@@ -271,6 +272,7 @@ auto HDStateData::process() noexcept -> void
         node_.ID(), subchain_, filter_type_, tested, blockHash.Bytes());
 
     if (0 < confirmed.size()) {
+        db_.BlockPin(blockHash);
         // Re-scan the last 1000 blocks
         const auto height = std::max(header.Height() - 1000, block::Height{0});
         last_scanned_ = block::Position{height, oracle.BestHash(height)};
@@ -331,60 +333,59 @@ auto HDStateData::scan() noexcept -> void
 
     const auto elements = db_.GetPatterns(node_.ID(), subchain_, filter_type_);
     const auto utxos = db_.GetUnspentOutputs();
-    auto highestTested =
-        last_scanned_.value_or(make_blank<block::Position>::value(api_));
-    auto atLeastOnce{false};
-
-    for (auto i{startHeight}; i <= stopHeight; ++i) {
-        auto blockHash = headers.BestHash(i);
+    const auto patterns = get_targets(elements, utxos);
+    const auto [matches, highestTested] =
+        filters.MatchFilters(filter_type_, startHeight, stopHeight, patterns);
+    auto tested = highestTested;
+
+    for (const auto& [height, blockHash] : matches) {
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": GCS for block ")(
+            blockHash->asHex())(" at height ")(height)(
+            " matches at least one of the ")(patterns.size())(
+            " target elements for this subchain")
+            .Flush();
         const auto pFilter = filters.LoadFilterOrResetTip(
-            filter_type_, block::Position{i, blockHash});
+            filter_type_, block::Position{height, blockHash});
 
+        // Skipping the block would lose any match in it, so end the scan
+        // before it and test it again on the next pass
         if (false == bool(pFilter)) {
-            LogOutput(OT_METHOD)(__FUNCTION__)(": Filter at height ")(i)(
-                " not found ")
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Failed to reload filter for block ")(blockHash->asHex())(
+                " at height ")(height)(
+                ". Scanning will resume from this block.")
                 .Flush();
 
+            if (startHeight < height) {
+                const auto previous = height - 1;
+                tested = block::Position{previous, headers.BestHash(previous)};
+            } else {
+                tested = std::nullopt;
+            }
+
             break;
         }
 
-        atLeastOnce = true;
-        highestTested.first = i;
-        highestTested.second = blockHash;
-        const auto& filter = *pFilter;
-        auto patterns = get_targets(elements, utxos);
-        auto matches = filter.Match(patterns);
-        const auto size{matches.size()};
-
-        if (0 < matches.size()) {
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": GCS for block ")(
-                blockHash->asHex())(" at height ")(i)(
-                " matches at least one of the ")(patterns.size())(
-                " target elements for this subchain")
-                .Flush();
-            const auto retest = db_.GetUntestedPatterns(
-                node_.ID(), subchain_, filter_type_, blockHash->Bytes());
-            patterns = get_targets(retest, utxos);
-            matches = filter.Match(patterns);
-            LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(matches.size())(" of ")(
-                size)(" matches are new")
-                .Flush();
+        const auto retest = db_.GetUntestedPatterns(
+            node_.ID(), subchain_, filter_type_, blockHash->Bytes());
+        const auto untested = get_targets(retest, utxos);
+        const auto newMatches = pFilter->Match(untested).size();
+        LogVerbose(OT_METHOD)(__FUNCTION__)(": ")(newMatches)(
+            " of the untested elements match")
+            .Flush();
 
-            if (0 < matches.size()) {
-                blocks_to_request_.emplace_back(std::move(blockHash));
-            }
-        }
+        if (0 < newMatches) { blocks_to_request_.emplace_back(blockHash); }
     }
 
-    if (atLeastOnce) {
+    if (tested.has_value()) {
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Found ")(
             blocks_to_request_.size())(" potential matches between blocks ")(
-            startHeight)(" and ")(highestTested.first)(" in ")(
+            startHeight)(" and ")(tested.value().first)(" in ")(
             std::chrono::duration_cast<std::chrono::milliseconds>(
                 Clock::now() - start)
                 .count())(" milliseconds")
             .Flush();
-        last_scanned_ = std::move(highestTested);
+        last_scanned_ = tested.value();
     } else {
         LogVerbose(OT_METHOD)(__FUNCTION__)(
             ": Scan interrupted due to missing filter")
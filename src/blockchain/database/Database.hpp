@@ -167,6 +167,18 @@ public:
     {
         return headers_.BestBlock(position);
     }
+    auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept
+        -> std::vector<block::pHash> final
+    {
+        return headers_.BestBlocks(start, stop, limit);
+    }
+    auto BlockCacheLimit() const noexcept -> std::size_t final
+    {
+        return common_.BlockCacheLimit();
+    }
     auto BlockExists(const block::Hash& block) const noexcept -> bool final
     {
         return common_.BlockExists(block);
@@ -176,6 +188,10 @@ public:
     {
         return blocks_.LoadBitcoin(block);
     }
+    auto BlockPin(const block::Hash& block) const noexcept -> bool final
+    {
+        return common_.BlockPin(block);
+    }
     auto BlockPolicy() const noexcept
         -> api::client::blockchain::BlockStorage final
     {
@@ -298,6 +314,13 @@ public:
     {
         return filters_.LoadFilter(type, block);
     }
+    auto ReadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks,
+        const FilterReader cb) const noexcept -> bool final
+    {
+        return filters_.ReadFilters(type, blocks, cb);
+    }
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash final
     {
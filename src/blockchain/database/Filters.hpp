@@ -89,6 +89,14 @@ public:
     {
         return common_.LoadFilter(type, block);
     }
+    auto ReadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks,
+        const client::internal::FilterDatabase::FilterReader cb) const noexcept
+        -> bool
+    {
+        return common_.ReadFilters(type, blocks, cb);
+    }
     auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash;
     auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -8,13 +8,16 @@
 #include "blockchain/database/Headers.hpp"  // IWYU pragma: associated
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "blockchain/client/UpdateTransaction.hpp"
 #include "core/Worker.hpp"
@@ -43,6 +46,28 @@
 
 namespace opentxs::blockchain::database
 {
+namespace
+{
+using LMDB = opentxs::storage::lmdb::LMDB;
+
+// Returns nullptr if no snapshot is available, in which case each read uses a
+// transaction of its own
+auto read_snapshot(
+    const LMDB& db,
+    std::optional<LMDB::Transaction>& snapshot) noexcept -> MDB_txn*
+{
+    try {
+        snapshot.emplace(db);
+
+        return snapshot.value();
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return nullptr;
+    }
+}
+}  // namespace
+
 template <typename Input>
 auto tsv(const Input& in) noexcept -> ReadView
 {
@@ -272,6 +297,43 @@ auto Headers::BestBlock(const block::Height position) const noexcept(false)
     return output;
 }
 
+auto Headers::BestBlocks(
+    const block::Height start,
+    const block::Hash& stop,
+    const std::size_t limit) const noexcept -> std::vector<block::pHash>
+{
+    auto output = std::vector<block::pHash>{};
+
+    if (0 > start) { return output; }
+
+    const auto first = static_cast<std::size_t>(start);
+    auto expected{first};
+    lmdb_.ReadRange(
+        BlockHeaderBest,
+        tsv(first),
+        std::nullopt,
+        [&](const auto key, const auto value) -> bool {
+            auto height = std::size_t{};
+
+            if (sizeof(height) != key.size()) { return false; }
+
+            std::memcpy(&height, key.data(), sizeof(height));
+
+            // The best chain must not have gaps
+            if (expected != height) { return false; }
+
+            ++expected;
+            auto& hash =
+                output.emplace_back(Data::Factory(value.data(), value.size()));
+
+            return (false == stop.empty()) ? (stop != hash) : true;
+        },
+        opentxs::storage::lmdb::LMDB::Dir::Forward,
+        limit);
+
+    return output;
+}
+
 auto Headers::best() const noexcept -> block::Position
 {
     Lock lock(lock_);
@@ -283,6 +345,9 @@ auto Headers::best(const Lock& lock) const noexcept -> block::Position
 {
     auto output = make_blank<block::Position>::value(api_);
     auto height = std::size_t{0};
+    // Both keys should be read from the same snapshot
+    auto txn = std::optional<LMDB::Transaction>{};
+    auto* snapshot = read_snapshot(lmdb_, txn);
 
     if (false ==
         lmdb_.Load(
@@ -291,15 +356,22 @@ auto Headers::best(const Lock& lock) const noexcept -> block::Position
             [&](const auto in) -> void {
                 std::memcpy(
                     &height, in.data(), std::min(in.size(), sizeof(height)));
-            })) {
+            },
+            opentxs::storage::lmdb::LMDB::Mode::One,
+            snapshot)) {
 
         return make_blank<block::Position>::value(api_);
     }
 
     if (false ==
-        lmdb_.Load(BlockHeaderBest, tsv(height), [&](const auto in) -> void {
-            output.second->Assign(in.data(), in.size());
-        })) {
+        lmdb_.Load(
+            BlockHeaderBest,
+            tsv(height),
+            [&](const auto in) -> void {
+                output.second->Assign(in.data(), in.size());
+            },
+            opentxs::storage::lmdb::LMDB::Mode::One,
+            snapshot)) {
 
         return make_blank<block::Position>::value(api_);
     }
@@ -313,6 +385,9 @@ auto Headers::checkpoint(const Lock& lock) const noexcept -> block::Position
 {
     auto output = make_blank<block::Position>::value(api_);
     auto height = std::size_t{0};
+    // Both keys should be read from the same snapshot
+    auto txn = std::optional<LMDB::Transaction>{};
+    auto* snapshot = read_snapshot(lmdb_, txn);
 
     if (false ==
         lmdb_.Load(
@@ -321,7 +396,9 @@ auto Headers::checkpoint(const Lock& lock) const noexcept -> block::Position
             [&](const auto in) -> void {
                 std::memcpy(
                     &height, in.data(), std::min(in.size(), sizeof(height)));
-            })) {
+            },
+            opentxs::storage::lmdb::LMDB::Mode::One,
+            snapshot)) {
         return make_blank<block::Position>::value(api_);
     }
 
@@ -330,7 +407,9 @@ auto Headers::checkpoint(const Lock& lock) const noexcept -> block::Position
                      tsv(static_cast<std::size_t>(Key::CheckpointHash)),
                      [&](const auto in) -> void {
                          output.second->Assign(in.data(), in.size());
-                     })) {
+                     },
+                     opentxs::storage::lmdb::LMDB::Mode::One,
+                     snapshot)) {
 
         return make_blank<block::Position>::value(api_);
     }
@@ -546,14 +625,17 @@ auto Headers::recent_hashes(const Lock& lock) const noexcept
     -> std::vector<block::pHash>
 {
     auto output = std::vector<block::pHash>{};
-    lmdb_.Read(
+    lmdb_.ReadRange(
         BlockHeaderBest,
+        {},
+        std::nullopt,
         [&](const auto, const auto value) -> bool {
             output.emplace_back(Data::Factory(value.data(), value.size()));
 
-            return 100 > output.size();
+            return true;
         },
-        opentxs::storage::lmdb::LMDB::Dir::Backward);
+        opentxs::storage::lmdb::LMDB::Dir::Backward,
+        100);
 
     return output;
 }
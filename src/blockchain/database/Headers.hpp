@@ -70,6 +70,10 @@ public:
 
     auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash;
+    auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> std::vector<block::pHash>;
     auto CurrentBest() const noexcept -> std::unique_ptr<block::Header>
     {
         return load_header(best().second);
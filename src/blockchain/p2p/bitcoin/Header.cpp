@@ -107,6 +107,11 @@ Header::BitcoinFormat::BitcoinFormat(const zmq::Frame& in) noexcept(false)
 {
 }
 
+Header::BitcoinFormat::BitcoinFormat(const ReadView in) noexcept(false)
+    : BitcoinFormat(in.data(), in.size())
+{
+}
+
 auto Header::BitcoinFormat::Checksum() const noexcept -> OTData
 {
     return Data::Factory(checksum_.data(), checksum_.size());
@@ -13,6 +13,7 @@
 #include <tuple>
 
 #include "internal/blockchain/p2p/bitcoin/Bitcoin.hpp"
+#include "opentxs/Bytes.hpp"
 #include "opentxs/Forward.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
@@ -59,6 +60,7 @@ public:
 
         BitcoinFormat(const Data& in) noexcept(false);
         BitcoinFormat(const zmq::Frame& in) noexcept(false);
+        BitcoinFormat(const ReadView in) noexcept(false);
         BitcoinFormat(
             const blockchain::Type network,
             const bitcoin::Command command,
@@ -228,7 +228,7 @@ auto Peer::broadcast_transaction(zmq::Message& in) noexcept -> void
     send(msg.Encode());
 }
 
-auto Peer::get_body_size(const zmq::Frame& header) const noexcept -> std::size_t
+auto Peer::get_body_size(const ReadView header) const noexcept -> std::size_t
 {
     OT_ASSERT(HeaderType::Size() == header.size());
 
@@ -135,7 +135,7 @@ private:
         const std::set<p2p::Service>& input) noexcept -> std::set<p2p::Service>;
     static auto nonce(const api::Core& api) noexcept -> Nonce;
 
-    auto get_body_size(const zmq::Frame& header) const noexcept
+    auto get_body_size(const ReadView header) const noexcept
         -> std::size_t final;
 
     auto broadcast_block(zmq::Message& message) noexcept -> void final;
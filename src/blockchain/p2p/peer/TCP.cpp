@@ -10,6 +10,8 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 
 #include "opentxs/Pimpl.hpp"
@@ -33,6 +35,50 @@
 namespace opentxs::blockchain::p2p::implementation
 {
 struct TCPConnectionManager final : public Peer::ConnectionManager {
+    // Incoming messages are read straight from the socket into a buffer
+    // which is reused for every message. Pending asio handlers share this
+    // state and may outlive the connection manager, so they must check
+    // active_ before doing anything else.
+    struct Incoming {
+        // Buffer sizes are rounded up to a power of two no smaller than this
+        static constexpr auto min_buffer_ = std::size_t{4096};
+        // Buffers larger than this are released once they go unused by
+        // idle_limit_ consecutive messages
+        static constexpr auto max_idle_buffer_ = std::size_t{1048576};
+        static constexpr auto idle_limit_ = std::size_t{32};
+
+        std::mutex lock_{};
+        bool active_{true};
+        Space buffer_{};
+        std::size_t idle_{0};
+
+        auto finish(const std::size_t used) noexcept -> void
+        {
+            if (max_idle_buffer_ >= buffer_.size()) { return; }
+
+            if (max_idle_buffer_ < used) {
+                idle_ = 0;
+
+                return;
+            }
+
+            if (idle_limit_ > ++idle_) { return; }
+
+            Space{}.swap(buffer_);
+            idle_ = 0;
+        }
+        auto reserve(const std::size_t bytes) noexcept -> void
+        {
+            if (buffer_.size() >= bytes) { return; }
+
+            auto target{min_buffer_};
+
+            while (target < bytes) { target <<= 1; }
+
+            buffer_.resize(target);
+        }
+    };
+
     const api::Core& api_;
     Peer& parent_;
     const Flag& running_;
@@ -42,7 +88,7 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
     const std::size_t header_bytes_;
     std::promise<void> connection_id_promise_;
     tcp::socket socket_;
-    OTData header_;
+    std::shared_ptr<Incoming> incoming_;
     OTZMQListenCallback cb_;
     OTZMQDealerSocket dealer_;
 
@@ -80,13 +126,6 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
 
         return ip::tcp::endpoint{output, port};
     }
-    static auto make_buffer(const std::size_t size) noexcept -> OTData
-    {
-        auto output = Data::Factory();
-        output->SetSize(size);
-
-        return output;
-    }
 
     auto address() const noexcept -> std::string final
     {
@@ -181,50 +220,108 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
             case Peer::Task::Disconnect: {
                 parent_.on_pipeline(Peer::Task::Disconnect, {});
             } break;
-            case Peer::Task::Header: {
-                OT_ASSERT(1 < body.size());
-
-                const auto& messageHeader = body.at(1);
-                const auto size = parent_.get_body_size(messageHeader);
-
-                if (0 < size) {
-                    header_->Assign(messageHeader.Bytes());
-                    receive(static_cast<OTZMQWorkType>(Peer::Task::Body), size);
-                    parent_.on_pipeline(Peer::Task::Header, {});
-                } else {
-                    parent_.on_pipeline(
-                        Peer::Task::ReceiveMessage,
-                        {messageHeader.Bytes(), {}});
-                    run();
-                }
-            } break;
-            case Peer::Task::Body: {
-                OT_ASSERT(1 < body.size());
-
-                parent_.on_pipeline(
-                    Peer::Task::ReceiveMessage,
-                    {header_->Bytes(), body.at(1).Bytes()});
-                run();
-            } break;
             default: {
                 OT_FAIL;
             }
         }
     }
-    auto receive(const OTZMQWorkType type, const std::size_t bytes) noexcept
+    auto header_view() const noexcept -> ReadView
+    {
+        return {
+            reinterpret_cast<const char*>(incoming_->buffer_.data()),
+            header_bytes_};
+    }
+    auto receive_body(
+        const Lock& lock,
+        const boost::system::error_code& error,
+        const std::size_t size) noexcept -> void
+    {
+        if (error) {
+            receive_error(error);
+
+            return;
+        }
+
+        auto& in = *incoming_;
+        parent_.on_pipeline(
+            Peer::Task::ReceiveMessage,
+            {header_view(),
+             {reinterpret_cast<const char*>(in.buffer_.data()) +
+                  header_bytes_,
+              size}});
+        in.finish(header_bytes_ + size);
+        receive_header(lock);
+    }
+    auto receive_error(const boost::system::error_code& error) noexcept
         -> void
     {
-        context_.Receive(connection_id_, type, bytes, socket_);
+        LogVerbose("asio receive error: ")(error.message()).Flush();
+        parent_.on_pipeline(Peer::Task::Disconnect, {});
     }
-    auto run() noexcept -> void
+    auto receive_header(const Lock&) noexcept -> void
     {
-        if (running_) {
-            receive(
-                static_cast<OTZMQWorkType>(Peer::Task::Header), header_bytes_);
+        auto& in = *incoming_;
+
+        if ((false == running_) || (false == in.active_)) { return; }
+
+        in.reserve(header_bytes_);
+        asio::async_read(
+            socket_,
+            asio::buffer(in.buffer_.data(), header_bytes_),
+            [this, incoming{incoming_}](const auto& error, auto) {
+                auto lock = Lock{incoming->lock_};
+
+                if (false == incoming->active_) { return; }
+
+                this->receive_header(lock, error);
+            });
+    }
+    auto receive_header(
+        const Lock& lock,
+        const boost::system::error_code& error) noexcept -> void
+    {
+        if (error) {
+            receive_error(error);
+
+            return;
+        }
+
+        auto& in = *incoming_;
+        const auto size = parent_.get_body_size(header_view());
+
+        if (0 == size) {
+            parent_.on_pipeline(
+                Peer::Task::ReceiveMessage, {header_view(), {}});
+            in.finish(header_bytes_);
+            receive_header(lock);
+
+            return;
         }
+
+        // The body is read in place after the header so both can be passed
+        // on without copying them out of the receive buffer first
+        in.reserve(header_bytes_ + size);
+        asio::async_read(
+            socket_,
+            asio::buffer(in.buffer_.data() + header_bytes_, size),
+            [this, incoming{incoming_}, size](const auto& error, auto) {
+                auto lock = Lock{incoming->lock_};
+
+                if (false == incoming->active_) { return; }
+
+                this->receive_body(lock, error, size);
+            });
+        parent_.on_pipeline(Peer::Task::Header, {});
+    }
+    auto run() noexcept -> void
+    {
+        auto lock = Lock{incoming_->lock_};
+        receive_header(lock);
     }
     auto shutdown_external() noexcept -> void final
     {
+        auto lock = Lock{incoming_->lock_};
+
         try {
             socket_.close();
         } catch (...) {
@@ -232,6 +329,8 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
     }
     auto stop_external() noexcept -> void final
     {
+        auto lock = Lock{incoming_->lock_};
+
         try {
             socket_.shutdown(tcp::socket::shutdown_both);
         } catch (...) {
@@ -242,13 +341,19 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
         const zmq::Frame& data,
         std::shared_ptr<Peer::SendPromise> promise) noexcept -> void final
     {
-        auto work = [=, buf{asio::buffer(data.data(), data.size())}]() -> void {
+        auto work = [=,
+                     incoming{incoming_},
+                     buf{asio::buffer(data.data(), data.size())}]() -> void {
             auto cb = [=](auto& error, auto bytes) -> void {
                 try {
                     if (promise) { promise->set_value({error, bytes}); }
                 } catch (...) {
                 }
             };
+            auto lock = Lock{incoming->lock_};
+
+            if (false == incoming->active_) { return; }
+
             asio::async_write(socket_, buf, cb);
         };
 
@@ -273,7 +378,7 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
         , header_bytes_(headerSize)
         , connection_id_promise_()
         , socket_(context_.operator boost::asio::io_context&())
-        , header_(make_buffer(headerSize))
+        , incoming_(std::make_shared<Incoming>())
         , cb_(zmq::ListenCallback::Factory(
               [&](auto& in) { this->pipeline(in); }))
         , dealer_(api.ZeroMQ().DealerSocket(
@@ -285,6 +390,12 @@ struct TCPConnectionManager final : public Peer::ConnectionManager {
     ~TCPConnectionManager()
     {
         stop_internal();
+
+        {
+            auto lock = Lock{incoming_->lock_};
+            incoming_->active_ = false;
+        }
+
         stop_external();
         shutdown_external();
     }
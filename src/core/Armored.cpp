@@ -107,6 +107,9 @@ auto Factory::Armored(const crypto::Envelope& input) -> opentxs::Armored*
 
 namespace opentxs::implementation
 {
+std::atomic<std::int32_t> Armored::compression_level_{
+    OT_ARMOR_COMPRESSION_LEVEL};
+
 // initializes blank.
 Armored::Armored()
     : String()
@@ -182,7 +185,7 @@ auto Armored::clone() const -> Armored* { return new Armored(*this); }
  * the binary data. */
 auto Armored::compress_string(
     const std::string& str,
-    std::int32_t compressionlevel = Z_BEST_COMPRESSION) const -> std::string
+    std::int32_t compressionlevel) const -> std::string
 {
     z_stream zs;  // z_stream is zlib's control structure
     memset(&zs, 0, sizeof(zs));
@@ -516,6 +519,21 @@ auto Armored::SaveToExactPath(const std::string& filename) -> bool
     return SaveTo_ofstream(fout);
 }
 
+auto Armored::SetCompressionLevel(const std::int32_t level) noexcept -> bool
+{
+    if ((Z_DEFAULT_COMPRESSION > level) || (Z_BEST_COMPRESSION < level)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid compression level: ")(
+            level)(". Keeping ")(compression_level_.load())(".")
+            .Flush();
+
+        return false;
+    }
+
+    compression_level_.store(level);
+
+    return true;
+}
+
 // Compress and Base64-encode
 auto Armored::SetString(
     const opentxs::String& strData,
@@ -525,7 +543,8 @@ auto Armored::SetString(
 
     if (strData.GetLength() < 1) return true;
 
-    std::string str_compressed = compress_string(strData.Get());
+    std::string str_compressed =
+        compress_string(strData.Get(), compression_level_.load());
 
     // "Success"
     if (str_compressed.size() == 0) {
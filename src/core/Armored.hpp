@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
@@ -13,6 +14,9 @@
 #include "String.hpp"
 #include "opentxs/core/Armored.hpp"
 
+// zlib level used when armoring, unless configured otherwise (Z_BEST_SPEED)
+#define OT_ARMOR_COMPRESSION_LEVEL 1
+
 namespace opentxs
 {
 namespace OTDB
@@ -35,6 +39,11 @@ namespace opentxs::implementation
 class Armored : virtual public opentxs::Armored, public String
 {
 public:
+    // Applies to everything armored afterwards by this process. Any level
+    // accepted by zlib is valid, from Z_DEFAULT_COMPRESSION to
+    // Z_BEST_COMPRESSION. Decoding does not depend on the level.
+    static auto SetCompressionLevel(const std::int32_t level) noexcept -> bool;
+
     auto GetData(Data& theData, bool bLineBreaks = true) const -> bool override;
     auto GetString(opentxs::String& theData, bool bLineBreaks = true) const
         -> bool override;
@@ -65,6 +74,7 @@ private:
     friend opentxs::Factory;
 
     static std::unique_ptr<OTDB::OTPacker> s_pPacker;
+    static std::atomic<std::int32_t> compression_level_;
 
     auto clone() const -> Armored* override;
     auto compress_string(const std::string& str, std::int32_t compressionlevel)
@@ -7,14 +7,22 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "opentxs/core/Ledger.hpp"  // IWYU pragma: associated
 
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <irrxml/irrXML.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "internal/api/Api.hpp"
 #include "opentxs/Shared.hpp"
@@ -43,10 +51,30 @@
 #include "opentxs/otx/consensus/Server.hpp"
 #include "opentxs/otx/consensus/TransactionStatement.hpp"
 
+// Upper bound on the number of threads used to load box receipts in bulk, for
+// the whole process
+#define OT_BOX_RECEIPT_LOAD_THREADS 8
+// Boxes with fewer abbreviated receipts per thread than this are loaded
+// serially
+#define OT_BOX_RECEIPTS_PER_THREAD 16
+
 #define OT_METHOD "opentxs::Ledger::"
 
 namespace opentxs
 {
+namespace
+{
+// Shared by every ledger, so concurrent bulk loads do not multiply threads
+auto receipt_loaders() noexcept -> boost::asio::thread_pool&
+{
+    static auto pool = boost::asio::thread_pool{std::min<std::size_t>(
+        std::max(std::thread::hardware_concurrency(), 1u),
+        OT_BOX_RECEIPT_LOAD_THREADS)};
+
+    return pool;
+}
+}  // namespace
+
 char const* const __TypeStringsLedger[] = {
     "nymbox",  // the nymbox is per user account (versus per asset account) and
                // is used to receive new transaction numbers (and messages.)
@@ -79,6 +107,7 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , m_setUnloadedReceipts()
 {
     InitLedger();
 }
@@ -96,6 +125,7 @@ Ledger::Ledger(
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , m_setUnloadedReceipts()
 {
     InitLedger();
     SetRealAccountID(theAccountID);
@@ -108,6 +138,7 @@ Ledger::Ledger(const api::internal::Core& core)
     , m_Type(ledgerType::message)
     , m_bLoadedLegacyData(false)
     , m_mapTransactions()
+    , m_setUnloadedReceipts()
 {
     InitLedger();
 }
@@ -199,7 +230,7 @@ auto Ledger::SaveBoxReceipt(const std::int64_t& lTransactionNum) -> bool
 
     // First, see if the transaction itself exists on this ledger.
     // Get a pointer to it.
-    auto pTransaction = GetTransaction(lTransactionNum);
+    auto pTransaction = get_transaction(lTransactionNum);
 
     if (false == bool(pTransaction)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Unable to save box receipt ")(
@@ -209,7 +240,11 @@ auto Ledger::SaveBoxReceipt(const std::int64_t& lTransactionNum) -> bool
         return false;
     }
 
-    return pTransaction->SaveBoxReceipt(*this);
+    if (false == pTransaction->SaveBoxReceipt(*this)) { return false; }
+
+    m_setUnloadedReceipts.erase(lTransactionNum);
+
+    return true;
 }
 
 auto Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum) -> bool
@@ -217,7 +252,7 @@ auto Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum) -> bool
 
     // First, see if the transaction itself exists on this ledger.
     // Get a pointer to it.
-    auto pTransaction = GetTransaction(lTransactionNum);
+    auto pTransaction = get_transaction(lTransactionNum);
 
     if (false == bool(pTransaction)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Unable to delete (overwrite) box "
@@ -241,62 +276,59 @@ auto Ledger::DeleteBoxReceipt(const std::int64_t& lTransactionNum) -> bool
 // if psetUnloaded passed in, then use it to return the #s that weren't there.
 auto Ledger::LoadBoxReceipts(std::set<std::int64_t>* psetUnloaded) -> bool
 {
-    // Grab a copy of all the transaction #s stored inside this ledger.
+    // Grab all the abbreviated transactions stored inside this ledger, in
+    // transaction number order.
     //
-    std::set<std::int64_t> the_set;
+    std::vector<std::shared_ptr<OTTransaction>> abbreviated{};
 
     for (auto& [number, pTransaction] : m_mapTransactions) {
         OT_ASSERT(pTransaction);
-        the_set.insert(number);
+
+        if (pTransaction->IsAbbreviated()) {
+            abbreviated.emplace_back(pTransaction);
+        }
     }
 
-    // Now iterate through those numbers and for each, load the box receipt.
+    // Now load the box receipt for each. Reading, parsing and verifying the
+    // receipts is independent for each one, so this happens in parallel and
+    // the results are applied to the ledger afterwards.
     //
+    auto loaded = load_box_receipts(api_, GetType(), abbreviated);
     bool bRetVal = true;
 
-    for (auto& it : the_set) {
-        std::int64_t lSetNum = it;
+    for (std::size_t i = 0; i < abbreviated.size(); ++i) {
+        const auto lSetNum = abbreviated.at(i)->GetTransactionNum();
+        auto& pBoxReceipt = loaded.at(i);
 
-        const auto pTransaction = GetTransaction(lSetNum);
-        OT_ASSERT(pTransaction);
+        if (pBoxReceipt) {
+            // Replace the existing, abbreviated receipt with the actual
+            // receipt.
+            //
+            m_mapTransactions[lSetNum].reset(pBoxReceipt.release());
+            m_setUnloadedReceipts.erase(lSetNum);
+
+            continue;
+        }
 
         // Failed loading the boxReceipt
         //
-        if ((true == pTransaction->IsAbbreviated()) &&
-            (false == LoadBoxReceipt(lSetNum))) {
-            // WARNING: pTransaction must be re-Get'd below this point if
-            // needed, since pointer
-            // is bad if success on LoadBoxReceipt() call.
-            //
-            bRetVal = false;
-            auto& log = (nullptr != psetUnloaded) ? LogDebug : LogNormal;
+        bRetVal = false;
+        auto& log = (nullptr != psetUnloaded) ? LogDebug : LogNormal;
 
-            if (nullptr != psetUnloaded) { psetUnloaded->insert(lSetNum); }
+        if (nullptr != psetUnloaded) { psetUnloaded->insert(lSetNum); }
 
-            log(OT_METHOD)(__FUNCTION__)(
-                ": Failed calling LoadBoxReceipt on "
-                "abbreviated transaction number: ")(lSetNum)
-                .Flush();
-            // If psetUnloaded is passed in, then we don't want to break,
-            // because we want to
-            // populate it with the conmplete list of IDs that wouldn't load as
-            // a Box Receipt.
-            // Thus, we only break if psetUnloaded is nullptr, which is better
-            // optimization in that case.
-            // (If not building a list of all failures, then we can return at
-            // first sign of failure.)
-            //
-            if (nullptr == psetUnloaded) break;
-        }
-        // else (success), no need for a block in that case.
+        log(OT_METHOD)(__FUNCTION__)(
+            ": Failed calling LoadBoxReceipt on "
+            "abbreviated transaction number: ")(lSetNum)
+            .Flush();
+        // If psetUnloaded is passed in, then we want the complete list of IDs
+        // that wouldn't load as a Box Receipt. Otherwise we stop reporting at
+        // the first sign of failure. (The receipts which did load are kept
+        // either way.)
+        //
+        if (nullptr == psetUnloaded) break;
     }
 
-    // You might ask, why didn't I just iterate through the transactions
-    // directly and just call
-    // LoadBoxReceipt on each one? Answer: Because that function actually
-    // deletes the transaction
-    // and replaces it with a different object, if successful.
-
     return bRetVal;
 }
 
@@ -320,7 +352,7 @@ auto Ledger::LoadBoxReceipt(const std::int64_t& lTransactionNum) -> bool
     // First, see if the transaction itself exists on this ledger.
     // Get a pointer to it.
     //
-    auto pTransaction = GetTransaction(lTransactionNum);
+    auto pTransaction = get_transaction(lTransactionNum);
 
     if (false == bool(pTransaction)) {
         LogNormal(OT_METHOD)(__FUNCTION__)(": Unable to load box receipt ")(
@@ -362,6 +394,7 @@ auto Ledger::LoadBoxReceipt(const std::int64_t& lTransactionNum) -> bool
         RemoveTransaction(lTransactionNum);  // this deletes pTransaction
         std::shared_ptr<OTTransaction> receipt{pBoxReceipt.release()};
         AddTransaction(receipt);
+        m_setUnloadedReceipts.erase(lTransactionNum);
 
         return true;
     }
@@ -1105,13 +1138,17 @@ auto Ledger::GetTransactionIndex(const TransactionNumber target) -> std::int32_t
 auto Ledger::GetTransaction(const TransactionNumber number) const
     -> std::shared_ptr<OTTransaction>
 {
-    try {
+    return get_transaction(number);
+}
 
-        return m_mapTransactions.at(number);
-    } catch (...) {
+auto Ledger::GetFullTransaction(const TransactionNumber number)
+    -> std::shared_ptr<OTTransaction>
+{
+    auto output = get_transaction(number);
 
-        return {};
-    }
+    if (output) { load_on_demand(output); }
+
+    return output;
 }
 
 // Return a count of all the transactions in this ledger that are IN REFERENCE
@@ -1158,6 +1195,139 @@ auto Ledger::GetTransactionByIndex(std::int32_t nIndex) const
                      // at the top.
 }
 
+// Look up a transaction by transaction number without loading its box receipt.
+//
+auto Ledger::get_transaction(const TransactionNumber number) const
+    -> std::shared_ptr<OTTransaction>
+{
+    try {
+
+        return m_mapTransactions.at(number);
+    } catch (...) {
+
+        return {};
+    }
+}
+
+auto Ledger::has_box_receipts() const -> bool
+{
+    switch (GetType()) {
+        case ledgerType::nymbox:
+        case ledgerType::inbox:
+        case ledgerType::outbox:
+        case ledgerType::paymentInbox:
+        case ledgerType::recordBox:
+        case ledgerType::expiredBox: {
+
+            return true;
+        }
+        default: {
+
+            return false;
+        }
+    }
+}
+
+// Loads the box receipts for a list of abbreviated transactions. The output
+// has one entry per input, which is empty if that receipt failed to load.
+//
+auto Ledger::load_box_receipts(
+    const api::internal::Core& api,
+    const ledgerType type,
+    const std::vector<std::shared_ptr<OTTransaction>>& abbreviated)
+    -> std::vector<std::unique_ptr<OTTransaction>>
+{
+    struct Job {
+        const api::internal::Core& api_;
+        const std::int64_t type_;
+        const std::vector<std::shared_ptr<OTTransaction>> abbreviated_;
+        std::atomic<std::size_t> next_;
+        std::mutex lock_;
+        std::condition_variable finished_;
+        std::size_t done_;
+        std::vector<std::unique_ptr<OTTransaction>> output_;
+
+        Job(const api::internal::Core& api,
+            const ledgerType type,
+            const std::vector<std::shared_ptr<OTTransaction>>& abbreviated)
+            : api_(api)
+            , type_(static_cast<std::int64_t>(type))
+            , abbreviated_(abbreviated)
+            , next_(0)
+            , lock_()
+            , finished_()
+            , done_(0)
+            , output_(abbreviated.size())
+        {
+        }
+    };
+
+    const auto count = abbreviated.size();
+    auto job = std::make_shared<Job>(api, type, abbreviated);
+    // Each index is claimed by exactly one thread. A pool thread which only
+    // starts after every index has been claimed returns immediately, so the
+    // caller never waits for the pool to become idle.
+    auto load = [job, count]() {
+        for (auto i = job->next_++; i < count; i = job->next_++) {
+            auto receipt = ::opentxs::LoadBoxReceipt(
+                job->api_, *job->abbreviated_.at(i), job->type_);
+            Lock lock(job->lock_);
+            job->output_.at(i) = std::move(receipt);
+
+            if (count == ++job->done_) { job->finished_.notify_all(); }
+        }
+    };
+    const std::size_t helpers = std::min<std::size_t>(
+        OT_BOX_RECEIPT_LOAD_THREADS, count / OT_BOX_RECEIPTS_PER_THREAD);
+
+    // The calling thread also loads receipts, so one fewer helper is needed.
+    for (std::size_t i = 1; i < helpers; ++i) {
+        boost::asio::post(receipt_loaders(), load);
+    }
+
+    load();
+    Lock lock(job->lock_);
+    job->finished_.wait(lock, [&] { return count == job->done_; });
+
+    return std::move(job->output_);
+}
+
+// If the transaction is an abbreviated box receipt, replace it with the full
+// version, both in the ledger and in the argument. A receipt which fails to
+// load is remembered so that repeated accesses do not retry it.
+//
+void Ledger::load_on_demand(std::shared_ptr<OTTransaction>& transaction)
+{
+    OT_ASSERT(transaction);
+
+    if (false == transaction->IsAbbreviated()) { return; }
+
+    if (false == has_box_receipts()) { return; }
+
+    const auto number = transaction->GetTransactionNum();
+
+    if (0 < m_setUnloadedReceipts.count(number)) { return; }
+
+    auto pBoxReceipt = ::opentxs::LoadBoxReceipt(
+        api_, *transaction, static_cast<std::int64_t>(GetType()));
+
+    if (false == bool(pBoxReceipt)) {
+        LogDebug(OT_METHOD)(__FUNCTION__)(
+            ": Unable to load box receipt for abbreviated transaction ")(
+            number)
+            .Flush();
+        m_setUnloadedReceipts.insert(number);
+
+        return;
+    }
+
+    // The argument may refer to the element of the map itself, so the map is
+    // updated through a copy.
+    std::shared_ptr<OTTransaction> receipt{pBoxReceipt.release()};
+    m_mapTransactions[number] = receipt;
+    transaction = receipt;
+}
+
 // Nymbox-only.
 // Looks up replyNotice by REQUEST NUMBER.
 //
@@ -1992,7 +2162,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
                     // ledger.
                     // (There can only be one.)
                     //
-                    auto pExistingTrans = GetTransaction(number);
+                    auto pExistingTrans = get_transaction(number);
                     if (false != bool(pExistingTrans))  // Uh-oh, it's already
                                                         // there!
                     {
@@ -2228,7 +2398,7 @@ auto Ledger::ProcessXMLNode(irr::io::IrrXMLReader*& xml) -> std::int32_t
             {
 
                 auto pExistingTrans =
-                    GetTransaction(pTransaction->GetTransactionNum());
+                    get_transaction(pTransaction->GetTransactionNum());
                 if (false != bool(pExistingTrans))  // Uh-oh, it's already
                                                     // there!
                 {
@@ -2348,6 +2518,7 @@ void Ledger::ReleaseTransactions()
     // If there were any dynamically allocated objects, clean them up here.
 
     m_mapTransactions.clear();
+    m_setUnloadedReceipts.clear();
 }
 
 void Ledger::Release_Ledger() { ReleaseTransactions(); }
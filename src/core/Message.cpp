@@ -35,6 +35,11 @@
 
 #define OT_METHOD "opentxs::Message"
 
+// Armored frames are printable, so a leading null byte can not be mistaken
+// for one
+#define BINARY_MESSAGE_PREFIX "\0OTX"
+#define BINARY_MESSAGE_PREFIX_SIZE 4
+
 #define ERROR_STRING "error"
 #define PING_NOTARY "pingNotary"
 #define PING_NOTARY_RESPONSE "pingNotaryResponse"
@@ -289,6 +294,63 @@ auto Message::Command(const MessageType type) -> std::string
     }
 }
 
+auto Message::Decode(
+    const std::string& frame,
+    String& serialized,
+    Encoding& encoding) -> bool
+{
+    const auto prefix =
+        std::string{BINARY_MESSAGE_PREFIX, BINARY_MESSAGE_PREFIX_SIZE};
+    serialized.Release();
+
+    if (0 == frame.compare(0, prefix.size(), prefix)) {
+        encoding = Encoding::Binary;
+        serialized.Set(frame.c_str() + prefix.size());
+    } else {
+        encoding = Encoding::Armored;
+        auto armored = Armored::Factory();
+        armored->MemSet(frame.data(), static_cast<std::uint32_t>(frame.size()));
+        armored->GetString(serialized);
+    }
+
+    return serialized.Exists();
+}
+
+auto Message::Encode(const String& serialized, const Encoding encoding)
+    -> std::string
+{
+    if (false == serialized.Exists()) { return {}; }
+
+    if (Encoding::Binary == encoding) {
+        auto output =
+            std::string{BINARY_MESSAGE_PREFIX, BINARY_MESSAGE_PREFIX_SIZE};
+        output.append(serialized.Get(), serialized.GetLength());
+
+        return output;
+    }
+
+    const auto armored = Armored::Factory(serialized);
+
+    if (false == armored->Exists()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to armor message.")
+            .Flush();
+
+        return {};
+    }
+
+    return std::string{armored->Get(), armored->GetLength()};
+}
+
+auto Message::Failure(const Encoding encoding) -> std::string
+{
+    if (Encoding::Binary == encoding) {
+
+        return std::string{BINARY_MESSAGE_PREFIX, BINARY_MESSAGE_PREFIX_SIZE};
+    }
+
+    return {};
+}
+
 auto Message::Type(const std::string& type) -> MessageType
 {
     try {
@@ -15,6 +15,9 @@
 #include "Generics.pb.h"
 #include "Markets.pb.h"
 #include "Moneychanger.pb.h"
+#if OT_STORAGE_LMDB
+#include "core/OTStorageLMDB.hpp"
+#endif  // OT_STORAGE_LMDB
 #include "internal/api/Api.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Proto.hpp"
@@ -2168,6 +2171,12 @@ auto Storage::Create(const StorageType& eStorageType, const PackType& ePackType)
             pStore = StorageFS::Instantiate();
             OT_ASSERT(nullptr != pStore);
             break;
+#if OT_STORAGE_LMDB
+        case STORE_LMDB:
+            pStore = StorageLMDB::Instantiate();
+            OT_ASSERT(nullptr != pStore);
+            break;
+#endif  // OT_STORAGE_LMDB
         //            case STORE_COUCH_DB:
         //                pStore = new StorageCouchDB; OT_ASSERT(nullptr !=
         //                pStore);
@@ -2213,6 +2222,10 @@ auto Storage::GetType() const -> StorageType
     // that this is a custom Storage type invented by the API user.
 
     if (typeid(*this) == typeid(StorageFS)) return STORE_FILESYSTEM;
+#if OT_STORAGE_LMDB
+    else if (typeid(*this) == typeid(StorageLMDB))
+        return STORE_LMDB;
+#endif  // OT_STORAGE_LMDB
     //    else if (typeid(*this) == typeid(StorageCouchDB))
     //        return STORE_COUCH_DB;
     //  Etc.
@@ -0,0 +1,488 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"    // IWYU pragma: associated
+#include "1_Internal.hpp"  // IWYU pragma: associated
+#if OT_STORAGE_LMDB
+#include "core/OTStorageLMDB.hpp"  // IWYU pragma: associated
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "internal/api/Api.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Legacy.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "opentxs/core/String.hpp"
+
+#define OTDB_LMDB_FOLDER "otdb"
+#define OTDB_LMDB_IMPORTED_KEY "legacy_import"
+
+#define OT_METHOD "opentxs::OTDB::StorageLMDB::"
+
+namespace fs = boost::filesystem;
+
+namespace opentxs::OTDB
+{
+namespace
+{
+struct Environments {
+    std::mutex lock_{};
+    std::map<std::string, std::unique_ptr<storage::lmdb::LMDB>> map_{};
+};
+
+auto environments() noexcept -> Environments&
+{
+    static auto output = Environments{};
+
+    return output;
+}
+
+auto read_file(const fs::path& path, std::string& output) noexcept -> bool
+{
+    std::ifstream file(path.string(), std::ios::in | std::ios::binary);
+
+    if (false == file.is_open()) { return false; }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    output = buffer.str();
+
+    return false == file.bad();
+}
+}  // namespace
+
+const storage::lmdb::TableNames StorageLMDB::table_names_{
+    {Values, "values"},
+    {Config, "config"},
+};
+
+StorageLMDB::StorageLMDB()
+    : Storage()
+{
+}
+
+auto StorageLMDB::Exists(
+    const api::internal::Core& api,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    const auto key = get_key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) { return false; }
+
+    const auto* db = get_database(api, dataFolder);
+
+    if (nullptr == db) { return false; }
+
+    return db->Exists(Values, key);
+}
+
+// Returns the value size, plus the key in strOutput.
+//
+auto StorageLMDB::FormPathString(
+    const api::internal::Core& api,
+    std::string& strOutput,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> std::int64_t
+{
+    strOutput = get_key(strFolder, oneStr, twoStr, threeStr);
+
+    if (strOutput.empty()) { return -1; }
+
+    auto value = std::string{};
+
+    if (load(api, value, dataFolder, strFolder, oneStr, twoStr, threeStr)) {
+        return static_cast<std::int64_t>(value.size());
+    }
+
+    return 0;
+}
+
+auto StorageLMDB::get_database(
+    const api::internal::Core& api,
+    const std::string& dataFolder) -> Database*
+{
+    auto& registry = environments();
+    Lock lock(registry.lock_);
+    auto& db = registry.map_[dataFolder];
+
+    if (db) { return db.get(); }
+
+    auto folder = String::Factory();
+    const auto created = api.Legacy().AppendFolder(
+                             folder,
+                             String::Factory(dataFolder),
+                             String::Factory(OTDB_LMDB_FOLDER)) &&
+                         api.Legacy().BuildFolderPath(folder);
+
+    if (false == created) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to create ")(folder)
+            .Flush();
+        registry.map_.erase(dataFolder);
+
+        return nullptr;
+    }
+
+    db = std::make_unique<Database>(
+        table_names_,
+        folder->Get(),
+        storage::lmdb::TablesToInit{
+            {Values, 0},
+            {Config, 0},
+        });
+
+    OT_ASSERT(db);
+
+    return db.get();
+}
+
+auto StorageLMDB::get_key(
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> std::string
+{
+    // Same rules as StorageFS::ConstructAndConfirmPathImp, so every key is
+    // the path StorageFS would have used relative to the data folder
+    const std::string strZero(3 > strFolder.length() ? "" : strFolder);
+    const std::string strOne(3 > oneStr.length() ? "" : oneStr);
+    const std::string strTwo(3 > twoStr.length() ? "" : twoStr);
+    const std::string strThree(3 > threeStr.length() ? "" : threeStr);
+
+    if (strZero.empty() && (0 != strFolder.compare("."))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": strFolder is too short: ")(
+            strFolder)
+            .Flush();
+
+        return {};
+    }
+
+    if (strOne.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Empty: oneStr is passed in!")
+            .Flush();
+
+        return {};
+    }
+
+    if (strTwo.empty() && (false == strThree.empty())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Error: strThree passed in: ")(
+            strThree)(" while strTwo is empty!")
+            .Flush();
+
+        return {};
+    }
+
+    auto output = std::string{};
+
+    if (false == strZero.empty()) { output += strZero + "/"; }
+
+    output += strOne;
+
+    if (strTwo.empty()) { return output; }
+
+    output += "/" + strTwo;
+
+    if (strThree.empty()) { return output; }
+
+    output += "/" + strThree;
+
+    return output;
+}
+
+auto StorageLMDB::Import(
+    const api::internal::Core& api,
+    const std::string& dataFolder,
+    const bool force) -> bool
+{
+    const auto* db = get_database(api, dataFolder);
+
+    if (nullptr == db) { return false; }
+
+    return import(api, dataFolder, *db, force);
+}
+
+auto StorageLMDB::import(
+    const api::internal::Core& api,
+    const std::string& dataFolder,
+    const Database& db,
+    const bool force) -> bool
+{
+    if ((false == force) && db.Exists(Config, OTDB_LMDB_IMPORTED_KEY)) {
+        return true;
+    }
+
+    const auto& legacy = api.Legacy();
+    // Every folder OTDB keys are stored under. The Common folder belongs to
+    // the newer storage layer and is not imported.
+    const auto folders = std::vector<std::string>{
+        legacy.Account(),
+        legacy.Contract(),
+        legacy.Cron(),
+        legacy.ExpiredBox(),
+        legacy.Inbox(),
+        legacy.Market(),
+        legacy.Mint(),
+        legacy.Nym(),
+        legacy.Nymbox(),
+        legacy.Outbox(),
+        legacy.PaymentInbox(),
+        legacy.Receipt(),
+        legacy.RecordBox(),
+    };
+    auto files = std::size_t{0};
+    auto bytes = std::size_t{0};
+    auto value = std::string{};
+    auto success{true};
+    const auto copy = [&](const fs::path& path, const std::string& key) {
+        if (false == read_file(path, value)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to read ")(
+                path.string())
+                .Flush();
+            success = false;
+
+            return;
+        }
+
+        if (false == db.Queue(Values, key, value)) {
+            success = false;
+
+            return;
+        }
+
+        ++files;
+        bytes += value.size();
+    };
+
+    try {
+        const auto root = fs::path{dataFolder};
+
+        if (false == fs::is_directory(root)) { return true; }
+
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Importing legacy storage from ")(
+            dataFolder)
+            .Flush();
+
+        // Values stored in the "." folder, such as the notary's main file
+        for (const auto& entry : fs::directory_iterator(root)) {
+            if (fs::is_regular_file(entry.status())) {
+                copy(entry.path(), entry.path().filename().generic_string());
+            }
+        }
+
+        for (const auto& folder : folders) {
+            const auto path = root / folder;
+
+            if (false == fs::is_directory(path)) { continue; }
+
+            for (const auto& entry : fs::recursive_directory_iterator(path)) {
+                if (false == fs::is_regular_file(entry.status())) { continue; }
+
+                copy(
+                    entry.path(),
+                    fs::relative(entry.path(), root).generic_string());
+            }
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+        success = false;
+    }
+
+    if (success) {
+        success = db.Queue(Config, OTDB_LMDB_IMPORTED_KEY, std::to_string(1));
+    }
+
+    success &= db.Commit();
+
+    if (success) {
+        LogNormal(OT_METHOD)(__FUNCTION__)(": Imported ")(files)(
+            " files totalling ")(bytes)(" bytes")
+            .Flush();
+    }
+
+    return success;
+}
+
+auto StorageLMDB::load(
+    const api::internal::Core& api,
+    std::string& output,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    const auto key = get_key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) { return false; }
+
+    const auto* db = get_database(api, dataFolder);
+
+    if (nullptr == db) { return false; }
+
+    const auto found = db->Load(Values, key, [&](const auto data) -> void {
+        output.assign(data.data(), data.size());
+    });
+
+    if (false == found) {
+        LogDetail(OT_METHOD)(__FUNCTION__)(": Failure reading from ")(key)(
+            ": key does not exist.")
+            .Flush();
+    }
+
+    return found;
+}
+
+auto StorageLMDB::onEraseValueByKey(
+    const api::internal::Core& api,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    const auto key = get_key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) { return false; }
+
+    const auto* db = get_database(api, dataFolder);
+
+    if (nullptr == db) { return false; }
+
+    if (false == db->Exists(Values, key)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": ** Failed trying to delete key: ")(key)(".")
+            .Flush();
+
+        return false;
+    }
+
+    if (false == db->QueueDelete(Values, key)) { return false; }
+
+    return db->Commit();
+}
+
+auto StorageLMDB::onQueryPackedBuffer(
+    const api::internal::Core& api,
+    PackedBuffer& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    auto value = std::string{};
+
+    if (false ==
+        load(api, value, dataFolder, strFolder, oneStr, twoStr, threeStr)) {
+        return false;
+    }
+
+    std::istringstream in(value, std::ios::in | std::ios::binary);
+
+    return theBuffer.ReadFromIStream(in, value.size());
+}
+
+auto StorageLMDB::onQueryPlainString(
+    const api::internal::Core& api,
+    std::string& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    theBuffer.clear();
+
+    if (false == load(
+                     api,
+                     theBuffer,
+                     dataFolder,
+                     strFolder,
+                     oneStr,
+                     twoStr,
+                     threeStr)) {
+        return false;
+    }
+
+    return 0 < theBuffer.length();
+}
+
+auto StorageLMDB::onStorePackedBuffer(
+    const api::internal::Core& api,
+    PackedBuffer& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    std::ostringstream out(std::ios::out | std::ios::binary);
+
+    if (false == theBuffer.WriteToOStream(out)) { return false; }
+
+    return store(
+        api, out.str(), dataFolder, strFolder, oneStr, twoStr, threeStr);
+}
+
+auto StorageLMDB::onStorePlainString(
+    const api::internal::Core& api,
+    const std::string& theBuffer,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    return store(
+        api, theBuffer, dataFolder, strFolder, oneStr, twoStr, threeStr);
+}
+
+auto StorageLMDB::store(
+    const api::internal::Core& api,
+    const std::string& value,
+    const std::string& dataFolder,
+    const std::string& strFolder,
+    const std::string& oneStr,
+    const std::string& twoStr,
+    const std::string& threeStr) -> bool
+{
+    const auto key = get_key(strFolder, oneStr, twoStr, threeStr);
+
+    if (key.empty()) { return false; }
+
+    const auto* db = get_database(api, dataFolder);
+
+    if (nullptr == db) { return false; }
+
+    // Callers treat success as durable, so the write is not left for the
+    // next batch. Anything else queued by then is committed along with it.
+    if (false == (db->Queue(Values, key, value) && db->Commit())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Error writing to ")(key)(".")
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+StorageLMDB::~StorageLMDB() = default;
+}  // namespace opentxs::OTDB
+#endif  // OT_STORAGE_LMDB
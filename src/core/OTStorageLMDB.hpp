@@ -0,0 +1,166 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#if OT_STORAGE_LMDB
+#include <cstdint>
+#include <string>
+
+#include "opentxs/core/OTStorage.hpp"
+#include "util/LMDB.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+namespace internal
+{
+struct Core;
+}  // namespace internal
+}  // namespace api
+}  // namespace opentxs
+
+namespace opentxs::OTDB
+{
+// StorageLMDB -- LMDB Storage Context
+//
+// Every value which StorageFS would write to a separate file is stored as one
+// record in an LMDB environment located in the "otdb" folder of the data
+// folder. The key of each record is the path of the equivalent file relative
+// to the data folder, so the folder/key semantics are unchanged.
+//
+// Every file of the legacy directory tree is imported by Import, which the
+// server calls once during initialization before anything else uses the
+// environment. The files are left in place.
+class StorageLMDB final : public Storage
+{
+public:
+    // Copies the legacy directory tree of a data folder into its environment
+    //
+    // Files are only imported once per data folder unless force is true, in
+    // which case existing values with the same key are overwritten.
+    static bool Import(
+        const api::internal::Core& api,
+        const std::string& dataFolder,
+        const bool force = false);
+
+    bool Exists(
+        const api::internal::Core& api,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    std::int64_t FormPathString(
+        const api::internal::Core& api,
+        std::string& strOutput,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    static StorageLMDB* Instantiate() { return new StorageLMDB; }
+
+    ~StorageLMDB() final;
+
+protected:
+    bool onStorePackedBuffer(
+        const api::internal::Core& api,
+        PackedBuffer& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    bool onQueryPackedBuffer(
+        const api::internal::Core& api,
+        PackedBuffer& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    bool onStorePlainString(
+        const api::internal::Core& api,
+        const std::string& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    bool onQueryPlainString(
+        const api::internal::Core& api,
+        std::string& theBuffer,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+    bool onEraseValueByKey(
+        const api::internal::Core& api,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr) final;
+
+private:
+    enum Table {
+        Values = 0,
+        Config = 1,
+    };
+
+    using Database = storage::lmdb::LMDB;
+
+    static const storage::lmdb::TableNames table_names_;
+
+    static std::string get_key(
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr);
+
+    // LMDB does not allow an environment to be opened more than once per
+    // process, so environments are shared by every StorageLMDB instance
+    static Database* get_database(
+        const api::internal::Core& api,
+        const std::string& dataFolder);
+    static bool import(
+        const api::internal::Core& api,
+        const std::string& dataFolder,
+        const Database& db,
+        const bool force);
+    bool load(
+        const api::internal::Core& api,
+        std::string& output,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr);
+    bool store(
+        const api::internal::Core& api,
+        const std::string& value,
+        const std::string& dataFolder,
+        const std::string& strFolder,
+        const std::string& oneStr,
+        const std::string& twoStr,
+        const std::string& threeStr);
+
+    StorageLMDB();
+    StorageLMDB(const StorageLMDB&) = delete;
+    StorageLMDB(StorageLMDB&&) = delete;
+    StorageLMDB& operator=(const StorageLMDB&) = delete;
+    StorageLMDB& operator=(StorageLMDB&&) = delete;
+};
+}  // namespace opentxs::OTDB
+#endif  // OT_STORAGE_LMDB
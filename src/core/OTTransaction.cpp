@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 
+#include "core/transaction/ReceiptCache.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Shared.hpp"
@@ -3035,6 +3036,12 @@ auto OTTransaction::DeleteBoxReceipt(Ledger& theLedger) -> bool
             "(Transaction was already empty -- strange.)",
             "MARKED_FOR_DELETION");  // todo hardcoded.
 
+    ReceiptCache::Get().Erase(ReceiptCache::Key(
+        api_.DataFolder(),
+        strFolder1name,
+        strFolder2name,
+        strFolder3name,
+        strFilename));
     bool bDeleted = OTDB::StorePlainString(
         api_,
         strOutput->Get(),
@@ -3113,6 +3120,14 @@ auto OTTransaction::SaveBoxReceipt(std::int64_t lLedgerType) -> bool
         return false;
     }
 
+    auto& cache = ReceiptCache::Get();
+    const auto key = ReceiptCache::Key(
+        api_.DataFolder(),
+        strFolder1name,
+        strFolder2name,
+        strFolder3name,
+        strFilename);
+    cache.Erase(key);
     bool bSaved = OTDB::StorePlainString(
         api_,
         strFinal->Get(),
@@ -3122,6 +3137,8 @@ auto OTTransaction::SaveBoxReceipt(std::int64_t lLedgerType) -> bool
         strFolder3name->Get(),
         strFilename->Get());
 
+    if (bSaved) { cache.Add(key, strFinal->Get()); }
+
     if (!bSaved)
         LogOutput(OT_METHOD)(__FUNCTION__)(": Error writing file: ")(
             strFolder1name)(PathSeparator())(strFolder2name)(PathSeparator())(
@@ -14,6 +14,7 @@
 #include <string>
 #include <utility>
 
+#include "core/cron/Schedule.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/api/Factory.hpp"
@@ -58,6 +59,7 @@ OTCron::OTCron(const api::internal::Core& server)
     , m_mapMarkets()
     , m_mapCronItems()
     , m_multimapCronItems()
+    , m_pSchedule(std::make_unique<cron::Schedule>())
     , m_NOTARY_ID(api_.Factory().ServerID())
     , m_listTransactionNumbers()
     , m_bIsActivated(false)
@@ -243,8 +245,8 @@ auto OTCron::GetMarketList(Armored& ascOutput, std::int32_t& nMarketCount)
 
         pMarketData->last_sale_date = pMarket->GetLastSaleDate();
 
-        const mapOfOffers::size_type theBidCount = pMarket->GetBidCount();
-        const mapOfOffers::size_type theAskCount = pMarket->GetAskCount();
+        const auto theBidCount = pMarket->GetBidCount();
+        const auto theAskCount = pMarket->GetAskCount();
 
         pMarketData->number_bids = std::to_string(theBidCount);
         pMarketData->number_asks = std::to_string(theAskCount);
@@ -583,9 +585,8 @@ void OTCron::UpdateContents(const PasswordPrompt& reason)
 
 auto OTCron::computeTimeout() -> std::chrono::milliseconds
 {
-    return GetCronMsBetweenProcess() -
-           std::chrono::duration_cast<std::chrono::milliseconds>(
-               Clock::now() - last_executed_);
+    return m_pSchedule->Timeout(
+        Clock::now(), last_executed_ + GetCronMsBetweenProcess());
 }
 
 // Make sure to call this regularly so the CronItems get a chance to process and
@@ -620,11 +621,15 @@ void OTCron::ProcessCronItems()
     }
     bool bNeedToSave = false;
 
-    // loop through the cron items and tell each one to ProcessCron().
+    // Only the items which are due get processed. Take a copy of their
+    // numbers since processing an item reschedules it.
+    const auto due = m_pSchedule->Due(last_executed_);
+
+    // loop through the due cron items and tell each one to ProcessCron().
     // If the item returns true, that means leave it on the list. Otherwise,
-    // if it returns false, that means "it's done: remove it."
-    for (auto it = m_multimapCronItems.begin();
-         it != m_multimapCronItems.end();) {
+    // if it returns false, that means "it's done: remove it." Any item which
+    // is skipped keeps its deadline and is processed in the next round.
+    for (const auto& lTransactionNum : due) {
         if (GetTransactionCount() <= nTwentyPercent) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
                 ": WARNING: Cron has fewer than 20 percent of its normal "
@@ -641,25 +646,30 @@ void OTCron::ProcessCronItems()
                 .Flush();
             break;
         }
-        auto pItem = it->second;
-        OT_ASSERT(false != bool(pItem));
+        // An earlier item in this round may have removed this one
+        auto it_map = FindItemOnMap(lTransactionNum);
+
+        if (m_mapCronItems.end() == it_map) { continue; }
+
+        auto pItem = it_map->second;
         LogVerbose(OT_METHOD)(__FUNCTION__)(": Processing item number: ")(
-            pItem->GetTransactionNum())
+            lTransactionNum)
             .Flush();
 
         if (pItem->ProcessCron(reason)) {
-            it++;
+            m_pSchedule->Add(lTransactionNum, pItem->GetNextProcessDate());
             continue;
         }
         pItem->HookRemovalFromCron(
             api_.Wallet(), nullptr, GetNextTransactionNumber(), reason);
         LogNormal(OT_METHOD)(__FUNCTION__)(": Removing cron item: ")(
-            pItem->GetTransactionNum())(".")
+            lTransactionNum)(".")
             .Flush();
-        it = m_multimapCronItems.erase(it);
-        auto it_map = FindItemOnMap(pItem->GetTransactionNum());
-        OT_ASSERT(m_mapCronItems.end() != it_map);
-        m_mapCronItems.erase(it_map);
+        auto it_multimap = FindItemOnMultimap(lTransactionNum);
+        OT_ASSERT(m_multimapCronItems.end() != it_multimap);
+        m_multimapCronItems.erase(it_multimap);
+        m_mapCronItems.erase(FindItemOnMap(lTransactionNum));
+        m_pSchedule->Remove(lTransactionNum);
 
         bNeedToSave = true;
     }
@@ -726,6 +736,8 @@ auto OTCron::AddCronItem(
         theItem->SetCronPointer(*this);
         theItem->setServerNym(m_pServerNym);
         theItem->setNotaryID(m_NOTARY_ID);
+        m_pSchedule->Add(
+            theItem->GetTransactionNum(), theItem->GetNextProcessDate());
 
         bool bSuccess = true;
 
@@ -820,6 +832,7 @@ auto OTCron::RemoveCronItem(
 
         m_mapCronItems.erase(it_map);            // Remove from MAP.
         m_multimapCronItems.erase(it_multimap);  // Remove from MULTIMAP.
+        m_pSchedule->Remove(lTransactionNum);
 
         // An item has been removed from Cron. SAVE.
         return SaveCron();
@@ -882,6 +895,13 @@ auto OTCron::FindItemOnMultimap(std::int64_t lTransactionNum)
     return itt;
 }
 
+auto OTCron::NextDeadline() const -> Time { return m_pSchedule->Next(); }
+
+void OTCron::RescheduleCronItem(std::int64_t lTransactionNum, const Time tDue)
+{
+    m_pSchedule->Reschedule(lTransactionNum, tDue);
+}
+
 // Look up a transaction by transaction number and see if it is in the map.
 // If it is, return a pointer to it, otherwise return nullptr.
 //
@@ -12,6 +12,7 @@
 #include <deque>
 #include <memory>
 
+#include "core/cron/Schedule.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Exclusive.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -31,6 +32,7 @@
 #include "opentxs/core/OTStorage.hpp"
 #include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/String.hpp"
+#include "opentxs/core/cron/OTCron.hpp"
 #include "opentxs/core/identifier/Server.hpp"
 #include "opentxs/identity/Nym.hpp"
 #include "opentxs/otx/consensus/Client.hpp"
@@ -745,6 +747,27 @@ auto OTCronItem::CanRemoveItemFromCron(const otx::context::Client& context)
     // above. Only if that fails, do you need to dig deeper...
 }
 
+void OTCronItem::FlagForRemoval()
+{
+    m_bRemovalFlag = true;
+
+    // Don't make Cron wait for the next process interval to remove the item
+    if (nullptr != m_pCron) {
+        m_pCron->RescheduleCronItem(GetTransactionNum(), Time{});
+    }
+}
+
+// Subclasses skip processing until GetProcessInterval() has elapsed since
+// GetLastProcessDate(), but expiration and removal must not wait for that.
+auto OTCronItem::GetNextProcessDate() const -> Time
+{
+    return cron::Schedule::NextProcessDate(
+        IsFlaggedForRemoval(),
+        GetLastProcessDate(),
+        GetProcessInterval(),
+        GetValidTo());
+}
+
 // OTCron calls this regularly, which is my chance to expire, etc.
 // Child classes will override this, AND call it (to verify valid date
 // range.)
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"            // IWYU pragma: associated
+#include "1_Internal.hpp"          // IWYU pragma: associated
+#include "core/cron/Schedule.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+namespace opentxs::cron
+{
+Schedule::Schedule() noexcept
+    : deadlines_()
+    , index_()
+{
+}
+
+auto Schedule::Add(const std::int64_t number, const Time due) noexcept
+    -> void
+{
+    Remove(number);
+    index_.emplace(number, deadlines_.emplace(due, number));
+}
+
+auto Schedule::Contains(const std::int64_t number) const noexcept -> bool
+{
+    return index_.end() != index_.find(number);
+}
+
+auto Schedule::Due(const Time time) const noexcept -> Numbers
+{
+    auto output = Numbers{};
+
+    for (auto it = deadlines_.begin();
+         (deadlines_.end() != it) && (it->first <= time);
+         ++it) {
+        output.emplace_back(it->second);
+    }
+
+    return output;
+}
+
+auto Schedule::Next() const noexcept -> Time
+{
+    if (deadlines_.empty()) { return Time::max(); }
+
+    return deadlines_.begin()->first;
+}
+
+auto Schedule::NextProcessDate(
+    const bool flaggedForRemoval,
+    const Time lastProcessed,
+    const std::chrono::seconds interval,
+    const Time validTo) noexcept -> Time
+{
+    if (flaggedForRemoval) { return Time{}; }
+
+    auto output = Time{};
+
+    // ProcessCron returns early unless more than the interval has elapsed
+    if (lastProcessed > Time{}) {
+        output = lastProcessed + interval + Clock::duration{1};
+    }
+
+    if ((validTo > Time{}) && (validTo < output)) { output = validTo; }
+
+    return output;
+}
+
+auto Schedule::Remove(const std::int64_t number) noexcept -> void
+{
+    auto it = index_.find(number);
+
+    if (index_.end() == it) { return; }
+
+    deadlines_.erase(it->second);
+    index_.erase(it);
+}
+
+auto Schedule::Reschedule(const std::int64_t number, const Time due) noexcept
+    -> bool
+{
+    if (false == Contains(number)) { return false; }
+
+    Add(number, due);
+
+    return true;
+}
+
+auto Schedule::Timeout(const Time now, const Time earliest) const noexcept
+    -> std::chrono::milliseconds
+{
+    const auto next = std::max(earliest, Next());
+
+    // Rounded up so a wait which ends on time never finds the item not yet due
+    return std::chrono::ceil<std::chrono::milliseconds>(next - now);
+}
+}  // namespace opentxs::cron
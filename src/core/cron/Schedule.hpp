@@ -0,0 +1,68 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::cron
+{
+// Orders the items on OTCron by the next time each one needs processing, so
+// a round only visits the items which are due
+class Schedule
+{
+public:
+    using Numbers = std::vector<std::int64_t>;
+
+    // The earliest time at which an item's ProcessCron will do more than
+    // return early: its last process date plus its interval, clamped to its
+    // expiration date. Items flagged for removal are due immediately.
+    static auto NextProcessDate(
+        const bool flaggedForRemoval,
+        const Time lastProcessed,
+        const std::chrono::seconds interval,
+        const Time validTo) noexcept -> Time;
+
+    auto Contains(const std::int64_t number) const noexcept -> bool;
+    // Transaction numbers of every item due at or before the specified time,
+    // earliest first
+    auto Due(const Time time) const noexcept -> Numbers;
+    // The earliest deadline, or Time::max() if nothing is scheduled
+    auto Next() const noexcept -> Time;
+    // Time remaining until the next deadline, but never less than the time
+    // remaining until earliest
+    auto Timeout(const Time now, const Time earliest) const noexcept
+        -> std::chrono::milliseconds;
+
+    // Adds an item, or moves it if it is already scheduled
+    auto Add(const std::int64_t number, const Time due) noexcept -> void;
+    auto Remove(const std::int64_t number) noexcept -> void;
+    // Moves an item which is already scheduled. Items which are not are
+    // scheduled when they are added, so they are ignored.
+    auto Reschedule(const std::int64_t number, const Time due) noexcept
+        -> bool;
+
+    Schedule() noexcept;
+
+    ~Schedule() = default;
+
+private:
+    using Deadlines = std::multimap<Time, std::int64_t>;
+    using Index = std::map<std::int64_t, Deadlines::iterator>;
+
+    Deadlines deadlines_;
+    Index index_;
+
+    Schedule(const Schedule&) = delete;
+    Schedule(Schedule&&) = delete;
+    auto operator=(const Schedule&) -> Schedule& = delete;
+    auto operator=(Schedule&&) -> Schedule& = delete;
+};
+}  // namespace opentxs::cron
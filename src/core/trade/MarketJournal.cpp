@@ -0,0 +1,435 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                  // IWYU pragma: associated
+#include "1_Internal.hpp"                // IWYU pragma: associated
+#include "core/trade/MarketJournal.hpp"  // IWYU pragma: associated
+
+extern "C" {
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+}
+
+#include <boost/endian/buffers.hpp>
+#include <boost/filesystem.hpp>
+#include <cerrno>
+#include <ctime>
+#include <fstream>
+#include <limits>
+#include <utility>
+
+#include "internal/api/Api.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Legacy.hpp"
+#include "opentxs/core/Data.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/LogSource.hpp"
+#include "opentxs/core/String.hpp"
+#include "opentxs/crypto/key/Asymmetric.hpp"
+#include "opentxs/crypto/library/AsymmetricProvider.hpp"
+#include "opentxs/identity/Nym.hpp"
+
+#define OT_METHOD "opentxs::MarketJournal::"
+
+namespace be = boost::endian;
+namespace fs = boost::filesystem;
+
+namespace opentxs
+{
+namespace
+{
+struct Header {
+    std::uint8_t type_;
+    be::little_int64_buf_t number_;
+    be::little_int64_buf_t date_;
+    be::little_uint32_buf_t size_;
+    be::little_uint32_buf_t signature_;
+};
+
+static_assert(25 == sizeof(Header), "Unexpected padding in journal header");
+
+auto make_header(const MarketJournal::Entry& entry) noexcept -> Header
+{
+    auto output = Header{};
+    output.type_ = static_cast<std::uint8_t>(entry.type_);
+    output.number_ = entry.number_;
+    output.date_ = static_cast<std::int64_t>(Clock::to_time_t(entry.date_));
+    output.size_ = static_cast<std::uint32_t>(entry.data_.size());
+    output.signature_ = static_cast<std::uint32_t>(entry.signature_.size());
+
+    return output;
+}
+
+class FileDescriptor
+{
+public:
+    FileDescriptor(const std::string& path, const int flags) noexcept
+        : fd_(::open(path.c_str(), flags | O_CLOEXEC, S_IRUSR | S_IWUSR))
+    {
+    }
+
+    operator bool() const noexcept { return good(); }
+    operator int() const noexcept { return fd_; }
+
+    ~FileDescriptor()
+    {
+        if (good()) { ::close(fd_); }
+    }
+
+private:
+    const int fd_;
+
+    auto good() const noexcept -> bool { return (-1 != fd_); }
+
+    FileDescriptor() = delete;
+    FileDescriptor(const FileDescriptor&) = delete;
+    FileDescriptor(FileDescriptor&&) = delete;
+    auto operator=(const FileDescriptor&) -> FileDescriptor& = delete;
+    auto operator=(FileDescriptor&&) -> FileDescriptor& = delete;
+};
+
+auto sign(
+    const api::internal::Core& api,
+    const identity::Nym& signer,
+    MarketJournal::Entry& entry,
+    const PasswordPrompt& reason) noexcept -> bool
+{
+    const auto& key = signer.GetPrivateSignKey();
+    auto signature = Data::Factory();
+
+    if (false == key.engine().Sign(
+                     api,
+                     MarketJournal::Preimage(entry),
+                     key,
+                     key.SigHashType(),
+                     signature->WriteInto(),
+                     reason)) {
+
+        return false;
+    }
+
+    entry.signature_.assign(
+        static_cast<const char*>(signature->data()), signature->size());
+
+    return true;
+}
+
+auto sync(const int fd) noexcept -> bool
+{
+#if defined(__APPLE__)
+    // This is a Mac OS X system which does not implement
+    // fsync as such.
+    return 0 == ::fcntl(fd, F_FULLFSYNC);
+#else
+    return 0 == ::fsync(fd);
+#endif
+}
+
+auto sync(const std::string& path, const int flags) noexcept -> bool
+{
+    const auto fd = FileDescriptor{path, flags};
+
+    return fd && sync(fd);
+}
+
+auto truncate(const std::string& path, const std::uintmax_t size) noexcept
+    -> bool
+{
+    const auto fd = FileDescriptor{path, O_WRONLY};
+
+    return fd && (0 == ::ftruncate(fd, static_cast<::off_t>(size))) &&
+           sync(fd);
+}
+
+auto verify(
+    const identity::Nym& signer,
+    const MarketJournal::Entry& entry) noexcept -> bool
+{
+    const auto& key = signer.GetPublicSignKey();
+    const auto preimage = MarketJournal::Preimage(entry);
+
+    return key.engine().Verify(
+        Data::Factory(preimage.data(), preimage.size()),
+        key,
+        Data::Factory(entry.signature_.data(), entry.signature_.size()),
+        key.SigHashType());
+}
+
+auto write(const int fd, const char* data, std::size_t size) noexcept -> bool
+{
+    while (0 < size) {
+        const auto written = ::write(fd, data, size);
+
+        if (0 > written) {
+            if (EINTR == errno) { continue; }
+
+            return false;
+        }
+
+        data += written;
+        size -= static_cast<std::size_t>(written);
+    }
+
+    return true;
+}
+}  // namespace
+
+MarketJournal::MarketJournal(
+    const api::internal::Core& api,
+    const std::string& marketID) noexcept
+    : api_(api)
+    , path_(get_path(api, marketID))
+    , folder_(fs::path(path_).parent_path().string())
+    , count_(0)
+{
+}
+
+auto MarketJournal::Append(
+    const identity::Nym& signer,
+    Entry& entry,
+    const PasswordPrompt& reason) noexcept -> bool
+{
+    if (path_.empty()) { return false; }
+
+    if (entry.data_.size() > std::numeric_limits<std::uint32_t>::max()) {
+        return false;
+    }
+
+    if (false == sign(api_, signer, entry, reason)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to sign market journal record.")
+            .Flush();
+
+        return false;
+    }
+
+    if (entry.signature_.empty() ||
+        (entry.signature_.size() > std::numeric_limits<std::uint32_t>::max())) {
+        return false;
+    }
+
+    const auto header = make_header(entry);
+    auto record = std::string{};
+    record.reserve(
+        sizeof(header) + entry.data_.size() + entry.signature_.size());
+    record.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    record.append(entry.data_);
+    record.append(entry.signature_);
+    const auto file = FileDescriptor{path_, O_WRONLY | O_APPEND | O_CREAT};
+
+    if (!file) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to open ")(path_).Flush();
+
+        return false;
+    }
+
+    struct ::stat info {
+    };
+
+    if (0 != ::fstat(file, &info)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to stat ")(path_).Flush();
+
+        return false;
+    }
+
+    // Only the first record creates the directory entry
+    const auto created = (0 == info.st_size);
+
+    if (false == write(file, record.data(), record.size())) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to write to ")(path_)
+            .Flush();
+        // Do not leave a partial record in front of the next one
+        ::ftruncate(file, info.st_size);
+
+        return false;
+    }
+
+    if (false == sync(file)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync ")(path_).Flush();
+
+        return false;
+    }
+
+    if (created && (false == sync(folder_, O_DIRECTORY | O_RDONLY))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to sync directory ")(
+            folder_)
+            .Flush();
+
+        return false;
+    }
+
+    ++count_;
+
+    return true;
+}
+
+auto MarketJournal::Clear() noexcept -> bool
+{
+    count_ = 0;
+
+    if (path_.empty()) { return false; }
+
+    auto ec = boost::system::error_code{};
+
+    if (false == fs::exists(path_, ec)) { return true; }
+
+    if (false == truncate(path_, 0)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to clear ")(path_)
+            .Flush();
+
+        return false;
+    }
+
+    return true;
+}
+
+auto MarketJournal::get_path(
+    const api::internal::Core& api,
+    const std::string& marketID) noexcept -> std::string
+{
+    auto folder = String::Factory();
+    auto journal = String::Factory();
+    auto output = String::Factory();
+    const auto created =
+        api.Legacy().AppendFolder(
+            folder,
+            String::Factory(api.DataFolder()),
+            String::Factory(api.Legacy().Market())) &&
+        api.Legacy().AppendFolder(
+            journal, folder, String::Factory("journal")) &&
+        api.Legacy().AppendFile(
+            output, journal, String::Factory(marketID + ".bin")) &&
+        api.Legacy().BuildFilePath(output);
+
+    if (false == created) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to create journal folder for market ")(marketID)
+            .Flush();
+
+        return {};
+    }
+
+    return output->Get();
+}
+
+auto MarketJournal::Load(
+    const identity::Nym& signer,
+    std::vector<Entry>& output) noexcept -> bool
+{
+    output.clear();
+    count_ = 0;
+
+    if (path_.empty()) { return false; }
+
+    std::ifstream file(path_, std::ios::in | std::ios::binary);
+
+    // A missing journal means nothing has changed since the last snapshot
+    if (file.fail()) { return true; }
+
+    auto size = std::uintmax_t{0};
+
+    try {
+        size = fs::file_size(path_);
+    } catch (...) {
+
+        return false;
+    }
+
+    auto good = std::uintmax_t{0};
+
+    while (true) {
+        auto header = Header{};
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+        if (file.gcount() != sizeof(header)) { break; }
+
+        const auto bytes = header.size_.value();
+        const auto sigBytes = header.signature_.value();
+
+        if ((std::uintmax_t{bytes} + sigBytes) >
+            (size - good - sizeof(header))) {
+            break;
+        }
+
+        auto entry = Entry{};
+        entry.type_ = static_cast<Type>(header.type_);
+        entry.number_ = header.number_.value();
+        entry.date_ = Clock::from_time_t(
+            static_cast<std::time_t>(header.date_.value()));
+        entry.data_.resize(bytes);
+        file.read(entry.data_.data(), bytes);
+
+        if (file.gcount() != static_cast<std::streamsize>(bytes)) { break; }
+
+        entry.signature_.resize(sigBytes);
+        file.read(entry.signature_.data(), sigBytes);
+
+        if (file.gcount() != static_cast<std::streamsize>(sigBytes)) {
+            break;
+        }
+
+        switch (entry.type_) {
+            case Type::Offer:
+            case Type::Remove:
+            case Type::Sale: {
+            } break;
+            default: {
+                LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid record in ")(
+                    path_)
+                    .Flush();
+                output.clear();
+
+                return false;
+            }
+        }
+
+        if (false == verify(signer, entry)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Invalid signature on record in ")(path_)
+                .Flush();
+            output.clear();
+
+            return false;
+        }
+
+        output.emplace_back(std::move(entry));
+        good += sizeof(header) + bytes + sigBytes;
+    }
+
+    file.close();
+
+    // The process stopped while writing the last record
+    if (good < size) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Discarding incomplete record at the end of ")(path_)
+            .Flush();
+
+        if (false == truncate(path_, good)) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to truncate ")(path_)
+                .Flush();
+            output.clear();
+
+            return false;
+        }
+    }
+
+    count_ = output.size();
+
+    return true;
+}
+
+auto MarketJournal::Preimage(const Entry& entry) noexcept -> std::string
+{
+    auto header = make_header(entry);
+    header.signature_ = 0;
+    auto output = std::string{};
+    output.reserve(sizeof(header) + entry.data_.size());
+    output.append(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.append(entry.data_);
+
+    return output;
+}
+}  // namespace opentxs
@@ -0,0 +1,108 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs
+{
+namespace api
+{
+namespace internal
+{
+struct Core;
+}  // namespace internal
+}  // namespace api
+
+namespace identity
+{
+class Nym;
+}  // namespace identity
+
+class PasswordPrompt;
+}  // namespace opentxs
+
+namespace opentxs
+{
+// Append-only log of the changes made to a market's order book since the
+// market contract was last signed and saved. Replaying the log on top of the
+// saved market reproduces the current book, so individual offer changes cost
+// O(offer) to persist instead of O(book).
+//
+// Every record is idempotent, which makes it safe to replay a log that was
+// not cleared because the process stopped between saving a new snapshot and
+// clearing the log. Every record is signed by the server, so a log which was
+// altered outside of the market is rejected instead of replayed.
+//
+// A record is synced to disk before Append returns.
+class MarketJournal
+{
+public:
+    enum class Type : std::uint8_t {
+        Error = 0,
+        Offer = 1,   // Add or replace an offer
+        Remove = 2,  // Remove an offer
+        Sale = 3,    // Update the last sale price and date
+    };
+
+    struct Entry {
+        Type type_{Type::Error};
+        // Offer transaction number, or the sale price for Sale records
+        std::int64_t number_{0};
+        // Date the offer was added to the market
+        Time date_{};
+        // Serialized offer, or the sale date for Sale records
+        std::string data_{};
+        // Server signature of Preimage()
+        std::string signature_{};
+    };
+
+    // The signed part of a record: everything except the signature
+    static auto Preimage(const Entry& entry) noexcept -> std::string;
+
+    auto Count() const noexcept -> std::size_t { return count_; }
+    auto Path() const noexcept -> const std::string& { return path_; }
+
+    // Signs the record with the signer's private key before writing it
+    auto Append(
+        const identity::Nym& signer,
+        Entry& entry,
+        const PasswordPrompt& reason) noexcept -> bool;
+    // Call after a new snapshot of the market has been saved
+    auto Clear() noexcept -> bool;
+    // Discards any incomplete record at the end of the file. Fails without
+    // modifying the file if any record is not signed by the signer.
+    auto Load(const identity::Nym& signer, std::vector<Entry>& output) noexcept
+        -> bool;
+
+    MarketJournal(
+        const api::internal::Core& api,
+        const std::string& marketID) noexcept;
+
+    ~MarketJournal() = default;
+
+private:
+    const api::internal::Core& api_;
+    const std::string path_;
+    const std::string folder_;
+    std::size_t count_;
+
+    static auto get_path(
+        const api::internal::Core& api,
+        const std::string& marketID) noexcept -> std::string;
+
+    MarketJournal() = delete;
+    MarketJournal(const MarketJournal&) = delete;
+    MarketJournal(MarketJournal&&) = delete;
+    auto operator=(const MarketJournal&) -> MarketJournal& = delete;
+    auto operator=(MarketJournal&&) -> MarketJournal& = delete;
+};
+}  // namespace opentxs
@@ -15,7 +15,9 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "core/trade/MarketJournal.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Exclusive.hpp"
 #include "opentxs/Pimpl.hpp"
@@ -44,6 +46,9 @@
 #include "opentxs/core/util/Tag.hpp"
 #include "opentxs/identity/Nym.hpp"
 
+// Number of journaled changes after which a new snapshot is saved
+#define MARKET_JOURNAL_SNAPSHOT_ENTRIES 1000
+
 #define OT_METHOD "opentxs::OTMarket::"
 
 namespace opentxs
@@ -52,8 +57,8 @@ OTMarket::OTMarket(const api::internal::Core& core, const char* szFilename)
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids(true)
+    , m_Asks(false)
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Server::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -61,6 +66,7 @@ OTMarket::OTMarket(const api::internal::Core& core, const char* szFilename)
     , m_lScale(1)
     , m_lLastSalePrice(0)
     , m_strLastSaleDate()
+    , m_pJournal(nullptr)
 {
     OT_ASSERT(nullptr != szFilename);
 
@@ -73,8 +79,8 @@ OTMarket::OTMarket(const api::internal::Core& core)
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids(true)
+    , m_Asks(false)
     , m_mapOffers()
     , m_NOTARY_ID(identifier::Server::Factory())
     , m_INSTRUMENT_DEFINITION_ID(identifier::UnitDefinition::Factory())
@@ -82,6 +88,7 @@ OTMarket::OTMarket(const api::internal::Core& core)
     , m_lScale(1)
     , m_lLastSalePrice(0)
     , m_strLastSaleDate()
+    , m_pJournal(nullptr)
 {
     InitMarket();
 }
@@ -95,8 +102,8 @@ OTMarket::OTMarket(
     : Contract(core)
     , m_pCron(nullptr)
     , m_pTradeList(nullptr)
-    , m_mapBids()
-    , m_mapAsks()
+    , m_Bids(true)
+    , m_Asks(false)
     , m_mapOffers()
     , m_NOTARY_ID(NOTARY_ID)
     , m_INSTRUMENT_DEFINITION_ID(INSTRUMENT_DEFINITION_ID)
@@ -104,6 +111,7 @@ OTMarket::OTMarket(
     , m_lScale(1)
     , m_lLastSalePrice(0)
     , m_strLastSaleDate()
+    , m_pJournal(nullptr)
 {
     InitMarket();
     SetScale(lScale);
@@ -226,8 +234,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
     tag.add_attribute("lastSalePrice", std::to_string(m_lLastSalePrice));
 
     // Save the offers for sale.
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : m_Asks) {
         OT_ASSERT(nullptr != pOffer);
 
         auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
@@ -242,8 +249,7 @@ void OTMarket::UpdateContents(const PasswordPrompt& reason)
     }
 
     // Save the bids.
-    for (auto& it : m_mapBids) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : m_Bids) {
         OT_ASSERT(nullptr != pOffer);
 
         auto strOffer = String::Factory(*pOffer);  // Extract the offer contract
@@ -267,8 +273,7 @@ auto OTMarket::GetTotalAvailableAssets() -> std::int64_t
 {
     std::int64_t lTotal = 0;
 
-    for (auto& it : m_mapAsks) {
-        OTOffer* pOffer = it.second;
+    for (auto* pOffer : m_Asks) {
         OT_ASSERT(nullptr != pOffer);
 
         lTotal += pOffer->GetAmountAvailable();
@@ -469,17 +474,13 @@ auto OTMarket::GetOfferList(
         dynamic_cast<OTDB::OfferListMarket*>(
             OTDB::CreateObject(OTDB::STORED_OBJ_OFFER_LIST_MARKET)));
 
-    //    mapOfOffers            m_mapBids;        // The buyers, ordered by
-    // price limit
-    //    mapOfOffers            m_mapAsks;        // The sellers, ordered by
-    // price limit
+    // Both sides are listed best price first
 
     std::int32_t nTempDepth = 0;
 
-    for (auto& it : m_mapBids) {
+    for (auto* pOffer : m_Bids) {
         if (nTempDepth++ > lDepth) break;
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         const std::int64_t& lPriceLimit = pOffer->GetPriceLimit();
@@ -512,10 +513,9 @@ auto OTMarket::GetOfferList(
 
     nTempDepth = 0;
 
-    for (auto& it : m_mapAsks) {
+    for (auto* pOffer : m_Asks) {
         if (nTempDepth++ > lDepth) break;
 
-        OTOffer* pOffer = it.second;
         OT_ASSERT(nullptr != pOffer);
 
         // OfferDataMarket"
@@ -589,18 +589,6 @@ auto OTMarket::GetOfferList(
     return false;
 }
 
-// To insure that offers of a specific price are always inserted at the upper
-// bound,
-// use this:  my_mmap.insert(my_mmap.upper_bound(key), my_mmap::value_type(key,
-// val));
-// This way I can read them from the lower bound later, and always get them in
-// the
-// order received for that price.
-//
-// typedef std::multimap<std::int64_t, OTOffer *>    mapOfOffers;
-// mapOfOffers    m_mapBids; // The buyers, ordered
-// mapOfOffers    m_mapAsks; // The sellers, ordered
-
 auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 {
     // See if there's something there with that transaction number.
@@ -633,6 +621,16 @@ auto OTMarket::GetOffer(const std::int64_t& lTransactionNum) -> OTOffer*
 auto OTMarket::RemoveOffer(
     const std::int64_t& lTransactionNum,
     const PasswordPrompt& reason) -> bool
+{
+    if (erase_offer(lTransactionNum)) {
+        return journal_removal(lTransactionNum, reason);
+    }
+
+    return false;
+}
+
+// Removes the offer from memory without saving anything
+auto OTMarket::erase_offer(const std::int64_t& lTransactionNum) -> bool
 {
     bool bReturnValue = false;
 
@@ -658,35 +656,10 @@ auto OTMarket::RemoveOffer(
         // But it's still on one of the other lists...
         m_mapOffers.erase(it);
 
-        // The code operates the same whether ask or bid. Just use a pointer.
-        mapOfOffers* pMap = (pOffer->IsBid() ? &m_mapBids : &m_mapAsks);
-
-        // Future solution here: instead of looping through all the offers and
-        // finding it,
-        // I could just have each Offer store a copy of the iterator that's
-        // returned when
-        // it's first inserted. Later I just erase that iterator from the right
-        // list to remove. Todo.
-        OTOffer* pSameOffer = nullptr;
-
-        for (auto iii = pMap->begin(); iii != pMap->end(); ++iii) {
-            pSameOffer = iii->second;
-
-            OT_ASSERT_MSG(
-                nullptr != pSameOffer,
-                "nullptr offer pointer in OTMarket::RemoveOffer.\n");
-
-            // found it!
-            if (lTransactionNum == pSameOffer->GetTransactionNum()) {
-                pMap->erase(iii);
-                break;
-            }
-
-            // Later on, below this loop, this pointer will be nullptr or not,
-            // and
-            // I will know if it was removed.
-            pSameOffer = nullptr;
-        }
+        // The code operates the same whether ask or bid.
+        auto& book = (pOffer->IsBid() ? m_Bids : m_Asks);
+        OTOffer* pSameOffer =
+            book.Remove(pOffer->GetPriceLimit(), lTransactionNum);
 
         if (nullptr == pSameOffer) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
@@ -712,10 +685,7 @@ auto OTMarket::RemoveOffer(
         pSameOffer = nullptr;
     }
 
-    if (bReturnValue)
-        return SaveMarket(reason);  // <====== SAVE since an offer was removed.
-    else
-        return false;
+    return bReturnValue;
 }
 
 // This method demands an Offer reference in order to verify that it really
@@ -732,8 +702,7 @@ auto OTMarket::AddOffer(
     const bool bSaveFile,
     const Time tDateAddedToMarket) -> bool
 {
-    const std::int64_t lTransactionNum = theOffer.GetTransactionNum(),
-                       lPriceLimit = theOffer.GetPriceLimit();
+    const std::int64_t lTransactionNum = theOffer.GetTransactionNum();
 
     // Make sure the offer is even appropriate for this market...
     if (!ValidateOfferForMarket(theOffer)) {
@@ -773,47 +742,48 @@ auto OTMarket::AddOffer(
         // know it validated as an offer, AND we know it wasn't already on the
         // market.
         //
-        // So next, let's add it to the lists that are indexed by price:
+        // So next, let's add it to the lists that are indexed by price.
+        // The date determines the offer's place in line at its price, so set
+        // it first.
+        if (bSaveFile) {
+            // Set this to the current date/time, since the offer is
+            // being added for the first time.
+            //
+            theOffer.SetDateAddedToMarket(Clock::now());
+        } else {
+            // Set this to the date passed in, since this offer was
+            // added to the market in the past, and we are preserving that date.
+            theOffer.SetDateAddedToMarket(tDateAddedToMarket);
+        }
 
         // Determine if it's a buy or sell, and add it to the right list.
+        // No bother checking if the offer is already on this list, since the
+        // code above basically already verifies that for us.
         if (theOffer.IsBid()) {
-            // No bother checking if the offer is already on this list,
-            // since the code above basically already verifies that for us.
-
-            m_mapBids.insert(
-                m_mapBids.lower_bound(lPriceLimit),  // highest bidders go
-                                                     // first, so I am last in
-                                                     // line at lower bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            m_Bids.Add(theOffer);
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as a bid to the market.")
                 .Flush();
         } else {
-            m_mapAsks.insert(
-                m_mapAsks.upper_bound(lPriceLimit),  // lowest price sells
-                                                     // first, so I am last in
-                                                     // line at upper bound.
-                std::pair<std::int64_t, OTOffer*>(lPriceLimit, &theOffer));
+            m_Asks.Add(theOffer);
             LogTrace(OT_METHOD)(__FUNCTION__)(
                 "Offer added as an ask to the market.")
                 .Flush();
         }
 
         if (bSaveFile) {
-            // Set this to the current date/time, since the offer is
-            // being added for the first time.
-            //
-            theOffer.SetDateAddedToMarket(Clock::now());
-
-            return SaveMarket(reason);  // <====== SAVE since an offer
-                                        // was added to the Market.
-        } else {
-            // Set this to the date passed in, since this offer was
-            // added to the market in the past, and we are preserving that date.
-            theOffer.SetDateAddedToMarket(tDateAddedToMarket);
-
-            return true;
+            // The market only stores offers signed by the server, so they can
+            // be verified later without loading the nym which placed them.
+            theOffer.ReleaseSignatures();
+            theOffer.SignContract(*(GetCron()->GetServerNym()), reason);
+            theOffer.SaveContract();
+
+            return SaveOffer(theOffer, reason);  // <====== SAVE since an
+                                                 // offer was added to the
+                                                 // Market.
         }
+
+        return true;
     }
 
     return false;
@@ -837,6 +807,9 @@ auto OTMarket::LoadMarket() -> bool
 
     if (bSuccess) bSuccess = VerifySignature(*(GetCron()->GetServerNym()));
 
+    // Apply the changes made since the snapshot was saved
+    if (bSuccess) bSuccess = replay_journal();
+
     // Load the list of recent market trades (informational only.)
     //
     if (bSuccess) {
@@ -888,9 +861,22 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
         return false;
     }
 
-    // Save a copy of recent trades.
+    // The snapshot now contains every journaled change. OTDB backends commit
+    // a value before reporting success, so the snapshot is durable by now.
+    journal().Clear();
+    save_trade_list();
+
+    return true;
+}
 
+// Save a copy of recent trades.
+void OTMarket::save_trade_list()
+{
     if (nullptr != m_pTradeList) {
+        auto MARKET_ID = Identifier::Factory(*this);
+        auto str_MARKET_ID = String::Factory(MARKET_ID);
+        const char* szFoldername = api_.Legacy().Market();
+        const char* szFilename = str_MARKET_ID->Get();
 
         auto str_TRADES_FILE = String::Factory();
         str_TRADES_FILE->Format("%s.bin", str_MARKET_ID->Get());
@@ -911,6 +897,140 @@ auto OTMarket::SaveMarket(const PasswordPrompt& reason) -> bool
                 PathSeparator())(szSubFolder)(PathSeparator())(szFilename)(".")
                 .Flush();
     }
+}
+
+auto OTMarket::SaveOffer(const OTOffer& theOffer, const PasswordPrompt& reason)
+    -> bool
+{
+    auto entry = MarketJournal::Entry{};
+    entry.type_ = MarketJournal::Type::Offer;
+    entry.number_ = theOffer.GetTransactionNum();
+    entry.date_ = theOffer.GetDateAddedToMarket();
+    entry.data_ = String::Factory(theOffer)->Get();
+
+    const auto appended =
+        journal().Append(*GetCron()->GetServerNym(), entry, reason);
+
+    return journaled(appended, reason);
+}
+
+auto OTMarket::journal() -> MarketJournal&
+{
+    if (false == bool(m_pJournal)) {
+        m_pJournal = std::make_unique<MarketJournal>(
+            api_, String::Factory(Identifier::Factory(*this))->Get());
+    }
+
+    OT_ASSERT(m_pJournal);
+
+    return *m_pJournal;
+}
+
+auto OTMarket::journaled(const bool bAppended, const PasswordPrompt& reason)
+    -> bool
+{
+    if (bAppended && (journal().Count() < MARKET_JOURNAL_SNAPSHOT_ENTRIES)) {
+        return true;
+    }
+
+    return SaveMarket(reason);
+}
+
+auto OTMarket::journal_removal(
+    const std::int64_t& lTransactionNum,
+    const PasswordPrompt& reason) -> bool
+{
+    auto entry = MarketJournal::Entry{};
+    entry.type_ = MarketJournal::Type::Remove;
+    entry.number_ = lTransactionNum;
+
+    const auto appended =
+        journal().Append(*GetCron()->GetServerNym(), entry, reason);
+
+    return journaled(appended, reason);
+}
+
+auto OTMarket::journal_sale(const PasswordPrompt& reason) -> bool
+{
+    auto entry = MarketJournal::Entry{};
+    entry.type_ = MarketJournal::Type::Sale;
+    entry.number_ = m_lLastSalePrice;
+    entry.data_ = m_strLastSaleDate;
+
+    const auto appended =
+        journal().Append(*GetCron()->GetServerNym(), entry, reason);
+
+    return journaled(appended, reason);
+}
+
+auto OTMarket::replay_journal() -> bool
+{
+    auto entries = std::vector<MarketJournal::Entry>{};
+
+    if (false == journal().Load(*GetCron()->GetServerNym(), entries)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load market journal.")
+            .Flush();
+
+        return false;
+    }
+
+    // Replaying a change which is already part of the snapshot is harmless
+    for (const auto& entry : entries) {
+        switch (entry.type_) {
+            case MarketJournal::Type::Offer: {
+                auto pOffer{api_.Factory().Offer(
+                    m_NOTARY_ID,
+                    m_INSTRUMENT_DEFINITION_ID,
+                    m_CURRENCY_TYPE_ID,
+                    m_lScale)};
+
+                OT_ASSERT(false != bool(pOffer));
+
+                const auto valid =
+                    pOffer->LoadContractFromString(
+                        String::Factory(entry.data_)) &&
+                    (entry.number_ == pOffer->GetTransactionNum()) &&
+                    pOffer->VerifySignature(*GetCron()->GetServerNym());
+
+                if (false == valid) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Invalid offer in market journal.")
+                        .Flush();
+
+                    return false;
+                }
+
+                if (nullptr != GetOffer(entry.number_)) {
+                    erase_offer(entry.number_);
+                }
+
+                auto reason = api_.Factory().PasswordPrompt(__FUNCTION__);
+
+                if (false ==
+                    AddOffer(nullptr, *pOffer, reason, false, entry.date_)) {
+                    LogOutput(OT_METHOD)(__FUNCTION__)(
+                        ": Error adding journaled offer to market.")
+                        .Flush();
+
+                    return false;
+                }
+
+                pOffer.release();
+            } break;
+            case MarketJournal::Type::Remove: {
+                if (nullptr != GetOffer(entry.number_)) {
+                    erase_offer(entry.number_);
+                }
+            } break;
+            case MarketJournal::Type::Sale: {
+                m_lLastSalePrice = entry.number_;
+                m_strLastSaleDate = entry.data_;
+            } break;
+            default: {
+                OT_FAIL;
+            }
+        }
+    }
 
     return true;
 }
@@ -941,44 +1061,20 @@ void OTMarket::GetIdentifier(Identifier& theIdentifier) const
 // bid on the market.
 auto OTMarket::GetHighestBidPrice() -> std::int64_t
 {
-    std::int64_t lPrice = 0;
-
-    auto rr = m_mapBids.rbegin();
-
-    if (rr != m_mapBids.rend()) { lPrice = rr->first; }
-
-    return lPrice;
+    return m_Bids.BestPrice();
 }
 
 // returns 0 if there are no asks. Otherwise returns the value of the lowest ask
 // on the market.
 auto OTMarket::GetLowestAskPrice() -> std::int64_t
 {
-    std::int64_t lPrice = 0;
-
-    auto it = m_mapAsks.begin();
-
-    if (it != m_mapAsks.end()) {
-        lPrice = it->first;
-
-        // Market orders have a 0 price, so we need to skip any if they are
-        // here.
-        //
-        // Note that we don't have to do this with the highest bid price (above
-        // function) but in the case of asks, a "0 price" will undercut the
-        // other
-        // actual prices, so we need to skip any that have a 0 price.
-        //
-        while (0 == lPrice) {
-            ++it;
-
-            if (it == m_mapAsks.end()) break;
-
-            lPrice = it->first;
-        }
-    }
-
-    return lPrice;
+    // Market orders have a 0 price, so we need to skip any if they are
+    // here.
+    //
+    // Note that we don't have to do this with the highest bid price (above
+    // function) but in the case of asks, a "0 price" will undercut the other
+    // actual prices, so we need to skip any that have a 0 price.
+    return m_Asks.BestLimitPrice();
 }
 
 // This utility function is used directly below (only).
@@ -1938,10 +2034,12 @@ void OTMarket::ProcessTrade(
                 }
 
                 // Account balances have changed based on these trades
-                // that we just processed. Make sure to save the Market
-                // since it contains those offers that have just
-                // updated.
-                SaveMarket(reason);
+                // that we just processed. Make sure to save the offers
+                // that have just updated, along with the sale.
+                SaveOffer(theOffer, reason);
+                SaveOffer(theOtherOffer, reason);
+                journal_sale(reason);
+                save_trade_list();
 
                 // The Trade has changed, and it is stored as a
                 // CronItem. So I save Cron as well, for the same reason
@@ -2426,16 +2524,12 @@ auto OTMarket::ProcessTrade(
 
     if (theOffer.IsAsk())  // If I'm selling,
     {
-        // rbegin puts us on the upper bound of the highest bidder (any
-        // new bidders at the same price would be added at the lower
-        // bound, where they are last in line.) The upper bound, on the
-        // other hand, is first in line.  So we start there, and loop
-        // backwards until there are no other bids within my price
-        // range.
-        for (auto rr = m_mapBids.rbegin(); rr != m_mapBids.rend(); ++rr) {
+        // The book starts with the oldest bid at the highest price, which
+        // is first in line, and continues down until there are no other
+        // bids within my price range.
+        for (auto* pBid : m_Bids) {
             // then I want to start at the highest bidder and loop DOWN
             // until hitting my price limit.
-            OTOffer* pBid = rr->second;
             OT_ASSERT(nullptr != pBid);
 
             // NOTE: Market orders only process once, and they are
@@ -2500,7 +2594,6 @@ auto OTMarket::ProcessTrade(
             // all the remaining bids are even lower.)
             //
             else if (theOffer.IsLimitOrder()) {
-                pBid = nullptr;
                 return true;  // stay on cron for more processing (for
                               // now.)
             }
@@ -2522,23 +2615,17 @@ auto OTMarket::ProcessTrade(
 
                 return false;  // remove this trade from cron
             }
-
-            pBid = nullptr;
         }
     }
     // I'm buying
     else {
-        // Begin puts us on the lower bound of the lowest seller (any
-        // new sellers at the same price would be added at the upper
-        // bound for that price, where they are last in line.) The lower
-        // bound, on the other hand, is first in line.  So we start
-        // there, and loop forwards until there are no other asks within
-        // my price range.
+        // The book starts with the oldest ask at the lowest price, which
+        // is first in line, and continues up until there are no other
+        // asks within my price range.
         //
-        for (auto& it : m_mapAsks) {
+        for (auto* pAsk : m_Asks) {
             // then I want to start at the lowest seller and loop UP
             // until hitting my price limit.
-            OTOffer* pAsk = it.second;
             OT_ASSERT(nullptr != pAsk);
 
             // NOTE: Market orders only process once, and they are
@@ -2588,7 +2675,6 @@ auto OTMarket::ProcessTrade(
             // Else, the ask price is higher than I am willing to pay.
             // (And all the remaining sellers are even HIGHER.)
             else if (theOffer.IsLimitOrder()) {
-                pAsk = nullptr;
                 return true;  // stay on the market for now.
             }
 
@@ -2609,8 +2695,6 @@ auto OTMarket::ProcessTrade(
 
                 return false;  // remove this trade from the market.
             }
-
-            pAsk = nullptr;
         }
     }
 
@@ -2724,18 +2808,11 @@ void OTMarket::Release_Market()
 
     // If there were any dynamically allocated objects, clean them up
     // here.
-    while (!m_mapBids.empty()) {
-        OTOffer* pOffer = m_mapBids.begin()->second;
-        m_mapBids.erase(m_mapBids.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
-    while (!m_mapAsks.empty()) {
-        OTOffer* pOffer = m_mapAsks.begin()->second;
-        m_mapAsks.erase(m_mapAsks.begin());
-        delete pOffer;
-        pOffer = nullptr;
-    }
+    m_mapOffers.clear();
+
+    while (auto* pOffer = m_Bids.Pop()) { delete pOffer; }
+
+    while (auto* pOffer = m_Asks.Pop()) { delete pOffer; }
 }
 
 void OTMarket::Release()
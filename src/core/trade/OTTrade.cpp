@@ -551,15 +551,10 @@ auto OTTrade::GetOffer(
             // Trade is FIRST added to cron,
             // so it's already safe before we even get here.
             //
-            // So thus I am FREE to release the signatures on the offer, and
-            // sign with the server instead.
-            // The server-signed offer will be stored by the OTMarket.
-            offer_->ReleaseSignatures();
-            offer_->SignContract(*(GetCron()->GetServerNym()), reason);
-            offer_->SaveContract();
-
-            pMarket->SaveMarket(reason);
-
+            // So thus the market was FREE to release the signatures on the
+            // offer, and sign with the server instead.
+            // The server-signed offer is stored by the OTMarket.
+            //
             // Now when the market loads next time, it can verify this offer
             // using the server's signature,
             // instead of having to load the user. Because the server has
@@ -620,15 +615,10 @@ auto OTTrade::GetOffer(
                 // the Trade is FIRST added to cron,
                 // so it's already safe before we even get here.
                 //
-                // So thus I am FREE to release the signatures on the offer, and
-                // sign with the server instead.
-                // The server-signed offer will be stored by the OTMarket.
-                offer_->ReleaseSignatures();
-                offer_->SignContract(*(GetCron()->GetServerNym()), reason);
-                offer_->SaveContract();
-
-                pMarket->SaveMarket(reason);
-
+                // So thus the market was FREE to release the signatures on the
+                // offer, and sign with the server instead.
+                // The server-signed offer is stored by the OTMarket.
+                //
                 // Now when the market loads next time, it can verify this offer
                 // using the server's signature,
                 // instead of having to load the user. Because the server has
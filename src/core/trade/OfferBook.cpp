@@ -0,0 +1,192 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                      // IWYU pragma: associated
+#include "1_Internal.hpp"                    // IWYU pragma: associated
+#include "opentxs/core/trade/OfferBook.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "opentxs/Types.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+
+namespace opentxs
+{
+OfferBook::OfferBook(const bool bids)
+    : bids_(bids)
+    , levels_()
+    , count_(0)
+{
+}
+
+OfferBook::const_iterator::const_iterator(
+    const Levels& levels,
+    const std::size_t level)
+    : levels_(&levels)
+    , level_(level)
+    , offer_(0)
+{
+}
+
+auto OfferBook::const_iterator::operator*() const -> reference
+{
+    return levels_->at(levels_->size() - level_ - 1).offers_.at(offer_);
+}
+
+auto OfferBook::const_iterator::operator++() -> const_iterator&
+{
+    const auto& level = levels_->at(levels_->size() - level_ - 1);
+
+    if (++offer_ >= level.offers_.size()) {
+        ++level_;
+        offer_ = 0;
+    }
+
+    return *this;
+}
+
+auto OfferBook::const_iterator::operator++(int) -> const_iterator
+{
+    auto output{*this};
+    ++(*this);
+
+    return output;
+}
+
+auto OfferBook::const_iterator::operator==(const const_iterator& rhs) const
+    -> bool
+{
+    return (levels_ == rhs.levels_) && (level_ == rhs.level_) &&
+           (offer_ == rhs.offer_);
+}
+
+auto OfferBook::const_iterator::operator!=(const const_iterator& rhs) const
+    -> bool
+{
+    return false == (*this == rhs);
+}
+
+void OfferBook::Add(OTOffer& theOffer)
+{
+    const auto& lPriceLimit = theOffer.GetPriceLimit();
+    auto level = find(lPriceLimit);
+
+    if ((levels_.end() == level) || (level->price_ != lPriceLimit)) {
+        level = levels_.insert(level, Level{lPriceLimit, {}});
+    }
+
+    // Offers are almost always added in time order, but a market being
+    // loaded from storage may add them in any order. Transaction number
+    // breaks ties between offers added in the same second.
+    auto& offers = level->offers_;
+    const auto date = theOffer.GetDateAddedToMarket();
+    const auto number = theOffer.GetTransactionNum();
+    auto position = offers.end();
+
+    while (offers.begin() != position) {
+        const auto* previous = *std::prev(position);
+        const auto previousDate = previous->GetDateAddedToMarket();
+
+        if ((previousDate < date) ||
+            ((previousDate == date) &&
+             (previous->GetTransactionNum() < number))) {
+            break;
+        }
+
+        --position;
+    }
+
+    offers.insert(position, &theOffer);
+    ++count_;
+}
+
+auto OfferBook::begin() const -> const_iterator
+{
+    return const_iterator(levels_, 0);
+}
+
+auto OfferBook::BestLimitPrice() const -> std::int64_t
+{
+    for (auto level = levels_.rbegin(); level != levels_.rend(); ++level) {
+        if (0 != level->price_) { return level->price_; }
+    }
+
+    return 0;
+}
+
+auto OfferBook::BestPrice() const -> std::int64_t
+{
+    if (levels_.empty()) { return 0; }
+
+    return levels_.back().price_;
+}
+
+auto OfferBook::better(const std::int64_t& lhs, const std::int64_t& rhs) const
+    -> bool
+{
+    return bids_ ? (lhs > rhs) : (lhs < rhs);
+}
+
+auto OfferBook::end() const -> const_iterator
+{
+    return const_iterator(levels_, levels_.size());
+}
+
+auto OfferBook::find(const std::int64_t& lPriceLimit) -> Levels::iterator
+{
+    return std::lower_bound(
+        levels_.begin(),
+        levels_.end(),
+        lPriceLimit,
+        [this](const auto& level, const auto& price) -> bool {
+            return better(price, level.price_);
+        });
+}
+
+auto OfferBook::Pop() -> OTOffer*
+{
+    if (levels_.empty()) { return nullptr; }
+
+    auto& offers = levels_.back().offers_;
+
+    OT_ASSERT(false == offers.empty());
+
+    auto* output = offers.back();
+    offers.pop_back();
+    --count_;
+
+    if (offers.empty()) { levels_.pop_back(); }
+
+    return output;
+}
+
+auto OfferBook::Remove(
+    const std::int64_t& lPriceLimit,
+    const std::int64_t& lTransactionNum) -> OTOffer*
+{
+    auto level = find(lPriceLimit);
+
+    if ((levels_.end() == level) || (level->price_ != lPriceLimit)) {
+        return nullptr;
+    }
+
+    auto& offers = level->offers_;
+    const auto offer = std::find_if(
+        offers.begin(), offers.end(), [&](const auto* item) -> bool {
+            return lTransactionNum == item->GetTransactionNum();
+        });
+
+    if (offers.end() == offer) { return nullptr; }
+
+    auto* output = *offer;
+    offers.erase(offer);
+    --count_;
+
+    if (offers.empty()) { levels_.erase(level); }
+
+    return output;
+}
+}  // namespace opentxs
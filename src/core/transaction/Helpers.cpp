@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <string>
 
+#include "core/transaction/ReceiptCache.hpp"
 #include "internal/api/Api.hpp"
 #include "opentxs/Pimpl.hpp"
 #include "opentxs/Types.hpp"
@@ -393,31 +394,44 @@ auto LoadBoxReceipt(
             strFilename))
         return nullptr;  // This already logs -- no need to log twice, here.
 
-    // See if the box receipt exists before trying to load it...
-    //
-    if (!OTDB::Exists(
+    auto& cache = ReceiptCache::Get();
+    const auto key = ReceiptCache::Key(
+        api.DataFolder(),
+        strFolder1name,
+        strFolder2name,
+        strFolder3name,
+        strFilename);
+    std::string strFileContents{};
+
+    if (false == cache.Find(key, strFileContents)) {
+        // See if the box receipt exists before trying to load it...
+        //
+        if (!OTDB::Exists(
+                api,
+                api.DataFolder(),
+                strFolder1name->Get(),
+                strFolder2name->Get(),
+                strFolder3name->Get(),
+                strFilename->Get())) {
+            LogDetail(OT_METHOD)(__FUNCTION__)(
+                ": Box receipt does not exist: ")(strFolder1name)(
+                PathSeparator())(strFolder2name)(PathSeparator())(
+                strFolder3name)(PathSeparator())(strFilename)
+                .Flush();
+            return nullptr;
+        }
+
+        // Try to load the box receipt from local storage.
+        //
+        strFileContents = OTDB::QueryPlainString(
             api,
             api.DataFolder(),
-            strFolder1name->Get(),
+            strFolder1name->Get(),  // <=== LOADING FROM DATA STORE.
             strFolder2name->Get(),
             strFolder3name->Get(),
-            strFilename->Get())) {
-        LogDetail(OT_METHOD)(__FUNCTION__)(": Box receipt does not exist: ")(
-            strFolder1name)(PathSeparator())(strFolder2name)(PathSeparator())(
-            strFolder3name)(PathSeparator())(strFilename)
-            .Flush();
-        return nullptr;
+            strFilename->Get());
     }
 
-    // Try to load the box receipt from local storage.
-    //
-    std::string strFileContents(OTDB::QueryPlainString(
-        api,
-        api.DataFolder(),
-        strFolder1name->Get(),  // <=== LOADING FROM DATA STORE.
-        strFolder2name->Get(),
-        strFolder3name->Get(),
-        strFilename->Get()));
     if (strFileContents.length() < 2) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Error reading file: ")(
             strFolder1name)(PathSeparator())(strFolder2name)(PathSeparator())(
@@ -487,6 +501,8 @@ auto LoadBoxReceipt(
             PathSeparator())(strFilename)
             .Flush();
 
+    cache.Add(key, strFileContents);
+
     // Todo: security analysis. By this point we've verified the hash of the
     // transaction against the stored
     // hash inside the abbreviated version. (VerifyBoxReceipt) We've also
@@ -0,0 +1,95 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "core/transaction/ReceiptCache.hpp"  // IWYU pragma: associated
+
+#include "opentxs/core/String.hpp"
+
+namespace opentxs
+{
+ReceiptCache::ReceiptCache(const std::size_t limit) noexcept
+    : limit_(limit)
+    , lock_()
+    , bytes_(0)
+    , entries_()
+    , index_()
+{
+}
+
+auto ReceiptCache::Add(
+    const std::string& key,
+    const std::string& receipt) noexcept -> void
+{
+    Lock lock(lock_);
+
+    if (auto it = index_.find(key); index_.end() != it) { erase(lock, it); }
+
+    if (receipt.size() > limit_) { return; }
+
+    entries_.emplace_front(key, receipt);
+    index_.emplace(key, entries_.begin());
+    bytes_ += receipt.size();
+
+    while (bytes_ > limit_) {
+        erase(lock, index_.find(entries_.back().first));
+    }
+}
+
+auto ReceiptCache::Erase(const std::string& key) noexcept -> void
+{
+    Lock lock(lock_);
+
+    if (auto it = index_.find(key); index_.end() != it) { erase(lock, it); }
+}
+
+auto ReceiptCache::erase(const Lock&, Index::iterator it) noexcept -> void
+{
+    bytes_ -= it->second->second.size();
+    entries_.erase(it->second);
+    index_.erase(it);
+}
+
+auto ReceiptCache::Find(const std::string& key, std::string& output) noexcept
+    -> bool
+{
+    Lock lock(lock_);
+    const auto it = index_.find(key);
+
+    if (index_.end() == it) { return false; }
+
+    entries_.splice(entries_.begin(), entries_, it->second);
+    output = it->second->second;
+
+    return true;
+}
+
+auto ReceiptCache::Get() noexcept -> ReceiptCache&
+{
+    static auto cache = ReceiptCache{BOX_RECEIPT_CACHE_BYTES};
+
+    return cache;
+}
+
+auto ReceiptCache::Key(
+    const std::string& dataFolder,
+    const String& folder1,
+    const String& folder2,
+    const String& folder3,
+    const String& filename) noexcept -> std::string
+{
+    auto output = dataFolder;
+    output += folder1.Get();
+    output += '/';
+    output += folder2.Get();
+    output += '/';
+    output += folder3.Get();
+    output += '/';
+    output += filename.Get();
+
+    return output;
+}
+}  // namespace opentxs
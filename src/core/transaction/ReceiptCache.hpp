@@ -0,0 +1,74 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "opentxs/Types.hpp"
+
+#define BOX_RECEIPT_CACHE_BYTES 32u * 1024u * 1024u
+
+namespace opentxs
+{
+class String;
+}  // namespace opentxs
+
+namespace opentxs
+{
+// Contents of recently loaded or saved box receipts, shared by every session
+// in the process.
+//
+// Entries are keyed by the storage location of the receipt, which ends with
+// its transaction number. The least recently used entries are evicted once
+// the combined size of the cached receipts exceeds the limit.
+class ReceiptCache
+{
+public:
+    OPENTXS_EXPORT static auto Get() noexcept -> ReceiptCache&;
+    OPENTXS_EXPORT static auto Key(
+        const std::string& dataFolder,
+        const String& folder1,
+        const String& folder2,
+        const String& folder3,
+        const String& filename) noexcept -> std::string;
+
+    OPENTXS_EXPORT auto Add(
+        const std::string& key,
+        const std::string& receipt) noexcept -> void;
+    OPENTXS_EXPORT auto Erase(const std::string& key) noexcept -> void;
+    OPENTXS_EXPORT auto Find(
+        const std::string& key,
+        std::string& output) noexcept -> bool;
+
+    OPENTXS_EXPORT explicit ReceiptCache(const std::size_t limit) noexcept;
+
+    OPENTXS_EXPORT ~ReceiptCache() = default;
+
+private:
+    using Entries = std::list<std::pair<std::string, std::string>>;
+    using Index = std::map<std::string, Entries::iterator>;
+
+    const std::size_t limit_;
+    std::mutex lock_;
+    std::size_t bytes_;
+    // Most recently used first
+    Entries entries_;
+    Index index_;
+
+    auto erase(const Lock& lock, Index::iterator it) noexcept -> void;
+
+    ReceiptCache() = delete;
+    ReceiptCache(const ReceiptCache&) = delete;
+    ReceiptCache(ReceiptCache&&) = delete;
+    auto operator=(const ReceiptCache&) -> ReceiptCache& = delete;
+    auto operator=(ReceiptCache&&) -> ReceiptCache& = delete;
+};
+}  // namespace opentxs
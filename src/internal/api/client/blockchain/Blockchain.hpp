@@ -137,6 +137,8 @@ using FilterData =
 using FilterHash = opentxs::blockchain::client::internal::FilterDatabase::Hash;
 using FilterHeader =
     opentxs::blockchain::client::internal::FilterDatabase::Header;
+using FilterReader =
+    opentxs::blockchain::client::internal::FilterDatabase::FilterReader;
 using FilterType = opentxs::blockchain::filter::Type;
 using Position = opentxs::blockchain::block::Position;
 using Protocol = opentxs::blockchain::p2p::Protocol;
@@ -161,6 +163,7 @@ enum Table {
     Config = 13,
     BlockIndex = 14,
     Enabled = 15,
+    BlockPins = 16,
 };
 }  // namespace opentxs::api::client::blockchain
 #endif  // OT_BLOCKCHAIN
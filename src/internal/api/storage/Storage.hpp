@@ -12,6 +12,11 @@ namespace opentxs::api::storage
 class StorageInternal : virtual public Storage
 {
 public:
+    /** Writes any deferred changes to the storage tree and commits the root
+     *
+     *  Only has an effect when write-back mode is enabled.
+     */
+    virtual auto Flush() const -> bool = 0;
     virtual void InitBackup() = 0;
     virtual void InitEncryptedBackup(opentxs::crypto::key::Symmetric& key) = 0;
     virtual void start() = 0;
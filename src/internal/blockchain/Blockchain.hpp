@@ -71,12 +71,10 @@ OPENTXS_EXPORT auto GolombEncode(
     const std::uint8_t P,
     const std::vector<std::uint64_t>& hashedSet) noexcept(false) -> Space;
 OPENTXS_EXPORT auto HashToRange(
-    const api::Core& api,
     const ReadView key,
     const std::uint64_t range,
     const ReadView item) noexcept(false) -> std::uint64_t;
 OPENTXS_EXPORT auto HashedSetConstruct(
-    const api::Core& api,
     const ReadView key,
     const std::uint32_t N,
     const std::uint32_t M,
@@ -147,6 +145,25 @@ struct SerializedBloomFilter {
     SerializedBloomFilter() noexcept;
 };
 
+// Fixed size prefix of the flat storage record for a GCS. The encoded filter
+// immediately follows the prefix.
+struct SerializedGCS {
+    static constexpr auto current_version_ = std::uint8_t{1};
+
+    be::little_uint8_buf_t version_;
+    be::little_uint8_buf_t bits_;
+    be::little_uint32_buf_t fp_rate_;
+    be::little_uint32_buf_t count_;
+    std::array<std::uint8_t, 16> key_;
+
+    SerializedGCS(
+        const std::uint8_t bits,
+        const std::uint32_t fpRate,
+        const std::uint32_t count,
+        const ReadView key) noexcept(false);
+    SerializedGCS() noexcept;
+};
+
 struct Database : virtual public client::internal::BlockDatabase,
                   virtual public client::internal::FilterDatabase,
                   virtual public client::internal::HeaderDatabase,
@@ -161,6 +178,11 @@ using FilterParams = std::pair<std::uint8_t, std::uint32_t>;
 auto DefaultFilter(const Type type) noexcept -> filter::Type;
 auto DecodeSerializedCfilter(const ReadView bytes) noexcept(false)
     -> std::pair<std::uint32_t, ReadView>;
+/// Returns the record prefix and the encoded filter
+///
+/// Throws std::runtime_error if the bytes are not a flat GCS record
+auto DecodeSerializedGCS(const ReadView bytes) noexcept(false)
+    -> std::pair<SerializedGCS, ReadView>;
 auto Deserialize(const Type chain, const std::uint8_t type) noexcept
     -> filter::Type;
 auto Deserialize(const api::Core& api, const ReadView bytes) noexcept
@@ -220,6 +242,15 @@ OPENTXS_EXPORT auto GCS(
     const api::Core& api,
     const proto::GCS& serialized) noexcept
     -> std::unique_ptr<blockchain::client::GCS>;
+/// Deserializes a flat storage record, or a legacy proto::GCS record
+///
+/// If view is true and the record is in the flat format the returned object
+/// refers to serialized instead of copying it, and must not outlive it.
+OPENTXS_EXPORT auto GCS(
+    const api::Core& api,
+    const ReadView serialized,
+    const bool view = false) noexcept
+    -> std::unique_ptr<blockchain::client::GCS>;
 OPENTXS_EXPORT auto GCS(
     const api::Core& api,
     const std::uint8_t bits,
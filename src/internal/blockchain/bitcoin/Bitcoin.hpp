@@ -118,6 +118,15 @@ struct EncodedInputWitness {
 };
 
 struct EncodedTransaction {
+    /// Offsets of the parts of a serialized transaction which form the txid
+    /// preimage. The preimage consists of the version, the bytes from
+    /// inputs_ to witnesses_, and the lock time.
+    struct Layout {
+        std::size_t inputs_{};
+        std::size_t witnesses_{};
+        std::size_t size_{};
+    };
+
     be::little_int32_buf_t version_{};
     std::optional<std::byte> segwit_flag_{};
     CompactSize input_count_{};
@@ -143,6 +152,13 @@ struct EncodedTransaction {
         const api::Core& api,
         const blockchain::Type chain,
         const ReadView bytes) noexcept(false) -> EncodedTransaction;
+    /// Returns the size of the serialized transaction at the start of bytes
+    /// without copying or hashing it
+    OPENTXS_EXPORT static auto Measure(const ReadView bytes) noexcept(false)
+        -> std::size_t;
+    OPENTXS_EXPORT static auto Measure(
+        const ReadView bytes,
+        Layout& layout) noexcept(false) -> std::size_t;
 
     auto wtxid_preimage() const noexcept -> Space;
     auto txid_preimage() const noexcept -> Space;
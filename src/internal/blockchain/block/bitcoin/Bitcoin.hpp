@@ -6,7 +6,11 @@
 #pragma once
 
 #include <boost/endian/buffers.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -62,6 +66,14 @@ class Transaction;
 }  // namespace block
 }  // namespace blockchain
 
+namespace network
+{
+namespace zeromq
+{
+class Message;
+}  // namespace zeromq
+}  // namespace network
+
 namespace proto
 {
 class BlockchainBlockHeader;
@@ -71,6 +83,38 @@ class BlockchainTransactionOutput;
 
 namespace opentxs::blockchain::block::bitcoin::internal
 {
+enum class ScriptTemplate : std::uint8_t {
+    Nonstandard = 0,
+    PayToMultisig,
+    PayToPubkey,
+    PayToPubkeyHash,
+    PayToScriptHash,
+    PayToWitnessPubkeyHash,
+    PayToWitnessScriptHash,
+};
+
+/// Every push is a view of the bytes which were classified
+struct StandardScript {
+    static constexpr auto max_pushes_ = std::size_t{16};
+
+    ScriptTemplate template_{ScriptTemplate::Nonstandard};
+    std::uint8_t m_{};
+    std::size_t count_{};
+    std::array<ReadView, max_pushes_> pushes_{};
+
+    auto begin() const noexcept { return pushes_.cbegin(); }
+    auto end() const noexcept { return std::next(pushes_.cbegin(), count_); }
+    /// The pattern which full decoding would assign to the script
+    auto Pattern() const noexcept -> bitcoin::Script::Pattern;
+};
+
+/// Recognises standard output scripts from their serialized form without
+/// decoding them or allocating
+OPENTXS_EXPORT auto ClassifyScript(const ReadView bytes) noexcept
+    -> StandardScript;
+/// Joins a block parsing job submitted to the blockchain thread pool
+auto ProcessThreadPool(const network::zeromq::Message& in) noexcept -> void;
+
 struct Input : virtual public bitcoin::Input {
     using Signature = std::pair<ReadView, ReadView>;
     using Signatures = std::vector<Signature>;
@@ -8,6 +8,7 @@
 #include <boost/asio.hpp>
 #include <boost/thread/thread.hpp>
 #include <cstdint>
+#include <functional>
 #include <future>
 #include <iosfwd>
 #include <map>
@@ -203,6 +204,8 @@ namespace opentxs::blockchain::client::internal
 {
 #if OT_BLOCKCHAIN
 struct BlockDatabase {
+    /// Memory budget in bytes for recently used blocks
+    virtual auto BlockCacheLimit() const noexcept -> std::size_t = 0;
     virtual auto BlockExists(const block::Hash& block) const noexcept
         -> bool = 0;
     virtual auto BlockLoadBitcoin(const block::Hash& block) const noexcept
@@ -237,6 +240,11 @@ struct FilterDatabase {
     using Header = std::tuple<block::pHash, block::pHash, ReadView>;
     /// block hash, filter
     using Filter = std::pair<ReadView, std::unique_ptr<const GCS>>;
+    /// index of the requested block, filter or nullptr if missing
+    ///
+    /// The filter is only valid for the duration of the call. Return false to
+    /// stop reading.
+    using FilterReader = std::function<bool(const std::size_t, const GCS*)>;
 
     virtual auto BlockPolicy() const noexcept
         -> api::client::blockchain::BlockStorage = 0;
@@ -251,6 +259,15 @@ struct FilterDatabase {
         const block::Hash& block) const noexcept -> bool = 0;
     virtual auto LoadFilter(const filter::Type type, const ReadView block)
         const noexcept -> std::unique_ptr<const GCS> = 0;
+    /// Invokes cb once per requested block without copying the stored
+    /// filters. Blocks are not visited in the order they were requested.
+    ///
+    /// Returns false if the database could not be read. In that case cb is
+    /// not invoked for the blocks which were not visited.
+    virtual auto ReadFilters(
+        const filter::Type type,
+        const std::vector<block::pHash>& blocks,
+        const FilterReader cb) const noexcept -> bool = 0;
     virtual auto LoadFilterHash(const filter::Type type, const ReadView block)
         const noexcept -> Hash = 0;
     virtual auto LoadFilterHeader(const filter::Type type, const ReadView block)
@@ -279,6 +296,9 @@ struct FilterDatabase {
 
 struct FilterOracle : virtual public opentxs::blockchain::client::FilterOracle {
     using Header = FilterDatabase::Hash;
+    /// matching blocks, last block tested
+    using ScanResults =
+        std::pair<std::vector<block::Position>, std::optional<block::Position>>;
 
     static auto ProcessThreadPool(const zmq::Message& task) noexcept -> void;
 
@@ -289,6 +309,16 @@ struct FilterOracle : virtual public opentxs::blockchain::client::FilterOracle {
         const filter::Type type,
         const block::Position& position) const noexcept
         -> std::unique_ptr<const GCS> = 0;
+    /// Tests the best chain filters from first to last against targets
+    ///
+    /// The range is divided among the blockchain thread pool workers. If a
+    /// filter is missing the scan stops at that block and the filter tip is
+    /// reset as in LoadFilterOrResetTip.
+    virtual auto MatchFilters(
+        const filter::Type type,
+        const block::Height first,
+        const block::Height last,
+        const GCS::Targets& targets) const noexcept -> ScanResults = 0;
     virtual auto PreviousHeader(
         const filter::Type type,
         const block::Height& block) const noexcept -> Header = 0;
@@ -325,6 +355,12 @@ struct HeaderDatabase {
     // Throws std::out_of_range if no block at that position
     virtual auto BestBlock(const block::Height position) const noexcept(false)
         -> block::pHash = 0;
+    /// Consecutive best chain hashes beginning at start, including stop if
+    /// it is encountered. A limit of zero returns every remaining hash.
+    virtual auto BestBlocks(
+        const block::Height start,
+        const block::Hash& stop,
+        const std::size_t limit) const noexcept -> std::vector<block::pHash> = 0;
     virtual auto CurrentBest() const noexcept
         -> std::unique_ptr<block::Header> = 0;
     virtual auto CurrentCheckpoint() const noexcept -> block::Position = 0;
@@ -359,11 +395,6 @@ struct IO {
         const Space& id,
         const tcp::endpoint& endpoint,
         tcp::socket& socket) const noexcept -> void;
-    auto Receive(
-        const Space& id,
-        const OTZMQWorkType type,
-        const std::size_t bytes,
-        tcp::socket& socket) const noexcept -> void;
 
     auto AddNetwork() noexcept -> void;
     auto Shutdown() noexcept -> void;
@@ -373,19 +404,12 @@ struct IO {
 
 private:
     const api::Core& api_;
-    mutable std::mutex lock_;
     OTZMQListenCallback cb_;
     OTZMQRouterSocket socket_;
-    mutable int next_buffer_;
-    mutable std::map<int, Space> buffers_;
     mutable boost::asio::io_context context_;
     std::unique_ptr<boost::asio::io_context::work> work_;
     boost::thread_group thread_pool_;
 
-    auto clear_buffer(const int id) const noexcept -> void;
-    auto get_buffer(const std::size_t bytes) const noexcept
-        -> std::pair<int, WritableView>;
-
     auto callback(zmq::Message& in) noexcept -> void;
 
     IO() = delete;
@@ -538,6 +562,7 @@ struct ThreadPool {
     enum class Work : OTZMQWorkType {
         Wallet = OT_ZMQ_INTERNAL_SIGNAL + 0,
         FilterOracle = OT_ZMQ_INTERNAL_SIGNAL + 1,
+        BlockParser = OT_ZMQ_INTERNAL_SIGNAL + 2,
     };
 
     static auto Capacity() noexcept -> std::size_t;
@@ -611,6 +636,9 @@ struct WalletDatabase {
         const Identifier& id,
         const proto::BlockchainTransactionProposal& tx) const noexcept
         -> bool = 0;
+    // Marks a block which contains wallet activity as exempt from pruning
+    virtual auto BlockPin(const block::Hash& block) const noexcept
+        -> bool = 0;
     virtual auto CancelProposal(const Identifier& id) const noexcept
         -> bool = 0;
     virtual auto CompletedProposals() const noexcept
@@ -67,6 +67,14 @@ auto PullSocket(
     const bool direction,
     const network::zeromq::ListenCallback& callback)
     -> network::zeromq::socket::Pull*;
+/// If reactor is false the callback gets a private worker thread instead of
+/// sharing the context reactor. Clear it for callbacks which run long or
+/// which wait on another socket.
+auto PullSocket(
+    const network::zeromq::Context& context,
+    const bool direction,
+    const network::zeromq::ListenCallback& callback,
+    const bool reactor) -> network::zeromq::socket::Pull*;
 auto PushSocket(const network::zeromq::Context& context, const bool direction)
     -> network::zeromq::socket::Push*;
 auto ReplySocket(
@@ -85,4 +93,9 @@ auto SubscribeSocket(
     const network::zeromq::Context& context,
     const network::zeromq::ListenCallback& callback)
     -> network::zeromq::socket::Subscribe*;
+/// See the reactor flag of PullSocket
+auto SubscribeSocket(
+    const network::zeromq::Context& context,
+    const network::zeromq::ListenCallback& callback,
+    const bool reactor) -> network::zeromq::socket::Subscribe*;
 }  // namespace opentxs::factory
@@ -21,8 +21,8 @@
 #include "opentxs/Proto.tpp"
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Settings.hpp"
 #include "opentxs/api/network/ZMQ.hpp"
-#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
@@ -102,9 +102,19 @@ ServerConnection::ServerConnection(
     , sockets_ready_(Flag::Factory(false))
     , status_(Flag::Factory(false))
     , use_proxy_(Flag::Factory(false))
+    , binary_messages_(Flag::Factory(false))
     , registration_lock_()
     , registered_for_push_()
 {
+    auto binary{false};
+    auto notUsed{false};
+    api_.Config().CheckSet_bool(
+        String::Factory("otx"),
+        String::Factory("binary_messages"),
+        false,
+        binary,
+        notUsed);
+    binary_messages_->Set(binary);
     thread_ = std::thread(&ServerConnection::activity_timer, this);
     const auto started = notification_socket_->Start(
         api_.Endpoints().InternalProcessPushNotification());
@@ -435,17 +445,21 @@ auto ServerConnection::Send(
 
     auto raw = String::Factory();
     message.SaveContractRaw(raw);
-    auto envelope = Armored::Factory(raw);
+    const auto encoding = binary_messages_.get()
+                              ? opentxs::Message::Encoding::Binary
+                              : opentxs::Message::Encoding::Armored;
+    const auto envelope = opentxs::Message::Encode(raw, encoding);
 
-    if (false == envelope->Exists()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to armor message").Flush();
+    if (envelope.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to encode message")
+            .Flush();
 
         return output;
     }
 
     Lock socketLock(lock_);
     Cleanup cleanup(socketLock, *this, status, reply);
-    auto request = api_.ZeroMQ().Message(std::string(envelope->Get()));
+    auto request = api_.ZeroMQ().Message(envelope);
     auto sendresult = get_sync(socketLock).Send(request);
 
     if (status_->On()) { publish(); }
@@ -485,25 +499,44 @@ auto ServerConnection::Send(
         LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid reply message.").Flush();
         cleanup.SetStatus(SendResult::INVALID_REPLY);
 
+        // A notary which understands binary messages answers a failed binary
+        // request with an empty binary frame. Only a notary which predates
+        // them, and so could not decode the request, replies with nothing.
+        if (opentxs::Message::Encoding::Binary == encoding) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(
+                ": Notary did not accept a binary message. Using armored "
+                "messages for this connection from now on.")
+                .Flush();
+            binary_messages_->Off();
+        }
+
         return output;
     }
 
-    auto armored = Armored::Factory();
-    armored->Set(std::string(frame).c_str());
     auto serialized = String::Factory();
-    armored->GetString(serialized);
-    const auto loaded = replymessage->LoadContractFromString(serialized);
+    auto replyEncoding = opentxs::Message::Encoding::Armored;
 
-    if (loaded) {
-        reply.reset(replymessage.release());
-    } else {
+    if (false == opentxs::Message::Decode(
+                     std::string(frame), serialized, replyEncoding)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Notary was unable to process the request.")
+            .Flush();
+        cleanup.SetStatus(SendResult::INVALID_REPLY);
+
+        return output;
+    }
+
+    if (false == replymessage->LoadContractFromString(serialized)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(
             ": Received server reply, but unable to instantiate it as a "
             "Message.")
             .Flush();
         cleanup.SetStatus(SendResult::INVALID_REPLY);
+
+        return output;
     }
 
+    reply.reset(replymessage.release());
     cleanup.SetStatus(SendResult::VALID_REPLY);
 
     return output;
@@ -118,6 +118,9 @@ private:
     OTFlag sockets_ready_;
     OTFlag status_;
     OTFlag use_proxy_;
+    // Send requests in binary instead of armored form. Cleared if the notary
+    // does not understand them.
+    OTFlag binary_messages_;
     mutable std::mutex registration_lock_;
     std::map<OTNymID, bool> registered_for_push_;
 
@@ -139,6 +139,10 @@ Context::Context() noexcept
         ::zmq_ctx_set(context_, ZMQ_MAX_SOCKETS, sockets);
 
     assert(0 == init);
+
+    // The reactor creates sockets so it must wait until the socket limit
+    // has been set
+    reactor_ = std::make_unique<socket::implementation::Reactor>(context_);
 }
 
 Context::operator void*() const noexcept
@@ -269,6 +273,13 @@ auto Context::PushSocket(
         factory::PushSocket(*this, static_cast<bool>(direction))};
 }
 
+auto Context::Reactor() const noexcept -> socket::implementation::Reactor&
+{
+    OT_ASSERT(reactor_);
+
+    return *reactor_;
+}
+
 auto Context::ReplyMessage(const zeromq::Message& request) const noexcept
     -> OTZMQMessage
 {
@@ -358,6 +369,8 @@ auto Context::TaggedReply(
 
 Context::~Context()
 {
+    reactor_.reset();
+
     if (nullptr != context_) { zmq_ctx_shutdown(context_); }
 }
 }  // namespace opentxs::network::zeromq::implementation
@@ -10,8 +10,10 @@
 
 #include <functional>
 #include <iosfwd>
+#include <memory>
 #include <string>
 
+#include "network/zeromq/socket/Reactor.hpp"
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
 #include "opentxs/network/zeromq/Context.hpp"
@@ -114,6 +116,7 @@ public:
         -> OTZMQPullSocket final;
     auto PushSocket(const socket::Socket::Direction direction) const noexcept
         -> OTZMQPushSocket final;
+    auto Reactor() const noexcept -> socket::implementation::Reactor&;
     auto ReplyMessage(const zeromq::Message& request) const noexcept
         -> OTZMQMessage final;
     auto ReplyMessage(const ReadView connectionID) const noexcept
@@ -146,6 +149,7 @@ private:
     friend opentxs::Factory;
 
     void* context_{nullptr};
+    std::unique_ptr<socket::implementation::Reactor> reactor_{nullptr};
 
     auto clone() const noexcept -> Context* final { return new Context; }
 
@@ -67,7 +67,7 @@ private:
     auto process_receiver_socket(const Lock& lock) noexcept -> bool;
     auto send(zeromq::Message& message) const noexcept -> bool final;
     auto send(const Lock& lock, zeromq::Message& message) noexcept -> bool;
-    void thread() noexcept final;
+    void thread() noexcept;
 
     Bidirectional() = delete;
     Bidirectional(const Bidirectional&) = delete;
@@ -47,7 +47,9 @@ Pipeline::Pipeline(
     std::function<void(zeromq::Message&)> callback) noexcept
     : sender_(context.PushSocket(Socket::Direction::Bind))
     , callback_(ListenCallback::Factory(callback))
-    , receiver_(context.SubscribeSocket(callback_))
+    // Worker state machines sleep to rate limit themselves and may process a
+    // whole block per message so they must not share the reactor
+    , receiver_(factory::SubscribeSocket(context, callback_, false))
 {
     const auto endpoint = std::string("inproc://opentxs/") +
                           api.Crypto().Encode().Nonce(32)->Get();
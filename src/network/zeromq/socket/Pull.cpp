@@ -45,6 +45,22 @@ auto PullSocket(
         static_cast<network::zeromq::socket::Socket::Direction>(direction),
         callback);
 }
+
+auto PullSocket(
+    const network::zeromq::Context& context,
+    const bool direction,
+    const network::zeromq::ListenCallback& callback,
+    const bool reactor) -> network::zeromq::socket::Pull*
+{
+    using ReturnType = network::zeromq::socket::implementation::Pull;
+
+    return new ReturnType(
+        context,
+        static_cast<network::zeromq::socket::Socket::Direction>(direction),
+        callback,
+        true,
+        reactor);
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq::socket::implementation
@@ -53,10 +69,12 @@ Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction,
     const zeromq::ListenCallback& callback,
-    const bool startThread) noexcept
+    const bool startThread,
+    const bool reactor) noexcept
     : Receiver(context, SocketType::Pull, direction, startThread)
     , Server(this->get())
     , callback_(callback)
+    , reactor_callback_(reactor)
 {
     init();
 }
@@ -65,20 +83,20 @@ Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction,
     const zeromq::ListenCallback& callback) noexcept
-    : Pull(context, direction, callback, true)
+    : Pull(context, direction, callback, true, true)
 {
 }
 
 Pull::Pull(
     const zeromq::Context& context,
     const Socket::Direction direction) noexcept
-    : Pull(context, direction, ListenCallback::Factory(), false)
+    : Pull(context, direction, ListenCallback::Factory(), false, true)
 {
 }
 
 auto Pull::clone() const noexcept -> Pull*
 {
-    return new Pull(context_, direction_, callback_);
+    return new Pull(context_, direction_, callback_, true, reactor_callback_);
 }
 
 auto Pull::have_callback() const noexcept -> bool { return true; }
@@ -47,7 +47,8 @@ public:
         const zeromq::Context& context,
         const Socket::Direction direction,
         const zeromq::ListenCallback& callback,
-        const bool startThread) noexcept;
+        const bool startThread,
+        const bool reactor) noexcept;
     Pull(
         const zeromq::Context& context,
         const Socket::Direction direction,
@@ -60,9 +61,14 @@ public:
 
 private:
     const ListenCallback& callback_;
+    const bool reactor_callback_;
 
     auto clone() const noexcept -> Pull* final;
     auto have_callback() const noexcept -> bool final;
+    auto use_reactor() const noexcept -> bool final
+    {
+        return reactor_callback_;
+    }
 
     void process_incoming(const Lock& lock, Message& message) noexcept final;
 
@@ -0,0 +1,295 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"                       // IWYU pragma: associated
+#include "1_Internal.hpp"                     // IWYU pragma: associated
+#include "network/zeromq/socket/Reactor.hpp"  // IWYU pragma: associated
+
+#include <zmq.h>
+#include <algorithm>
+#include <cerrno>
+#include <iostream>
+#include <utility>
+
+#include "network/zeromq/socket/Socket.hpp"
+#include "opentxs/core/Log.hpp"
+
+#define REACTOR_MAX_WORKERS 4u
+#define REACTOR_MIN_WORKERS 2u
+
+#define OT_METHOD "opentxs::network::zeromq::socket::implementation::Reactor::"
+
+namespace opentxs::network::zeromq::socket::implementation
+{
+namespace
+{
+thread_local const void* current_worker_{nullptr};
+}  // namespace
+
+Reactor::Reactor(void* context) noexcept
+    : Reactor(
+          context,
+          std::clamp(
+              std::thread::hardware_concurrency(),
+              REACTOR_MIN_WORKERS,
+              REACTOR_MAX_WORKERS))
+{
+}
+
+Reactor::Reactor(void* context, const std::size_t workers) noexcept
+    : workers_()
+    , next_(0)
+{
+    OT_ASSERT(nullptr != context);
+    OT_ASSERT(0 < workers);
+
+    workers_.reserve(workers);
+
+    for (auto i = std::size_t{0}; i < workers; ++i) {
+        workers_.emplace_back(std::make_unique<Worker>(context));
+    }
+}
+
+Reactor::Worker::Worker(void* context) noexcept
+    : endpoint_(Socket::random_inproc_endpoint())
+    , running_(true)
+    , thread_()
+    , lock_()
+    , cycle_()
+    , members_()
+    , generation_(0)
+    , wake_lock_()
+    , wake_push_(zmq_socket(context, ZMQ_PUSH))
+    , wake_pull_(zmq_socket(context, ZMQ_PULL))
+{
+    OT_ASSERT(nullptr != wake_push_);
+    OT_ASSERT(nullptr != wake_pull_);
+
+    const auto linger = int{0};
+    zmq_setsockopt(wake_push_, ZMQ_LINGER, &linger, sizeof(linger));
+    zmq_setsockopt(wake_pull_, ZMQ_LINGER, &linger, sizeof(linger));
+    const auto bound = zmq_bind(wake_pull_, endpoint_.c_str());
+
+    OT_ASSERT(0 == bound);
+
+    const auto connected = zmq_connect(wake_push_, endpoint_.c_str());
+
+    OT_ASSERT(0 == connected);
+}
+
+auto Reactor::Add(Member& member) const noexcept -> std::size_t
+{
+    const auto worker = next_++ % workers_.size();
+    workers_.at(worker)->Add(member);
+
+    return worker;
+}
+
+void Reactor::Worker::Add(Member& member) noexcept
+{
+    Lock lock(lock_);
+    members_.emplace_back(&member);
+
+    if (running_ && (false == thread_.joinable())) {
+        thread_ = std::thread(&Worker::run, this);
+    }
+
+    lock.unlock();
+    Wake();
+}
+
+void Reactor::Worker::drain_wake() noexcept
+{
+    auto message = zmq_msg_t{};
+    zmq_msg_init(&message);
+
+    while (-1 != zmq_msg_recv(&message, wake_pull_, ZMQ_DONTWAIT)) {}
+
+    zmq_msg_close(&message);
+}
+
+auto Reactor::InWorker(const std::size_t worker) const noexcept -> bool
+{
+    return workers_.at(worker)->InThread();
+}
+
+auto Reactor::Worker::InThread() const noexcept -> bool
+{
+    return this == current_worker_;
+}
+
+auto Reactor::Worker::is_member(const Member* member) noexcept -> bool
+{
+    Lock lock(lock_);
+
+    return members_.end() !=
+           std::find(members_.begin(), members_.end(), member);
+}
+
+void Reactor::Remove(const std::size_t worker, const Member& member)
+    const noexcept
+{
+    workers_.at(worker)->Remove(member);
+}
+
+void Reactor::Worker::Remove(const Member& member) noexcept
+{
+    Lock lock(lock_);
+    const auto it = std::find(members_.begin(), members_.end(), &member);
+
+    if (members_.end() == it) { return; }
+
+    members_.erase(it);
+
+    // The worker checks membership before every use of a member so it is
+    // safe to return immediately if this is the worker's own thread.
+    if (InThread() || (false == thread_.joinable())) { return; }
+
+    // Otherwise the member may still be in the snapshot the worker is
+    // using. Wait until it has started a new cycle without it.
+    const auto target = generation_ + 1;
+    lock.unlock();
+    Wake();
+    lock.lock();
+    cycle_.wait(
+        lock, [&]() -> bool { return (target <= generation_) || !running_; });
+}
+
+void Reactor::Worker::run() noexcept
+{
+    current_worker_ = this;
+    auto members = std::vector<Member*>{};
+    auto polled = std::vector<Member*>{};
+    auto ready = std::vector<Member*>{};
+    auto locks = std::vector<Lock>{};
+    auto items = std::vector<zmq_pollitem_t>{};
+
+    while (running_) {
+        members = snapshot();
+        polled.clear();
+        ready.clear();
+        locks.clear();
+        items.clear();
+        items.push_back({wake_pull_, 0, ZMQ_POLLIN, 0});
+        auto skipped{false};
+
+        // Sockets are not thread safe so each one stays locked while it is
+        // being polled. Any socket which is busy elsewhere is retried soon.
+        for (auto* member : members) {
+            auto lock = Lock{member->reactor_lock(), std::try_to_lock};
+
+            if (false == lock.owns_lock()) {
+                skipped = true;
+
+                continue;
+            }
+
+            member->reactor_prepare(lock);
+            auto* socket = member->reactor_socket();
+
+            if (nullptr == socket) { continue; }
+
+            items.push_back({socket, 0, ZMQ_POLLIN, 0});
+            polled.emplace_back(member);
+            locks.emplace_back(std::move(lock));
+        }
+
+        const auto events = zmq_poll(
+            items.data(),
+            static_cast<int>(items.size()),
+            skipped ? REACTOR_RETRY_MILLISECONDS : REACTOR_POLL_MILLISECONDS);
+
+        if (-1 == events) {
+            const auto error = zmq_errno();
+
+            if (ETERM == error) { break; }
+
+            std::cerr << OT_METHOD << __FUNCTION__
+                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+
+            continue;
+        }
+
+        if (0 == events) { continue; }
+
+        if (0 != (items.front().revents & ZMQ_POLLIN)) { drain_wake(); }
+
+        for (auto i = std::size_t{1}; i < items.size(); ++i) {
+            if (0 != (items.at(i).revents & ZMQ_POLLIN)) {
+                ready.emplace_back(polled.at(i - 1));
+            }
+        }
+
+        // Only the socket currently being processed stays locked so that
+        // callbacks are free to operate on the other sockets of this worker
+        locks.clear();
+
+        for (auto* member : ready) {
+            if (false == running_) { break; }
+
+            // A previous callback may have removed this member
+            if (false == is_member(member)) { continue; }
+
+            auto lock = Lock{member->reactor_lock(), std::try_to_lock};
+
+            if (false == lock.owns_lock()) { continue; }
+
+            for (auto i = 0; i < REACTOR_MAX_BATCH; ++i) {
+                if (false == member->reactor_receive(lock)) { break; }
+            }
+        }
+    }
+
+    Lock lock(lock_);
+    running_ = false;
+    cycle_.notify_all();
+}
+
+auto Reactor::Worker::snapshot() noexcept -> std::vector<Member*>
+{
+    Lock lock(lock_);
+    ++generation_;
+    cycle_.notify_all();
+
+    return members_;
+}
+
+void Reactor::Worker::Stop() noexcept
+{
+    Lock lock(lock_);
+    running_ = false;
+    cycle_.notify_all();
+    lock.unlock();
+    Wake();
+
+    if (thread_.joinable()) { thread_.join(); }
+}
+
+void Reactor::Wake(const std::size_t worker) const noexcept
+{
+    workers_.at(worker)->Wake();
+}
+
+void Reactor::Worker::Wake() noexcept
+{
+    Lock lock(wake_lock_);
+    // A full queue means the worker already has a pending wake up
+    zmq_send(wake_push_, nullptr, 0, ZMQ_DONTWAIT);
+}
+
+Reactor::Worker::~Worker()
+{
+    Stop();
+    zmq_close(wake_push_);
+    zmq_close(wake_pull_);
+}
+
+Reactor::~Reactor()
+{
+    for (auto& worker : workers_) { worker->Stop(); }
+
+    workers_.clear();
+}
+}  // namespace opentxs::network::zeromq::socket::implementation
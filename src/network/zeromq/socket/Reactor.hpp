@@ -0,0 +1,105 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+#define REACTOR_POLL_MILLISECONDS 100
+#define REACTOR_RETRY_MILLISECONDS 10
+#define REACTOR_MAX_BATCH 256
+
+namespace opentxs::network::zeromq::socket::implementation
+{
+// Services the receive side of many sockets from a small, fixed set of
+// threads. Each member socket is assigned to one worker which polls all of
+// its sockets at once and drains every waiting message per wake up.
+class Reactor
+{
+public:
+    class Member
+    {
+    public:
+        virtual auto reactor_lock() const noexcept -> std::mutex& = 0;
+        // Start queued endpoints and run pending socket tasks
+        virtual void reactor_prepare(const Lock& lock) noexcept = 0;
+        // Receive and process one message. Returns false if none is waiting.
+        virtual auto reactor_receive(const Lock& lock) noexcept -> bool = 0;
+        virtual auto reactor_socket() const noexcept -> void* = 0;
+
+        virtual ~Member() = default;
+    };
+
+    // Returns the index of the worker which will service the member
+    auto Add(Member& member) const noexcept -> std::size_t;
+    auto InWorker(const std::size_t worker) const noexcept -> bool;
+    // After this returns the worker will not touch the member again
+    void Remove(const std::size_t worker, const Member& member)
+        const noexcept;
+    void Wake(const std::size_t worker) const noexcept;
+
+    explicit Reactor(void* context) noexcept;
+    Reactor(void* context, const std::size_t workers) noexcept;
+
+    ~Reactor();
+
+private:
+    class Worker
+    {
+    public:
+        void Add(Member& member) noexcept;
+        auto InThread() const noexcept -> bool;
+        void Remove(const Member& member) noexcept;
+        void Stop() noexcept;
+        void Wake() noexcept;
+
+        explicit Worker(void* context) noexcept;
+
+        ~Worker();
+
+    private:
+        const std::string endpoint_;
+        std::atomic<bool> running_;
+        std::thread thread_;
+        std::mutex lock_;
+        std::condition_variable cycle_;
+        std::vector<Member*> members_;
+        std::size_t generation_;
+        std::mutex wake_lock_;
+        void* wake_push_;
+        void* wake_pull_;
+
+        auto is_member(const Member* member) noexcept -> bool;
+        auto snapshot() noexcept -> std::vector<Member*>;
+
+        void drain_wake() noexcept;
+        void run() noexcept;
+
+        Worker() = delete;
+        Worker(const Worker&) = delete;
+        Worker(Worker&&) = delete;
+        auto operator=(const Worker&) -> Worker& = delete;
+        auto operator=(Worker &&) -> Worker& = delete;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    mutable std::atomic<std::size_t> next_;
+
+    Reactor() = delete;
+    Reactor(const Reactor&) = delete;
+    Reactor(Reactor&&) = delete;
+    auto operator=(const Reactor&) -> Reactor& = delete;
+    auto operator=(Reactor &&) -> Reactor& = delete;
+};
+}  // namespace opentxs::network::zeromq::socket::implementation
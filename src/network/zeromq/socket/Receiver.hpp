@@ -5,10 +5,16 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <future>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 
+#include "network/zeromq/socket/Reactor.hpp"
 #include "network/zeromq/socket/Socket.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
@@ -25,15 +31,14 @@ class Context;
 }  // namespace network
 }  // namespace opentxs
 
-#define CALLBACK_WAIT_MILLISECONDS 50
-#define RECEIVER_POLL_MILLISECONDS 100
-
 #define RECEIVER_METHOD "opentxs::network::zeromq::implementation::Receiver::"
 
 namespace opentxs::network::zeromq::socket::implementation
 {
 template <typename InterfaceType, typename MessageType = zeromq::Message>
-class Receiver : virtual public InterfaceType, public Socket
+class Receiver : virtual public InterfaceType,
+                 public Socket,
+                 public Reactor::Member
 {
 public:
     auto apply_socket(SocketCallback&& cb) const noexcept -> bool override;
@@ -45,13 +50,26 @@ protected:
 
     virtual auto have_callback() const noexcept -> bool { return false; }
     void run_tasks(const Lock& lock) const noexcept;
+    // Receivers share the context reactor unless this returns false, in
+    // which case the socket gets a private single worker reactor instead. A
+    // slow callback stalls every socket on the same worker, and one that
+    // waits on such a socket deadlocks it, so the following stay private:
+    //
+    // - Reply sockets, whose callbacks build the reply synchronously and
+    //   often wait on other sockets to do so
+    // - Pull and Subscribe sockets created with the reactor flag cleared:
+    //   blockchain thread pool workers, which run long jobs, and Pipeline
+    //   receivers, whose state machines sleep to rate limit themselves
+    //
+    // Dealer, Router and Pair sockets never use either reactor since they
+    // also poll their internal send queue.
+    virtual auto use_reactor() const noexcept -> bool { return true; }
 
     void init() noexcept override;
     virtual void process_incoming(
         const Lock& lock,
         MessageType& message) noexcept = 0;
     void shutdown(const Lock& lock) noexcept override;
-    virtual void thread() noexcept;
 
     Receiver(
         const zeromq::Context& context,
@@ -62,14 +80,23 @@ protected:
     ~Receiver() override;
 
 private:
+    using Task = std::pair<SocketCallback, std::promise<bool>>;
+
+    std::unique_ptr<Reactor> private_reactor_;
+    Reactor* reactor_;
+    std::size_t worker_;
+    mutable std::atomic<bool> registered_;
     mutable int next_task_;
     mutable std::mutex task_lock_;
-    mutable std::map<int, SocketCallback> socket_tasks_;
-    mutable std::map<int, bool> task_result_;
+    mutable std::map<int, Task> socket_tasks_;
 
-    auto add_task(SocketCallback&& cb) const noexcept -> int;
-    auto task_result(const int id) const noexcept -> bool;
-    auto task_running(const int id) const noexcept -> bool;
+    auto add_task(SocketCallback&& cb) const noexcept -> std::future<bool>;
+    void fail_tasks() const noexcept;
+    auto reactor_lock() const noexcept -> std::mutex& final { return lock_; }
+    void reactor_prepare(const Lock& lock) noexcept final;
+    auto reactor_receive(const Lock& lock) noexcept -> bool final;
+    auto reactor_socket() const noexcept -> void* final;
+    void unregister() const noexcept;
 
     Receiver() = delete;
     Receiver(const Receiver&) = delete;
@@ -7,10 +7,14 @@
 #include "network/zeromq/socket/Receiver.hpp"  // IWYU pragma: associated
 
 #include <zmq.h>
+#include <cstddef>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <utility>
 
+#include "network/zeromq/Context.hpp"
 #include "opentxs/Types.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Log.hpp"
@@ -28,159 +32,197 @@ Receiver<InterfaceType, MessageType>::Receiver(
     : Socket(context, type, direction)
     , start_thread_(startThread)
     , receiver_thread_()
+    , private_reactor_(nullptr)
+    , reactor_(nullptr)
+    , worker_(0)
+    , registered_(false)
     , next_task_(0)
     , task_lock_()
     , socket_tasks_()
-    , task_result_()
 {
 }
 
 template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::add_task(
-    SocketCallback&& cb) const noexcept -> int
+    SocketCallback&& cb) const noexcept -> std::future<bool>
 {
     Lock lock(task_lock_);
-    auto [it, success] = socket_tasks_.emplace(++next_task_, std::move(cb));
+    auto promise = std::promise<bool>{};
+    auto output = promise.get_future();
+
+    // Tasks queued after shutdown would never run
+    if (false == running_.get()) {
+        promise.set_value(false);
+
+        return output;
+    }
+
+    auto [it, success] = socket_tasks_.emplace(
+        ++next_task_, Task{std::move(cb), std::move(promise)});
 
     OT_ASSERT(success);
 
-    return it->first;
+    return output;
 }
 
 template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::apply_socket(
     SocketCallback&& cb) const noexcept -> bool
 {
-    const auto id = add_task(std::move(cb));
+    if (false == running_.get()) { return false; }
 
-    while (task_running(id)) {
-        Sleep(std::chrono::milliseconds(RECEIVER_POLL_MILLISECONDS));
+    const auto registered = registered_.load();
+
+    // The worker servicing this socket can not wait on itself, and a
+    // socket without any thread has nobody else to run the task
+    if ((registered && reactor_->InWorker(worker_)) ||
+        ((false == registered) && (false == receiver_thread_.joinable()))) {
+        Lock lock(lock_);
+
+        return cb(lock);
     }
 
-    return task_result(id);
+    auto result = add_task(std::move(cb));
+
+    if (registered) { reactor_->Wake(worker_); }
+
+    return result.get();
 }
 
 template <typename InterfaceType, typename MessageType>
 auto Receiver<InterfaceType, MessageType>::Close() const noexcept -> bool
 {
     running_->Off();
+    unregister();
 
     if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 
+    fail_tasks();
+
     return Socket::Close();
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::init() noexcept
+void Receiver<InterfaceType, MessageType>::fail_tasks() const noexcept
 {
-    Socket::init();
-
-    if (start_thread_) {
-        receiver_thread_ = std::thread(&Receiver::thread, this);
-    }
-}
+    Lock lock(task_lock_);
 
-template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::run_tasks(
-    const Lock& lock) const noexcept
-{
-    Lock task_lock(task_lock_);
-    auto i = socket_tasks_.begin();
+    for (auto& [id, task] : socket_tasks_) { task.second.set_value(false); }
 
-    while (i != socket_tasks_.end()) {
-        const auto& [id, cb] = *i;
-        task_result_.emplace(id, cb(lock));
-        i = socket_tasks_.erase(i);
-    }
+    socket_tasks_.clear();
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
+void Receiver<InterfaceType, MessageType>::init() noexcept
 {
-    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
-
-    Socket::shutdown(lock);
-}
+    Socket::init();
 
-template <typename InterfaceType, typename MessageType>
-auto Receiver<InterfaceType, MessageType>::task_result(
-    const int id) const noexcept -> bool
-{
-    Lock lock(task_lock_);
-    const auto it = task_result_.find(id);
+    if (false == start_thread_) { return; }
 
-    OT_ASSERT(task_result_.end() != it);
+    const auto* context =
+        dynamic_cast<const zeromq::implementation::Context*>(&context_);
 
-    auto output = it->second;
-    task_result_.erase(it);
+    if (use_reactor() && (nullptr != context)) {
+        reactor_ = &context->Reactor();
+    } else {
+        private_reactor_ =
+            std::make_unique<Reactor>(static_cast<void*>(context_), 1);
+        reactor_ = private_reactor_.get();
+    }
 
-    return output;
+    worker_ = reactor_->Add(*this);
+    registered_.store(true);
 }
 
 template <typename InterfaceType, typename MessageType>
-auto Receiver<InterfaceType, MessageType>::task_running(
-    const int id) const noexcept -> bool
+void Receiver<InterfaceType, MessageType>::reactor_prepare(
+    const Lock& lock) noexcept
 {
-    Lock lock(task_lock_);
+    if (false == running_.get()) { return; }
 
-    return (1 == socket_tasks_.count(id));
+    for (const auto& endpoint : endpoint_queue_.pop()) {
+        start(lock, endpoint);
+    }
+
+    run_tasks(lock);
 }
 
 template <typename InterfaceType, typename MessageType>
-void Receiver<InterfaceType, MessageType>::thread() noexcept
+auto Receiver<InterfaceType, MessageType>::reactor_receive(
+    const Lock& lock) noexcept -> bool
 {
-    while (running_.get()) {
-        if (have_callback()) { break; }
+    if (false == running_.get()) { return false; }
+
+    auto events = int{0};
+    auto size = sizeof(events);
 
-        Sleep(std::chrono::milliseconds(CALLBACK_WAIT_MILLISECONDS));
+    if (0 != zmq_getsockopt(socket_, ZMQ_EVENTS, &events, &size)) {
+        return false;
     }
 
-    zmq_pollitem_t poll[1];
-    poll[0].socket = socket_;
-    poll[0].events = ZMQ_POLLIN;
+    if (0 == (events & ZMQ_POLLIN)) { return false; }
 
-    while (running_.get()) {
-        auto newEndpoints = endpoint_queue_.pop();
-        Lock lock(lock_, std::try_to_lock);
+    auto message = MessageType::Factory();
 
-        if (false == lock.owns_lock()) { continue; }
+    if (false == Socket::receive_message(lock, socket_, message)) {
+        std::cerr << RECEIVER_METHOD << __FUNCTION__
+                  << ": Failed to receive incoming message." << std::endl;
 
-        for (const auto& endpoint : newEndpoints) { start(lock, endpoint); }
+        return false;
+    }
 
-        run_tasks(lock);
-        const auto events = zmq_poll(poll, 1, RECEIVER_POLL_MILLISECONDS);
+    process_incoming(lock, message);
 
-        if (0 == events) { continue; }
+    return true;
+}
 
-        if (-1 == events) {
-            const auto error = zmq_errno();
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Poll error: " << zmq_strerror(error) << std::endl;
+template <typename InterfaceType, typename MessageType>
+auto Receiver<InterfaceType, MessageType>::reactor_socket() const noexcept
+    -> void*
+{
+    if (false == running_.get()) { return nullptr; }
+
+    if (false == have_callback()) { return nullptr; }
+
+    return socket_;
+}
 
-            continue;
-        }
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::run_tasks(
+    const Lock& lock) const noexcept
+{
+    Lock task_lock(task_lock_);
+    auto i = socket_tasks_.begin();
 
-        if (false == running_.get()) { return; }
+    while (i != socket_tasks_.end()) {
+        auto& [cb, promise] = i->second;
+        promise.set_value(cb(lock));
+        i = socket_tasks_.erase(i);
+    }
+}
 
-        auto reply = MessageType::Factory();
-        const auto received = Socket::receive_message(lock, socket_, reply);
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::shutdown(const Lock& lock) noexcept
+{
+    unregister();
 
-        if (false == received) {
-            std::cerr << RECEIVER_METHOD << __FUNCTION__
-                      << ": Failed to receive incoming message." << std::endl;
+    if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 
-            continue;
-        }
+    fail_tasks();
+    Socket::shutdown(lock);
+}
 
-        process_incoming(lock, reply);
-        lock.unlock();
-        std::this_thread::yield();
-    }
+template <typename InterfaceType, typename MessageType>
+void Receiver<InterfaceType, MessageType>::unregister() const noexcept
+{
+    if (registered_.exchange(false)) { reactor_->Remove(worker_, *this); }
 }
 
 template <typename InterfaceType, typename MessageType>
 Receiver<InterfaceType, MessageType>::~Receiver()
 {
+    unregister();
+
     if (receiver_thread_.joinable()) { receiver_thread_.join(); }
 }
 }  // namespace opentxs::network::zeromq::socket::implementation
@@ -55,6 +55,8 @@ private:
 
     auto clone() const noexcept -> Reply* final;
     auto have_callback() const noexcept -> bool final;
+    // Reply callbacks often wait on other sockets in the same process
+    auto use_reactor() const noexcept -> bool final { return false; }
 
     void process_incoming(const Lock& lock, Message& message) noexcept final;
 
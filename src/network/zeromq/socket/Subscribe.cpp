@@ -35,23 +35,42 @@ auto SubscribeSocket(
 
     return new ReturnType(context, callback);
 }
+
+auto SubscribeSocket(
+    const network::zeromq::Context& context,
+    const network::zeromq::ListenCallback& callback,
+    const bool reactor) -> network::zeromq::socket::Subscribe*
+{
+    using ReturnType = network::zeromq::socket::implementation::Subscribe;
+
+    return new ReturnType(context, callback, reactor);
+}
 }  // namespace opentxs::factory
 
 namespace opentxs::network::zeromq::socket::implementation
 {
 Subscribe::Subscribe(
     const zeromq::Context& context,
-    const zeromq::ListenCallback& callback) noexcept
+    const zeromq::ListenCallback& callback,
+    const bool reactor) noexcept
     : Receiver(context, SocketType::Subscribe, Socket::Direction::Connect, true)
     , Client(this->get())
     , callback_(callback)
+    , reactor_callback_(reactor)
 {
     init();
 }
 
+Subscribe::Subscribe(
+    const zeromq::Context& context,
+    const zeromq::ListenCallback& callback) noexcept
+    : Subscribe(context, callback, true)
+{
+}
+
 auto Subscribe::clone() const noexcept -> Subscribe*
 {
-    return new Subscribe(context_, callback_);
+    return new Subscribe(context_, callback_, reactor_callback_);
 }
 
 auto Subscribe::have_callback() const noexcept -> bool { return true; }
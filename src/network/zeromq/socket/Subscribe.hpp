@@ -41,6 +41,10 @@ class Subscribe : public Receiver<zeromq::socket::Subscribe>,
 public:
     auto SetSocksProxy(const std::string& proxy) const noexcept -> bool final;
 
+    Subscribe(
+        const zeromq::Context& context,
+        const zeromq::ListenCallback& callback,
+        const bool reactor) noexcept;
     Subscribe(
         const zeromq::Context& context,
         const zeromq::ListenCallback& callback) noexcept;
@@ -51,8 +55,14 @@ protected:
     const ListenCallback& callback_;
 
 private:
+    const bool reactor_callback_;
+
     auto clone() const noexcept -> Subscribe* override;
     auto have_callback() const noexcept -> bool final;
+    auto use_reactor() const noexcept -> bool final
+    {
+        return reactor_callback_;
+    }
 
     void init() noexcept final;
     void process_incoming(const Lock& lock, Message& message) noexcept final;
@@ -2140,8 +2140,7 @@ auto Operation::process_inbox(
         const auto number = transaction->GetTransactionNum();
 
         if (transaction->IsAbbreviated()) {
-            inbox->LoadBoxReceipt(number);
-            transaction = inbox->GetTransaction(number);
+            transaction = inbox->GetFullTransaction(number);
 
             if (false == bool(transaction)) {
                 LogOutput(OT_METHOD)(__FUNCTION__)(": Unable to load item: ")(
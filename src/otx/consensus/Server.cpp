@@ -1564,12 +1564,9 @@ auto Server::get_instrument(
     // programmatic user of this API will be able to load it up.
     //
     if (pTransaction->IsAbbreviated()) {
-        ledger.LoadBoxReceipt(static_cast<std::int64_t>(
-            lTransactionNum));  // I don't check return val here because I still
-                                // want it to send the abbreviated form, if this
-                                // fails.
-        pTransaction =
-            ledger.GetTransaction(static_cast<std::int64_t>(lTransactionNum));
+        // Returns the abbreviated form if the box receipt fails to load.
+        pTransaction = ledger.GetFullTransaction(
+            static_cast<std::int64_t>(lTransactionNum));
 
         if (false == bool(pTransaction)) {
             LogOutput(OT_METHOD)(__FUNCTION__)(
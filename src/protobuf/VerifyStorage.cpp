@@ -269,6 +269,23 @@ auto StorageServersAllowedStorageItemHash() noexcept -> const VersionMap&
     return output;
 }
 auto StorageThreadAllowedItem() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {1, {1, 1}},
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadAllowedPage() noexcept -> const VersionMap&
+{
+    static const auto output = VersionMap{
+        {2, {1, 1}},
+    };
+
+    return output;
+}
+auto StorageThreadPageAllowedItem() noexcept -> const VersionMap&
 {
     static const auto output = VersionMap{
         {1, {1, 1}},
@@ -38,6 +38,8 @@ auto CheckProto_1(const StorageThread& input, const bool silent) -> bool
 
     if (0 == input.participant_size()) { FAIL_1("no patricipants") }
 
+    CHECK_NONE(page)
+
     for (auto& item : input.item()) {
         try {
             const bool valid = Check(
@@ -56,100 +58,5 @@ auto CheckProto_1(const StorageThread& input, const bool silent) -> bool
 
     return true;
 }
-
-auto CheckProto_2(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(2)
-}
-
-auto CheckProto_3(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(3)
-}
-
-auto CheckProto_4(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(4)
-}
-
-auto CheckProto_5(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(5)
-}
-
-auto CheckProto_6(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(6)
-}
-
-auto CheckProto_7(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(7)
-}
-
-auto CheckProto_8(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(8)
-}
-
-auto CheckProto_9(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(9)
-}
-
-auto CheckProto_10(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(10)
-}
-
-auto CheckProto_11(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(11)
-}
-
-auto CheckProto_12(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(12)
-}
-
-auto CheckProto_13(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(13)
-}
-
-auto CheckProto_14(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(14)
-}
-
-auto CheckProto_15(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(15)
-}
-
-auto CheckProto_16(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(16)
-}
-
-auto CheckProto_17(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(17)
-}
-
-auto CheckProto_18(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(18)
-}
-
-auto CheckProto_19(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(19)
-}
-
-auto CheckProto_20(const StorageThread& input, const bool silent) -> bool
-{
-    UNDEFINED_VERSION(20)
-}
 }  // namespace proto
 }  // namespace opentxs
@@ -173,6 +173,39 @@ auto ConfigLoader::load(
             static_cast<std::int32_t>(lValue));
     }
 
+    // STORAGE
+
+    {
+        const char* szComment = ";; STORAGE\n";
+
+        bool bSectionExist = false;
+        config.CheckSetSection(
+            String::Factory("storage"),
+            String::Factory(szComment),
+            bSectionExist);
+    }
+
+    {
+        const char* szComment =
+            "; legacy_storage is where boxes, receipts, markets and cron "
+            "items are kept.\n"
+            "; filesystem : one file per item (default)\n"
+            "; lmdb       : one LMDB database in the data folder. The existing "
+            "files are imported the first time the server starts with this "
+            "setting.\n";
+
+        bool bIsNewKey = false;
+        std::string strValue{};
+        config.CheckSet_str(
+            String::Factory("storage"),
+            String::Factory("legacy_storage"),
+            String::Factory(ServerSettings::GetLegacyStorage()),
+            strValue,
+            bIsNewKey,
+            String::Factory(szComment));
+        ServerSettings::SetLegacyStorage(strValue);
+    }
+
     // PERMISSIONS
 
     {
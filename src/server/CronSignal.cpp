@@ -0,0 +1,50 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"           // IWYU pragma: associated
+#include "1_Internal.hpp"         // IWYU pragma: associated
+#include "server/CronSignal.hpp"  // IWYU pragma: associated
+
+#include <algorithm>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::server
+{
+CronSignal::CronSignal() noexcept
+    : lock_()
+    , signal_()
+    , wake_(false)
+    , stop_(false)
+{
+}
+
+auto CronSignal::Stop() noexcept -> void
+{
+    Lock lock(lock_);
+    stop_ = true;
+    signal_.notify_all();
+}
+
+auto CronSignal::Wait(const std::chrono::milliseconds timeout) noexcept
+    -> bool
+{
+    const auto limit = std::chrono::milliseconds{maximum_};
+    Lock lock(lock_);
+    signal_.wait_for(lock, std::min(timeout, limit), [&]() -> bool {
+        return stop_ || wake_;
+    });
+    wake_ = false;
+
+    return false == stop_;
+}
+
+auto CronSignal::Wake() noexcept -> void
+{
+    Lock lock(lock_);
+    wake_ = true;
+    signal_.notify_all();
+}
+}  // namespace opentxs::server
@@ -0,0 +1,44 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace opentxs::server
+{
+// Lets the notary cron thread sleep until the next cron deadline. Requests
+// which may have added, removed, or rescheduled cron items wake it early so
+// it can recalculate the deadline, and so does shutdown.
+class CronSignal
+{
+public:
+    // Waits until the timeout expires, capped at one minute, or until Wake()
+    // or Stop() is called. Returns false once Stop() has been called.
+    auto Wait(const std::chrono::milliseconds timeout) noexcept -> bool;
+
+    auto Stop() noexcept -> void;
+    auto Wake() noexcept -> void;
+
+    CronSignal() noexcept;
+
+    ~CronSignal() = default;
+
+private:
+    static constexpr std::chrono::seconds maximum_{60};
+
+    std::mutex lock_;
+    std::condition_variable signal_;
+    bool wake_;
+    bool stop_;
+
+    CronSignal(const CronSignal&) = delete;
+    CronSignal(CronSignal&&) = delete;
+    auto operator=(const CronSignal&) -> CronSignal& = delete;
+    auto operator=(CronSignal&&) -> CronSignal& = delete;
+};
+}  // namespace opentxs::server
@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"               // IWYU pragma: associated
 #include "server/MessageProcessor.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <ostream>
@@ -21,7 +22,6 @@
 #include "opentxs/api/Endpoints.hpp"
 #include "opentxs/api/Factory.hpp"
 #include "opentxs/api/Wallet.hpp"
-#include "opentxs/core/Armored.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Log.hpp"
@@ -54,6 +54,7 @@
 #include "server/UserCommandProcessor.hpp"
 
 #define OTX_ZAP_DOMAIN "opentxs-otx"
+#define CRON_MIN_WAIT_MILLISECONDS 50
 
 #define OT_METHOD "opentxs::MessageProcessor::"
 
@@ -104,6 +105,14 @@ MessageProcessor::MessageProcessor(
     , drop_outgoing_(0)
     , active_connections_()
     , connection_map_lock_()
+    , locks_()
+    , thread_count_(0)
+    , workers_()
+    , queue_lock_()
+    , queue_signal_()
+    , queue_()
+    , stop_workers_(false)
+    , cron_signal_()
 {
     auto bound = backend_socket_->Start(internal_endpoint_);
     bound &= internal_socket_->Start(internal_endpoint_);
@@ -132,6 +141,8 @@ void MessageProcessor::associate_connection(
 
 void MessageProcessor::cleanup()
 {
+    stop_workers();
+    cron_signal_.Stop();
     frontend_socket_->Close();
     notification_socket_->Close();
     internal_socket_->Close();
@@ -175,10 +186,13 @@ auto MessageProcessor::get_connection(const network::zeromq::Message& incoming)
 void MessageProcessor::init(
     const bool inproc,
     const int port,
-    const Secret& privkey)
+    const Secret& privkey,
+    const std::size_t threads)
 {
     if (port == 0) { OT_FAIL; }
 
+    thread_count_ = threads;
+
     auto set = frontend_socket_->SetPrivateKey(privkey);
 
     OT_ASSERT(set);
@@ -209,25 +223,34 @@ void MessageProcessor::init(
 
 void MessageProcessor::run()
 {
+    const auto minimum = std::chrono::milliseconds{CRON_MIN_WAIT_MILLISECONDS};
+
     while (running_) {
-        // timeout is the time left until the next cron should execute.
-        const auto timeout = server_.ComputeTimeout();
+        // timeout is the time left until the next cron item is due
+        auto timeout = [&] {
+            const auto lock = locks_.Shared();
+
+            return server_.ComputeTimeout();
+        }();
 
         if (timeout.count() <= 0) {
-            // ProcessCron and process_backend must not run simultaneously
-            Lock lock(lock_);
+            // Cron may modify any account or market so no request may be in
+            // progress while it runs
+            const auto lock = locks_.Exclusive();
             server_.ProcessCron();
+            // Cron may be inactive or short of transaction numbers, in which
+            // case nothing was processed and the items are still due
+            timeout = std::max(server_.ComputeTimeout(), minimum);
         }
 
-        Sleep(std::chrono::milliseconds(50));
+        // Sleep until the next deadline unless a request changes cron first
+        if (false == cron_signal_.Wait(timeout)) { return; }
     }
 }
 
 auto MessageProcessor::process_backend(const zmq::Message& incoming)
     -> OTZMQMessage
 {
-    // ProcessCron and process_backend must not run simultaneously
-    Lock lock(lock_);
     std::string reply{};
 
     std::string messageString{};
@@ -235,10 +258,8 @@ auto MessageProcessor::process_backend(const zmq::Message& incoming)
         messageString = *incoming.Body().begin();
     }
 
-    bool error = process_message(messageString, reply);
-
-    if (error) { reply = ""; }
-
+    // A failed request leaves the failure frame for its encoding in reply
+    process_message(messageString, reply);
     auto output = server_.API().ZeroMQ().ReplyMessage(incoming);
     output->AddFrame(reply);
 
@@ -327,6 +348,15 @@ void MessageProcessor::process_legacy(
 {
     LogTrace(OT_METHOD)(__FUNCTION__)(": Processing request via ")(id.asHex())
         .Flush();
+
+    if (0 < thread_count_) {
+        Lock lock(queue_lock_);
+        queue_.emplace_back(incoming);
+        queue_signal_.notify_one();
+
+        return;
+    }
+
     OTZMQMessage request{incoming};
     internal_socket_->Send(request);
 }
@@ -335,34 +365,54 @@ auto MessageProcessor::process_message(
     const std::string& messageString,
     std::string& reply) -> bool
 {
-    if (messageString.size() < 1) { return true; }
+    // The reply uses the same encoding as the request, which a client only
+    // chooses when it is able to read it
+    auto encoding = Message::Encoding::Armored;
+    auto fail = [&]() -> bool {
+        reply = Message::Failure(encoding);
+
+        return true;
+    };
+
+    if (messageString.size() < 1) { return fail(); }
 
-    auto armored = Armored::Factory();
-    armored->MemSet(messageString.data(), messageString.size());
     auto serialized = String::Factory();
-    armored->GetString(serialized);
+    Message::Decode(messageString, serialized, encoding);
     auto request{server_.API().Factory().Message()};
 
     if (false == serialized->Exists()) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Empty serialized request.")
             .Flush();
 
-        return true;
+        return fail();
     }
 
     if (false == request->LoadContractFromString(serialized)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to deserialized request.")
             .Flush();
 
-        return true;
+        return fail();
     }
 
     auto replymsg{server_.API().Factory().Message()};
 
     OT_ASSERT(false != bool(replymsg));
 
-    const bool processed =
-        server_.CommandProcessor().ProcessUserCommand(*request, *replymsg);
+    const auto processed = [&] {
+        const auto lock = RequestLocks::Guard{locks_, *request};
+
+        return server_.CommandProcessor().ProcessUserCommand(
+            *request, *replymsg);
+    }();
+
+    // Any request which is not read-only may have added, removed, or
+    // rescheduled cron items, so cron must recalculate its deadline
+    const auto scope =
+        RequestLocks::GetScope(Message::Type(request->m_strCommand->Get()));
+
+    if (RequestLocks::Scope::Read != scope) {
+        cron_signal_.Wake();
+    }
 
     if (false == processed) {
         LogDetail(OT_METHOD)(__FUNCTION__)(": Failed to process user command ")(
@@ -381,19 +431,17 @@ auto MessageProcessor::process_message(
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to serialize reply.")
             .Flush();
 
-        return true;
+        return fail();
     }
 
-    auto armoredReply = Armored::Factory(serializedReply);
+    reply = Message::Encode(serializedReply, encoding);
 
-    if (false == armoredReply->Exists()) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to armor reply.").Flush();
+    if (reply.empty()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to encode reply.").Flush();
 
-        return true;
+        return fail();
     }
 
-    reply.assign(armoredReply->Get(), armoredReply->GetLength());
-
     return false;
 }
 
@@ -495,6 +543,47 @@ auto MessageProcessor::query_connection(const identifier::Nym& nymID) -> OTData
 void MessageProcessor::Start()
 {
     thread_ = std::thread(&MessageProcessor::run, this);
+
+    for (auto i = std::size_t{0}; i < thread_count_; ++i) {
+        workers_.emplace_back(&MessageProcessor::work, this);
+    }
+
+    if (0 < thread_count_) {
+        LogNormal("Processing requests with ")(thread_count_)(" threads")
+            .Flush();
+    }
+}
+
+void MessageProcessor::stop_workers()
+{
+    Lock lock(queue_lock_);
+    stop_workers_ = true;
+    queue_signal_.notify_all();
+    lock.unlock();
+
+    for (auto& worker : workers_) {
+        if (worker.joinable()) { worker.join(); }
+    }
+
+    workers_.clear();
+}
+
+void MessageProcessor::work()
+{
+    while (true) {
+        Lock lock(queue_lock_);
+        queue_signal_.wait(lock, [&]() -> bool {
+            return stop_workers_ || (0 < queue_.size());
+        });
+
+        if (stop_workers_) { return; }
+
+        auto incoming = std::move(queue_.front());
+        queue_.pop_front();
+        lock.unlock();
+        // The reply takes the same path as one produced by the backend socket
+        process_internal(process_backend(incoming));
+    }
 }
 
 MessageProcessor::~MessageProcessor() { cleanup(); }
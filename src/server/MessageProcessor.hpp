@@ -6,18 +6,22 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "opentxs/Proto.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/core/Data.hpp"
 #include "opentxs/core/Flag.hpp"
 #include "opentxs/core/Identifier.hpp"
-#include "opentxs/core/Lockable.hpp"
 #include "opentxs/network/zeromq/ListenCallback.hpp"
 #include "opentxs/network/zeromq/Message.hpp"
 #include "opentxs/network/zeromq/ReplyCallback.hpp"
@@ -29,6 +33,8 @@
 #include "opentxs/network/zeromq/socket/Sender.tpp"
 #include "opentxs/network/zeromq/socket/Socket.hpp"
 #include "opentxs/protobuf/ServerRequest.pb.h"
+#include "server/CronSignal.hpp"
+#include "server/RequestLocks.hpp"
 
 namespace opentxs
 {
@@ -51,6 +57,7 @@ class Server;
 }  // namespace server
 
 class Flag;
+class Message;
 class OTPassword;
 class PasswordPrompt;
 class Secret;
@@ -58,14 +65,20 @@ class Secret;
 
 namespace opentxs::server
 {
-class MessageProcessor : Lockable
+class MessageProcessor
 {
 public:
     void DropIncoming(const int count) const;
     void DropOutgoing(const int count) const;
 
     void cleanup();
-    void init(const bool inproc, const int port, const Secret& privkey);
+    /// threads is the number of workers which process requests in parallel.
+    /// Zero processes every request on the backend socket, one at a time.
+    void init(
+        const bool inproc,
+        const int port,
+        const Secret& privkey,
+        const std::size_t threads = 0);
     void Start();
 
     explicit MessageProcessor(
@@ -95,6 +108,14 @@ private:
     // nym id, connection identifier
     std::map<OTIdentifier, OTData> active_connections_;
     mutable std::shared_mutex connection_map_lock_;
+    RequestLocks locks_;
+    std::size_t thread_count_;
+    std::vector<std::thread> workers_;
+    std::mutex queue_lock_;
+    std::condition_variable queue_signal_;
+    std::deque<OTZMQMessage> queue_;
+    bool stop_workers_;
+    CronSignal cron_signal_;
 
     static auto get_connection(const network::zeromq::Message& incoming)
         -> OTData;
@@ -123,6 +144,8 @@ private:
         const network::zeromq::Message& incoming);
     auto query_connection(const identifier::Nym& nymID) -> OTData;
     void run();
+    void stop_workers();
+    void work();
 
     MessageProcessor() = delete;
 };
@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"             // IWYU pragma: associated
+#include "1_Internal.hpp"           // IWYU pragma: associated
+#include "server/RequestLocks.hpp"  // IWYU pragma: associated
+
+#include <functional>
+#include <set>
+#include <string>
+
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+
+namespace opentxs::server
+{
+RequestLocks::RequestLocks() noexcept
+    : item_lock_()
+    , shared_lock_()
+{
+}
+
+RequestLocks::Guard::Guard(
+    const RequestLocks& parent,
+    const Message& request) noexcept
+    : shared_(parent.shared_lock_, std::defer_lock)
+    , exclusive_(parent.shared_lock_, std::defer_lock)
+    , items_()
+{
+    const auto type = Message::Type(request.m_strCommand->Get());
+
+    if (Scope::Global == GetScope(type)) {
+        exclusive_.lock();
+
+        return;
+    }
+
+    shared_.lock();
+    // Always acquire item locks in ascending order to avoid deadlocks
+    auto indices = std::set<std::size_t>{};
+    const auto hash = std::hash<std::string>{};
+
+    for (const auto& id : {request.m_strNymID, request.m_strAcctID}) {
+        if (id->Exists()) { indices.emplace(hash(id->Get()) % item_locks_); }
+    }
+
+    for (const auto& index : indices) {
+        items_.emplace_back(parent.item_lock_.at(index));
+    }
+}
+
+auto RequestLocks::Exclusive() const noexcept -> eLock
+{
+    return eLock{shared_lock_};
+}
+
+auto RequestLocks::GetScope(const MessageType type) noexcept -> Scope
+{
+    switch (type) {
+        case MessageType::pingNotary:
+        case MessageType::getRequestNumber:
+        case MessageType::checkNym:
+        case MessageType::getNymbox:
+        case MessageType::getBoxReceipt:
+        case MessageType::getAccountData:
+        case MessageType::queryInstrumentDefinitions:
+        case MessageType::getInstrumentDefinition:
+        case MessageType::getMint:
+        case MessageType::getMarketList:
+        case MessageType::getMarketOffers:
+        case MessageType::getMarketRecentTrades:
+        case MessageType::getNymMarketOffers: {
+
+            return Scope::Read;
+        }
+        // These only change the nymbox and context of the requesting nym.
+        // The Transactor serializes the transaction numbers they issue.
+        case MessageType::getTransactionNumbers:
+        case MessageType::processNymbox: {
+
+            return Scope::Write;
+        }
+        // processInbox can accept a pending transfer, which changes the
+        // sender's outbox and inbox. notarizeTransaction can change a
+        // recipient's inbox, a voucher account, a market, or cron.
+        default: {
+
+            return Scope::Global;
+        }
+    }
+}
+
+auto RequestLocks::Shared() const noexcept -> sLock
+{
+    return sLock{shared_lock_};
+}
+}  // namespace opentxs::server
@@ -0,0 +1,83 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs
+{
+class Message;
+}  // namespace opentxs
+
+namespace opentxs::server
+{
+// Decides which notary requests may run at the same time.
+//
+// Requests with a Read or Write scope take the shared lock plus striped locks
+// for the nym and account they name, so requests for different nyms and
+// accounts run in parallel while requests for the same nym or account are
+// serialized. Every other request, and cron, holds the shared lock
+// exclusively.
+class RequestLocks
+{
+public:
+    enum class Scope {
+        // May touch any nym, account, contract, market, or cron item
+        Global,
+        // Only reads shared state
+        Read,
+        // Only changes state which belongs to the nym and account the
+        // request names
+        Write,
+    };
+
+    class Guard
+    {
+    public:
+        Guard(const RequestLocks& parent, const Message& request) noexcept;
+
+        ~Guard() = default;
+
+    private:
+        sLock shared_;
+        eLock exclusive_;
+        std::vector<Lock> items_;
+
+        Guard() = delete;
+        Guard(const Guard&) = delete;
+        Guard(Guard&&) = delete;
+        auto operator=(const Guard&) -> Guard& = delete;
+        auto operator=(Guard&&) -> Guard& = delete;
+    };
+
+    static auto GetScope(const MessageType type) noexcept -> Scope;
+
+    // For work which may touch anything, such as cron
+    auto Exclusive() const noexcept -> eLock;
+    auto Shared() const noexcept -> sLock;
+
+    RequestLocks() noexcept;
+
+    ~RequestLocks() = default;
+
+private:
+    static constexpr std::size_t item_locks_{64};
+
+    mutable std::array<std::mutex, item_locks_> item_lock_;
+    mutable std::shared_mutex shared_lock_;
+
+    RequestLocks(const RequestLocks&) = delete;
+    RequestLocks(RequestLocks&&) = delete;
+    auto operator=(const RequestLocks&) -> RequestLocks& = delete;
+    auto operator=(RequestLocks&&) -> RequestLocks& = delete;
+};
+}  // namespace opentxs::server
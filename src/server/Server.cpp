@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 
+#include "core/OTStorageLMDB.hpp"
 #include "opentxs/Proto.tpp"
 #include "opentxs/SharedPimpl.hpp"
 #include "opentxs/api/Endpoints.hpp"
@@ -59,6 +60,7 @@
 #include "opentxs/protobuf/ServerContract.pb.h"
 #include "server/ConfigLoader.hpp"
 #include "server/MainFile.hpp"
+#include "server/ServerSettings.hpp"
 #include "server/Transactor.hpp"
 
 #define OTX_PUSH_VERSION 1
@@ -110,10 +112,8 @@ void Server::ActivateCron()
     }
 }
 
-/// Currently the test server calls this 10 times per second.
-/// It also processes all the input/output at the same rate.
-/// It sleeps in between. (See testserver.cpp for the call
-/// and OTSleep() for the sleep code.)
+/// MessageProcessor calls this whenever ComputeTimeout() says a cron item is
+/// due, and sleeps until the next deadline in between.
 ///
 void Server::ProcessCron()
 {
@@ -494,7 +494,48 @@ void Server::Init(bool readOnly)
         OT_FAIL;
     }
 
-    OTDB::InitDefaultStorage(OTDB_DEFAULT_STORAGE, OTDB_DEFAULT_PACKER);
+    auto storage = OTDB_DEFAULT_STORAGE;
+    const auto& legacyStorage = ServerSettings::GetLegacyStorage();
+
+    if ("lmdb" == legacyStorage) {
+#if OT_STORAGE_LMDB
+        storage = OTDB::STORE_LMDB;
+#else
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": LMDB storage is not available in this build.")
+            .Flush();
+        OT_FAIL;
+#endif  // OT_STORAGE_LMDB
+    } else if ("filesystem" != legacyStorage) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Unknown legacy_storage: ")(
+            legacyStorage)
+            .Flush();
+        OT_FAIL;
+    }
+
+    OTDB::InitDefaultStorage(storage, OTDB_DEFAULT_PACKER);
+    auto* pStorage = OTDB::GetDefaultStorage();
+
+    OT_ASSERT(nullptr != pStorage);
+
+    // The default storage is shared by every session in the process
+    if (storage != pStorage->GetType()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Warning: legacy_storage is ignored because a different storage "
+            "backend is already in use by this process.")
+            .Flush();
+    }
+
+#if OT_STORAGE_LMDB
+    // Must finish before anything else reads or writes the environment
+    if ((OTDB::STORE_LMDB == pStorage->GetType()) &&
+        (false == OTDB::StorageLMDB::Import(manager_, manager_.DataFolder()))) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Failed to import the legacy storage into LMDB.")
+            .Flush();
+        OT_FAIL;
+    }
+#endif  // OT_STORAGE_LMDB
 
     // Load up the transaction number and other Server data members.
     bool mainFileExists = WalletFilename().Exists()
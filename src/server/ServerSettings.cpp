@@ -20,6 +20,8 @@ std::int64_t ServerSettings::__min_market_scale = 1;
 std::int32_t ServerSettings::__heartbeat_no_requests = 10;
 // number of ms between each heartbeat.
 std::int32_t ServerSettings::__heartbeat_ms_between_beats = 100;
+// Backend for inboxes, outboxes, receipts, markets, cron items, etc.
+std::string ServerSettings::__legacy_storage = "filesystem";
 // The Nym who's allowed to do certain
 // commands even if they are turned off.
 std::string ServerSettings::__override_nym_id;
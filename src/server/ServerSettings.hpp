@@ -41,6 +41,16 @@ struct ServerSettings {
         __heartbeat_ms_between_beats = value;
     }
 
+    static auto GetLegacyStorage() -> const std::string&
+    {
+        return __legacy_storage;
+    }
+
+    static void SetLegacyStorage(const std::string& type)
+    {
+        __legacy_storage = type;
+    }
+
     static auto GetOverrideNymID() -> const std::string&
     {
         return __override_nym_id;
@@ -56,6 +66,9 @@ struct ServerSettings {
     static std::int32_t __heartbeat_no_requests;
     static std::int32_t __heartbeat_ms_between_beats;
 
+    // Backend for OTDB: "filesystem" or "lmdb"
+    static std::string __legacy_storage;
+
     // The Nym who's allowed to do certain commands even if they are turned off.
     static std::string __override_nym_id;
     // Are usage credits REQUIRED in order to use this server?
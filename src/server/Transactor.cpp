@@ -34,6 +34,7 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
     : server_(server)
     , reason_(reason)
     , transactionNumber_(0)
+    , number_lock_()
     , idToBasketMap_()
     , contractIdToBasketAccountId_()
     , voucherAccounts_(server.API())
@@ -50,6 +51,14 @@ Transactor::Transactor(Server& server, const PasswordPrompt& reason)
 /// can be used in transaction requests.
 auto Transactor::issueNextTransactionNumber(
     TransactionNumber& lTransactionNumber) -> bool
+{
+    Lock lock(number_lock_);
+
+    return issue_next_number(lTransactionNumber);
+}
+
+auto Transactor::issue_next_number(TransactionNumber& lTransactionNumber)
+    -> bool
 {
     // transactionNumber_ stores the last VALID AND ISSUED transaction number.
     // So first, we increment that, since we don't want to issue the same number
@@ -75,7 +84,9 @@ auto Transactor::issueNextTransactionNumberToNym(
     otx::context::Client& context,
     TransactionNumber& lTransactionNumber) -> bool
 {
-    if (!issueNextTransactionNumber(lTransactionNumber)) { return false; }
+    Lock lock(number_lock_);
+
+    if (!issue_next_number(lTransactionNumber)) { return false; }
 
     // Each Nym stores the transaction numbers that have been issued to it.
     // (On client AND server side.)
@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "opentxs/Types.hpp"
@@ -100,6 +101,8 @@ private:
     const PasswordPrompt& reason_;
     // This stores the last VALID AND ISSUED transaction number.
     TransactionNumber transactionNumber_;
+    // Requests for different nyms may issue numbers at the same time
+    std::mutex number_lock_;
     // maps basketId with basketAccountId
     BasketsMap idToBasketMap_;
     // basket issuer account ID, which is *different* on each server, using the
@@ -109,6 +112,8 @@ private:
     // The list of voucher accounts (see GetVoucherAccount below for details)
     AccountList voucherAccounts_;
 
+    auto issue_next_number(TransactionNumber& txNumber) -> bool;
+
     Transactor() = delete;
 };
 }  // namespace opentxs::server
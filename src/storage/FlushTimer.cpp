@@ -0,0 +1,63 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include "0_stdafx.hpp"            // IWYU pragma: associated
+#include "1_Internal.hpp"          // IWYU pragma: associated
+#include "storage/FlushTimer.hpp"  // IWYU pragma: associated
+
+#include <utility>
+
+#include "opentxs/Types.hpp"
+
+namespace opentxs::storage
+{
+FlushTimer::FlushTimer(
+    const std::chrono::milliseconds interval,
+    Callback flush) noexcept
+    : interval_(interval)
+    , flush_(std::move(flush))
+    , lock_()
+    , signal_()
+    , stop_(false)
+    , thread_(&FlushTimer::run, this)
+{
+}
+
+void FlushTimer::run() noexcept
+{
+    Lock lock(lock_);
+
+    while (false == stop_) {
+        if (signal_.wait_for(lock, interval_, [&] { return stop_; })) {
+            break;
+        }
+
+        // Stop() must not wait for a flush which is in progress to acquire
+        // the lock
+        lock.unlock();
+        flush_();
+        lock.lock();
+    }
+}
+
+void FlushTimer::Stop() noexcept
+{
+    {
+        Lock lock(lock_);
+
+        if (stop_) { return; }
+
+        stop_ = true;
+    }
+
+    signal_.notify_all();
+
+    if (thread_.joinable()) { thread_.join(); }
+
+    flush_();
+}
+
+FlushTimer::~FlushTimer() { Stop(); }
+}  // namespace opentxs::storage
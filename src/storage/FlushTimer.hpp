@@ -0,0 +1,49 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace opentxs::storage
+{
+// Runs the write-back flush of the storage tree on a dedicated thread once
+// per interval, and once more when it is stopped, so a deferred change is
+// committed no later than one interval after it was made
+class FlushTimer
+{
+public:
+    using Callback = std::function<void()>;
+
+    // Stops the thread, then runs the final flush
+    void Stop() noexcept;
+
+    FlushTimer(
+        const std::chrono::milliseconds interval,
+        Callback flush) noexcept;
+
+    ~FlushTimer();
+
+private:
+    const std::chrono::milliseconds interval_;
+    const Callback flush_;
+    std::mutex lock_;
+    std::condition_variable signal_;
+    bool stop_;
+    std::thread thread_;
+
+    void run() noexcept;
+
+    FlushTimer() = delete;
+    FlushTimer(const FlushTimer&) = delete;
+    FlushTimer(FlushTimer&&) = delete;
+    auto operator=(const FlushTimer&) -> FlushTimer& = delete;
+    auto operator=(FlushTimer&&) -> FlushTimer& = delete;
+};
+}  // namespace opentxs::storage
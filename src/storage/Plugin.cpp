@@ -7,7 +7,10 @@
 #include "1_Internal.hpp"      // IWYU pragma: associated
 #include "storage/Plugin.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
+#include <iterator>
 #include <thread>
+#include <utility>
 
 #include "opentxs/api/storage/Storage.hpp"
 #include "opentxs/core/Log.hpp"
@@ -28,6 +31,12 @@ Plugin::Plugin(
     , storage_(storage)
     , digest_(hash)
     , current_bucket_(bucket)
+    , write_lock_()
+    , write_ready_()
+    , write_space_()
+    , writes_()
+    , writers_()
+    , shutdown_(false)
 {
 }
 
@@ -130,9 +139,35 @@ void Plugin::Store(
     const bool bucket,
     std::promise<bool>& promise) const
 {
-    std::thread thread(
-        &Plugin::store, this, isTransaction, key, value, bucket, &promise);
-    thread.detach();
+    Lock lock(write_lock_);
+
+    if (shutdown_) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Shutting down").Flush();
+        promise.set_value(false);
+
+        return;
+    }
+
+    if (writers_.empty()) {
+        // Threads are started on first use because the driver is not fully
+        // constructed until after the Plugin constructor returns
+        for (auto i = std::size_t{0}; i < writer_count_; ++i) {
+            writers_.emplace_back(&Plugin::write_thread, this);
+        }
+    }
+
+    write_space_.wait(
+        lock, [&] { return shutdown_ || (writes_.size() < queue_limit_); });
+
+    if (shutdown_) {
+        promise.set_value(false);
+
+        return;
+    }
+
+    writes_.push_back(Write{isTransaction, key, value, bucket, &promise});
+    lock.unlock();
+    write_ready_.notify_one();
 }
 
 auto Plugin::Store(
@@ -150,4 +185,65 @@ auto Plugin::Store(
 
     return false;
 }
+
+void Plugin::store_batch(const WriteBatch& batch) const
+{
+    for (const auto& write : batch) {
+        store(
+            write.isTransaction_,
+            write.key_,
+            write.value_,
+            write.bucket_,
+            write.promise_);
+    }
+}
+
+void Plugin::stop_writers() const noexcept
+{
+    auto writers = std::vector<std::thread>{};
+
+    {
+        Lock lock(write_lock_);
+        shutdown_ = true;
+        writers.swap(writers_);
+    }
+
+    write_ready_.notify_all();
+    write_space_.notify_all();
+
+    for (auto& thread : writers) {
+        if (thread.joinable()) { thread.join(); }
+    }
+}
+
+void Plugin::write_thread() const noexcept
+{
+    auto batch = WriteBatch{};
+    batch.reserve(batch_limit_);
+
+    while (true) {
+        {
+            Lock lock(write_lock_);
+            write_ready_.wait(
+                lock, [&] { return shutdown_ || (false == writes_.empty()); });
+
+            // Queued writes are drained before the thread exits so that no
+            // promise is left unsatisfied
+            if (writes_.empty()) { return; }
+
+            const auto count = std::min(writes_.size(), batch_limit_);
+            const auto end = std::next(writes_.begin(), count);
+            std::move(writes_.begin(), end, std::back_inserter(batch));
+            writes_.erase(writes_.begin(), end);
+        }
+
+        write_space_.notify_all();
+        store_batch(batch);
+        batch.clear();
+    }
+}
+
+// The writer threads call the driver's virtual functions so they must be
+// stopped by the driver itself. By now the driver is already destroyed.
+Plugin::~Plugin() { OT_ASSERT(writers_.empty()); }
 }  // namespace opentxs
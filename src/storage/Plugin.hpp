@@ -6,9 +6,15 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
 #include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "opentxs/Bytes.hpp"
 #include "opentxs/Proto.hpp"
@@ -71,9 +77,19 @@ public:
 
     virtual void Cleanup() = 0;
 
-    ~Plugin() override = default;
+    ~Plugin() override;
 
 protected:
+    struct Write {
+        bool isTransaction_;
+        std::string key_;
+        std::string value_;
+        bool bucket_;
+        std::promise<bool>* promise_;
+    };
+
+    using WriteBatch = std::vector<Write>;
+
     const StorageConfig& config_;
     const Random& random_;
 
@@ -91,11 +107,31 @@ protected:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const = 0;
+    // Called by the writer pool with up to batch_limit_ queued writes.
+    // Drivers which can apply several keys in one transaction should override
+    // this. Every promise in the batch must be satisfied before returning.
+    virtual void store_batch(const WriteBatch& batch) const;
+    // Must be called by the destructor and Cleanup() of every driver before
+    // its members are destroyed since the writer threads call back into the
+    // driver.
+    void stop_writers() const noexcept;
 
 private:
+    static constexpr std::size_t writer_count_{2};
+    static constexpr std::size_t queue_limit_{1024};
+    static constexpr std::size_t batch_limit_{256};
+
     const api::storage::Storage& storage_;
     const Digest& digest_;
     const Flag& current_bucket_;
+    mutable std::mutex write_lock_;
+    mutable std::condition_variable write_ready_;
+    mutable std::condition_variable write_space_;
+    mutable std::deque<Write> writes_;
+    mutable std::vector<std::thread> writers_;
+    mutable bool shutdown_;
+
+    void write_thread() const noexcept;
 
     Plugin(const Plugin&) = delete;
     Plugin(Plugin&&) = delete;
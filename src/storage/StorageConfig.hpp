@@ -35,6 +35,9 @@ public:
         C::duration_cast<C::seconds>(C::hours(1)).count();
     std::string path_{};
     InsertCB dht_callback_{};
+    // Milliseconds between flushes of the storage tree. Zero disables
+    // write-back mode so every change commits a new root immediately.
+    std::int64_t write_back_interval_{0};
 
 #if OT_STORAGE_LMDB
     std::string primary_plugin_ = OT_STORAGE_PRIMARY_PLUGIN_LMDB;
@@ -107,6 +107,9 @@ private:
     void Init_StorageExample();
 
     /** Polymorphic cleanup method. Child class-specific actions go here.
+     *
+     *  \note This must call \ref stop_writers before it releases anything
+     *        which \ref store uses.
      */
     void Cleanup_StorageExample();
 
@@ -106,10 +106,7 @@ void StorageFSArchive::Cleanup()
     ot_super::Cleanup();
 }
 
-void StorageFSArchive::Cleanup_StorageFSArchive()
-{
-    // future cleanup actions go here
-}
+void StorageFSArchive::Cleanup_StorageFSArchive() { stop_writers(); }
 
 auto StorageFSArchive::EmptyBucket(const bool) const -> bool { return true; }
 
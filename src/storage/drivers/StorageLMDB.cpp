@@ -7,8 +7,10 @@
 #include "1_Internal.hpp"                   // IWYU pragma: associated
 #include "storage/drivers/StorageLMDB.hpp"  // IWYU pragma: associated
 
+#include <cstddef>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "2_Factory.hpp"
 #include "opentxs/core/Log.hpp"
@@ -61,7 +63,7 @@ StorageLMDB::StorageLMDB(
 
 void StorageLMDB::Cleanup() { Cleanup_StorageLMDB(); }
 
-void StorageLMDB::Cleanup_StorageLMDB() {}
+void StorageLMDB::Cleanup_StorageLMDB() { stop_writers(); }
 
 auto StorageLMDB::EmptyBucket(const bool bucket) const -> bool
 {
@@ -109,14 +111,42 @@ void StorageLMDB::store(
     std::promise<bool>* promise) const
 {
     if (isTransaction) {
-        lmdb_.Queue(get_table(bucket), key, value);
-        promise->set_value(true);
+        promise->set_value(lmdb_.Queue(get_table(bucket), key, value));
     } else {
         const auto output = lmdb_.Store(get_table(bucket), key, value);
         promise->set_value(output.first);
     }
 }
 
+void StorageLMDB::store_batch(const WriteBatch& batch) const
+{
+    auto commit{false};
+    auto queued = std::vector<bool>{};
+    queued.reserve(batch.size());
+
+    for (const auto& write : batch) {
+        const auto added =
+            lmdb_.Queue(get_table(write.bucket_), write.key_, write.value_);
+        queued.emplace_back(added);
+
+        if (false == added) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to queue ")(
+                write.key_)
+                .Flush();
+        }
+
+        commit |= (added && (false == write.isTransaction_));
+    }
+
+    // Non-transactional writes must be durable before their promises are
+    // satisfied, so every write in the batch shares a single commit
+    const auto success = commit ? lmdb_.Commit() : true;
+
+    for (auto i = std::size_t{0}; i < batch.size(); ++i) {
+        batch.at(i).promise_->set_value(queued.at(i) && success);
+    }
+}
+
 auto StorageLMDB::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
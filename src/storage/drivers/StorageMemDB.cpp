@@ -94,6 +94,8 @@ void StorageMemDB::store(
 {
     OT_ASSERT(nullptr != promise);
 
+    eLock lock(shared_lock_);
+
     if (bucket) {
         a_[key] = value;
     } else {
@@ -51,9 +51,9 @@ public:
     auto StoreRoot(const bool commit, const std::string& hash) const
         -> bool final;
 
-    void Cleanup() final {}
+    void Cleanup() final { stop_writers(); }
 
-    ~StorageMemDB() final = default;
+    ~StorageMemDB() final { stop_writers(); }
 
 private:
     using ot_super = Plugin;
@@ -433,6 +433,10 @@ auto StorageMultiplex::Store(
 
     std::vector<std::promise<bool>> promises{};
     std::vector<std::future<bool>> futures{};
+    // The plugins hold pointers to these promises so the vector must never
+    // reallocate
+    promises.reserve(1 + backup_plugins_.size());
+    futures.reserve(1 + backup_plugins_.size());
     promises.push_back(std::promise<bool>());
     auto& primaryPromise = promises.back();
     futures.push_back(primaryPromise.get_future());
@@ -67,7 +67,13 @@ auto StorageSqlite3::bind_key(
 
 void StorageSqlite3::Cleanup() { Cleanup_StorageSqlite3(); }
 
-void StorageSqlite3::Cleanup_StorageSqlite3() { sqlite3_close(db_); }
+void StorageSqlite3::Cleanup_StorageSqlite3()
+{
+    stop_writers();
+    Lock lock(connection_lock_);
+    sqlite3_close(db_);
+    db_ = nullptr;
+}
 
 void StorageSqlite3::commit(std::stringstream& sql) const
 {
@@ -78,6 +84,7 @@ auto StorageSqlite3::commit_transaction(const std::string& rootHash) const
     -> bool
 {
     Lock lock(transaction_lock_);
+    Lock connection(connection_lock_);
     std::stringstream sql{};
     start_transaction(sql);
     set_data(sql);
@@ -124,6 +131,7 @@ auto StorageSqlite3::GetTableName(const bool bucket) const -> std::string
 void StorageSqlite3::Init_StorageSqlite3()
 {
     const std::string filename = folder_ + "/" + config_.sqlite3_db_file_;
+    Lock lock(connection_lock_);
 
     if (SQLITE_OK ==
         sqlite3_open_v2(
@@ -168,6 +176,7 @@ auto StorageSqlite3::LoadRoot() const -> std::string
 auto StorageSqlite3::Purge(const std::string& tablename) const -> bool
 {
     const std::string sql = "DROP TABLE `" + tablename + "`;";
+    Lock lock(connection_lock_);
 
     if (SQLITE_OK ==
         sqlite3_exec(db_, sql.c_str(), nullptr, nullptr, nullptr)) {
@@ -185,6 +194,7 @@ auto StorageSqlite3::Select(
     sqlite3_stmt* statement{nullptr};
     const std::string query =
         "SELECT v FROM '" + tablename + "' WHERE k GLOB ?1;";
+    Lock lock(connection_lock_);
     const auto sql = bind_key(query, key, 1);
     sqlite3_prepare_v2(db_, sql.c_str(), -1, &statement, nullptr);
     LogVerbose(OT_METHOD)(__FUNCTION__)(sql).Flush();
@@ -313,10 +323,58 @@ void StorageSqlite3::store(
         pending_.emplace_back(key, value);
         promise->set_value(true);
     } else {
+        Lock lock(connection_lock_);
         promise->set_value(Upsert(key, GetTableName(bucket), value));
     }
 }
 
+void StorageSqlite3::store_batch(const WriteBatch& batch) const
+{
+    auto direct = std::vector<const Write*>{};
+
+    {
+        Lock lock(transaction_lock_);
+
+        for (const auto& write : batch) {
+            if (write.isTransaction_) {
+                transaction_bucket_->Set(write.bucket_);
+                pending_.emplace_back(write.key_, write.value_);
+                write.promise_->set_value(true);
+            } else {
+                direct.emplace_back(&write);
+            }
+        }
+    }
+
+    if (direct.empty()) { return; }
+
+    Lock lock(connection_lock_);
+    auto success =
+        SQLITE_OK ==
+        sqlite3_exec(db_, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
+
+    for (const auto* write : direct) {
+        if (false == success) { break; }
+
+        success =
+            Upsert(write->key_, GetTableName(write->bucket_), write->value_);
+    }
+
+    if (success) {
+        success =
+            SQLITE_OK ==
+            sqlite3_exec(db_, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr);
+    }
+
+    // A failed COMMIT leaves the transaction open
+    if (false == success) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to write batch").Flush();
+        sqlite3_exec(db_, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr);
+    }
+
+    for (const auto* write : direct) { write->promise_->set_value(success); }
+}
+
 auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
     -> bool
 {
@@ -324,6 +382,7 @@ auto StorageSqlite3::StoreRoot(const bool commit, const std::string& hash) const
 
         return commit_transaction(hash);
     } else {
+        Lock lock(connection_lock_);
 
         return Upsert(
             config_.sqlite3_root_key_, config_.sqlite3_control_table_, hash);
@@ -68,7 +68,11 @@ private:
     friend Factory;
 
     std::string folder_;
+    // Protects pending_. Always locked before connection_lock_.
     mutable std::mutex transaction_lock_;
+    // Serializes every use of db_. It is held from BEGIN to COMMIT so that
+    // statements from other threads never run inside a transaction.
+    mutable std::mutex connection_lock_;
     mutable OTFlag transaction_bucket_;
     mutable std::vector<std::pair<const std::string, const std::string>>
         pending_;
@@ -80,6 +84,7 @@ private:
         const std::size_t start) const -> std::string;
     void commit(std::stringstream& sql) const;
     auto commit_transaction(const std::string& rootHash) const -> bool;
+    // The caller must hold connection_lock_
     auto Create(const std::string& tablename) const -> bool;
     auto expand_sql(sqlite3_stmt* statement) const -> std::string;
     auto GetTableName(const bool bucket) const -> std::string;
@@ -97,6 +102,8 @@ private:
         const std::string& value,
         const bool bucket,
         std::promise<bool>* promise) const final;
+    void store_batch(const WriteBatch& batch) const final;
+    // The caller must hold connection_lock_
     auto Upsert(
         const std::string& key,
         const std::string& tablename,
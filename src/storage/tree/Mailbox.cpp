@@ -41,6 +41,13 @@ Mailbox::Mailbox(
 
 auto Mailbox::Delete(const std::string& id) -> bool { return delete_item(id); }
 
+auto Mailbox::ForTestingOnlyFactory(
+    const opentxs::api::storage::Driver& storage,
+    const std::string& hash) -> std::unique_ptr<Mailbox>
+{
+    return std::unique_ptr<Mailbox>{new Mailbox(storage, hash)};
+}
+
 void Mailbox::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageNymList> serialized;
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <memory>
 #include <mutex>
 #include <string>
 
@@ -46,6 +47,11 @@ private:
     auto operator=(Mailbox &&) -> Mailbox = delete;
 
 public:
+    // Mailboxes are normally owned by a Nym node
+    static auto ForTestingOnlyFactory(
+        const opentxs::api::storage::Driver& storage,
+        const std::string& hash) -> std::unique_ptr<Mailbox>;
+
     auto Load(
         const std::string& id,
         std::string& output,
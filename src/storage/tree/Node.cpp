@@ -28,6 +28,9 @@ Node::Node(const opentxs::api::storage::Driver& storage, const std::string& key)
     , root_(key)
     , write_lock_()
     , item_map_()
+    , write_back_(false)
+    , dirty_(false)
+    , dirty_children_()
 {
 }
 
@@ -79,6 +82,61 @@ auto Node::extract_revision(const proto::Seed& input) const -> std::uint64_t
     return input.index();
 }
 
+auto Node::flush() const -> bool
+{
+    Lock lock(write_lock_);
+
+    return flush(lock);
+}
+
+auto Node::flush(const Lock& lock) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    auto children = decltype(dirty_children_){};
+    children.swap(dirty_children_);
+    auto output{true};
+
+    // Children are written first so the hashes copied into this node by the
+    // update callbacks are final. A child which fails stays dirty and is
+    // retried by the next flush.
+    for (auto& [child, update] : children) {
+        OT_ASSERT(nullptr != child);
+
+        if (child->flush()) {
+            update();
+        } else {
+            dirty_children_.emplace(child, std::move(update));
+            output = false;
+        }
+    }
+
+    if (false == dirty_) { return output; }
+
+    if (false == save(lock)) { return false; }
+
+    dirty_ = (false == dirty_children_.empty());
+
+    return output;
+}
+
+auto Node::flush_child(const Lock& lock, const Node* child) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock))
+
+    auto it = dirty_children_.find(child);
+
+    if (dirty_children_.end() == it) { return true; }
+
+    if (false == child->flush()) { return false; }
+
+    const auto update = std::move(it->second);
+    dirty_children_.erase(it);
+    update();
+
+    return true;
+}
+
 auto Node::get_alias(const std::string& id) const -> std::string
 {
     std::string output;
@@ -274,6 +332,31 @@ auto Node::store_raw(
     return save(lock);
 }
 
+void Node::share_write_back(Node& child) const
+{
+    child.write_back_ = write_back_;
+}
+
+auto Node::update_child(
+    const Lock& lock,
+    const Node* child,
+    std::function<void()> update) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock))
+    OT_ASSERT(nullptr != child)
+
+    if (write_back_) {
+        dirty_children_[child] = std::move(update);
+        dirty_ = true;
+
+        return true;
+    }
+
+    update();
+
+    return save(lock);
+}
+
 auto Node::UpgradeLevel() const -> VersionNumber { return original_version_; }
 
 auto Node::verify_write_lock(const Lock& lock) const -> bool
@@ -207,11 +207,19 @@ protected:
     mutable std::string root_;
     mutable std::mutex write_lock_;
     mutable Index item_map_;
+    // In write-back mode a parent node records which children have changed
+    // instead of saving itself. The changes are written by flush().
+    bool write_back_;
+    mutable bool dirty_;
+    mutable std::map<const Node*, std::function<void()>> dirty_children_;
 
     static auto normalize_hash(const std::string& hash) -> std::string;
 
     auto check_hash(const std::string& hash) const -> bool;
     auto extract_revision(const proto::Contact& input) const -> std::uint64_t;
+    auto flush() const -> bool;
+    auto flush(const Lock& lock) const -> bool;
+    auto flush_child(const Lock& lock, const Node* child) const -> bool;
     auto extract_revision(const proto::Nym& input) const -> std::uint64_t;
     auto extract_revision(const proto::Seed& input) const -> std::uint64_t;
     auto get_alias(const std::string& id) const -> std::string;
@@ -265,6 +273,11 @@ protected:
         const std::string& data,
         const std::string& id,
         const std::string& alias) -> bool;
+    void share_write_back(Node& child) const;
+    auto update_child(
+        const Lock& lock,
+        const Node* child,
+        std::function<void()> update) const -> bool;
     auto verify_write_lock(const Lock& lock) const -> bool;
 
     virtual void init(const std::string& hash) = 0;
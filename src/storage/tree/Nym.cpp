@@ -67,11 +67,12 @@ void Nym::_save(
         OT_FAIL;
     }
 
-    Lock rootLock(mutex);
-    root = input->Root();
-    rootLock.unlock();
+    const auto update = [input, &mutex, &root] {
+        Lock rootLock(mutex);
+        root = input->Root();
+    };
 
-    if (false == save(lock)) {
+    if (false == update_child(lock, input, update)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Save error.").Flush();
         OT_FAIL;
     }
@@ -202,6 +203,8 @@ auto Nym::construct(
                 .Flush();
             OT_FAIL;
         }
+
+        share_write_back(*pointer);
     }
 
     lock.unlock();
@@ -676,11 +679,12 @@ void Nym::_save(
         OT_FAIL;
     }
 
-    Lock rootLock(mutex);
-    root = input->Root();
-    rootLock.unlock();
+    const auto update = [input, &mutex, &root] {
+        Lock rootLock(mutex);
+        root = input->Root();
+    };
 
-    if (false == save(lock)) {
+    if (false == update_child(lock, input, update)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Save error.").Flush();
         OT_FAIL;
     }
@@ -152,6 +152,8 @@ auto Nyms::nym(const Lock& lock, const std::string& id) const -> storage::Nym*
                 .Flush();
             abort();
         }
+
+        share_write_back(*node);
     }
 
     return node.get();
@@ -225,15 +227,17 @@ void Nyms::save(storage::Nym* nym, const Lock& lock, const std::string& id)
         abort();
     }
 
-    auto& index = item_map_[id];
-    auto& hash = std::get<0>(index);
-    auto& alias = std::get<1>(index);
-    hash = nym->Root();
-    alias = nym->Alias();
+    // Only the hash waits for the nym to be written. The rest of the index
+    // must be current even in write-back mode.
+    std::get<1>(item_map_[id]) = nym->Alias();
 
     if (nym->private_.get()) { local_nyms_.emplace(nym->nymid_); }
 
-    if (!save(lock)) {
+    const auto update = [this, nym, id] {
+        std::get<0>(item_map_[id]) = nym->Root();
+    };
+
+    if (!update_child(lock, nym, update)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Save error.").Flush();
         abort();
     }
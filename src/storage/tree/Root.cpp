@@ -32,7 +32,8 @@ Root::Root(
     const opentxs::api::storage::Driver& storage,
     const std::string& hash,
     const std::int64_t interval,
-    Flag& bucket)
+    Flag& bucket,
+    const bool writeBack)
     : ot_super(storage, hash)
     , gc_interval_(interval)
     , gc_root_()
@@ -47,6 +48,8 @@ Root::Root(
     , tree_lock_()
     , tree_()
 {
+    write_back_ = writeBack;
+
     if (check_hash(hash)) {
         init(hash);
     } else {
@@ -86,6 +89,9 @@ void Root::collect_garbage(const opentxs::api::storage::Driver* to) const
     if (resume) {
         oldLocation = !current_bucket_;
     } else {
+        // Deferred changes must be part of the tree being migrated, otherwise
+        // objects they reference would be lost when the old bucket is emptied
+        flush(lock);
         gc_root_ = tree()->Root();
         oldLocation = current_bucket_.Toggle();
         save(lock);
@@ -204,11 +210,11 @@ void Root::save(storage::Tree* tree, const Lock& lock)
 
     OT_ASSERT(nullptr != tree);
 
-    Lock treeLock(tree_lock_);
-    tree_root_ = tree->root_;
-    treeLock.unlock();
-
-    const bool saved = save(lock);
+    const auto update = [this, tree] {
+        Lock treeLock(tree_lock_);
+        tree_root_ = tree->root_;
+    };
+    const bool saved = update_child(lock, tree, update);
 
     OT_ASSERT(saved);
 }
@@ -240,7 +246,10 @@ auto Root::tree() const -> storage::Tree*
 {
     Lock lock(tree_lock_);
 
-    if (!tree_) { tree_.reset(new storage::Tree(driver_, tree_root_)); }
+    if (!tree_) {
+        tree_.reset(new storage::Tree(driver_, tree_root_));
+        share_write_back(*tree_);
+    }
 
     OT_ASSERT(tree_);
 
@@ -79,7 +79,8 @@ private:
         const opentxs::api::storage::Driver& storage,
         const std::string& hash,
         const std::int64_t interval,
-        Flag& bucket);
+        Flag& bucket,
+        const bool writeBack = false);
     Root() = delete;
     Root(const Root&) = delete;
     Root(Root&&) = delete;
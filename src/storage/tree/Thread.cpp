@@ -7,6 +7,7 @@
 #include "1_Internal.hpp"           // IWYU pragma: associated
 #include "storage/tree/Thread.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -16,8 +17,11 @@
 #include "opentxs/protobuf/Check.hpp"
 #include "opentxs/protobuf/StorageThread.pb.h"
 #include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/StorageThreadPage.pb.h"
+#include "opentxs/protobuf/StorageThreadPageHash.pb.h"
 #include "opentxs/protobuf/verify/StorageThread.hpp"
 #include "opentxs/protobuf/verify/StorageThreadItem.hpp"
+#include "opentxs/protobuf/verify/StorageThreadPage.hpp"
 #include "storage/Plugin.hpp"
 #include "storage/tree/Mailbox.hpp"
 #include "storage/tree/Node.hpp"
@@ -42,12 +46,14 @@ Thread::Thread(
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
     , items_()
+    , locations_()
+    , pages_()
     , participants_()
 {
     if (check_hash(hash)) {
         init(hash);
     } else {
-        blank(1);
+        blank(current_version_);
     }
 }
 
@@ -64,9 +70,11 @@ Thread::Thread(
     , mail_inbox_(mailInbox)
     , mail_outbox_(mailOutbox)
     , items_()
+    , locations_()
+    , pages_()
     , participants_(participants)
 {
-    blank(1);
+    blank(current_version_);
 }
 
 auto Thread::Add(
@@ -113,8 +121,25 @@ auto Thread::Add(
         return false;
     }
 
-    auto& item = items_[id];
-    item.set_version(version_);
+    const auto existing = find(lock, id);
+    auto page = std::size_t{};
+
+    if (existing.has_value()) {
+        page = existing.value();
+    } else {
+        if (pages_.empty() || (page_size_ <= pages_.back().items_.size())) {
+            auto& blank = pages_.emplace_back();
+            blank.loaded_ = true;
+        }
+
+        page = pages_.size() - 1u;
+    }
+
+    if (false == load_page(lock, page)) { return false; }
+
+    auto item =
+        existing.has_value() ? items_.at(id) : proto::StorageThreadItem{};
+    item.set_version(item_version_);
     item.set_id(id);
 
     if (0 == index) {
@@ -135,11 +160,13 @@ auto Thread::Add(
 
     const auto valid = proto::Validate(item, VERBOSE);
 
-    if (false == valid) {
-        items_.erase(id);
+    if (false == valid) { return false; }
 
-        return false;
-    }
+    items_[id] = item;
+    locations_[id] = page;
+    auto& target = pages_.at(page);
+    target.items_.emplace(id);
+    target.dirty_ = true;
 
     return save(lock);
 }
@@ -151,6 +178,51 @@ auto Thread::Alias() const -> std::string
     return alias_;
 }
 
+void Thread::drop_empty_pages(const Lock& lock) const
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    // Unloaded pages are never empty since the index only lists pages with
+    // at least one item
+    const auto empty = [](const auto& page) {
+        return page.loaded_ && page.items_.empty();
+    };
+
+    if (pages_.end() == std::find_if(pages_.begin(), pages_.end(), empty)) {
+        return;
+    }
+
+    pages_.erase(
+        std::remove_if(pages_.begin(), pages_.end(), empty), pages_.end());
+
+    for (auto i = std::size_t{0}; i < pages_.size(); ++i) {
+        for (const auto& id : pages_.at(i).items_) { locations_[id] = i; }
+    }
+}
+
+auto Thread::find(const Lock& lock, const std::string& id) const
+    -> std::optional<std::size_t>
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    const auto it = locations_.find(id);
+
+    if (locations_.end() != it) { return it->second; }
+
+    // Recent items are the most likely to be requested
+    for (auto i = pages_.size(); i > 0u; --i) {
+        const auto page = i - 1u;
+
+        if (pages_.at(page).loaded_) { continue; }
+
+        if (false == load_page(lock, page)) { continue; }
+
+        if (0u < pages_.at(page).items_.count(id)) { return page; }
+    }
+
+    return std::nullopt;
+}
+
 void Thread::init(const std::string& hash)
 {
     std::shared_ptr<proto::StorageThread> serialized;
@@ -163,20 +235,49 @@ void Thread::init(const std::string& hash)
         OT_FAIL;
     }
 
-    init_version(1, *serialized);
+    init_version(current_version_, *serialized);
 
     for (const auto& participant : serialized->participant()) {
         participants_.emplace(participant);
     }
 
-    for (const auto& it : serialized->item()) {
-        const auto& index = it.index();
-        items_.emplace(it.id(), it);
+    Lock lock(write_lock_);
 
-        if (index >= index_) { index_ = index + 1; }
+    for (const auto& it : serialized->page()) {
+        auto& page = pages_.emplace_back();
+        page.hash_ = it.hash();
+        page.count_ = it.count();
+        page.unread_ = it.unread();
+        page.index_ = it.index();
+
+        if (page.index_ >= index_) { index_ = page.index_ + 1; }
+    }
+
+    if (0 < serialized->item_size()) {
+        // Version 1 threads keep every item in the index. They are split into
+        // pages here and written out by the next save.
+        for (const auto& it : serialized->item()) {
+            const auto& index = it.index();
+            items_.emplace(it.id(), it);
+
+            if (index >= index_) { index_ = index + 1; }
+        }
+
+        for (const auto& [key, item] : sort(lock)) {
+            OT_ASSERT(nullptr != item);
+
+            if (pages_.empty() || (page_size_ <= pages_.back().items_.size())) {
+                auto& page = pages_.emplace_back();
+                page.loaded_ = true;
+                page.dirty_ = true;
+            }
+
+            const auto& id = item->id();
+            pages_.back().items_.emplace(id);
+            locations_[id] = pages_.size() - 1u;
+        }
     }
 
-    Lock lock(write_lock_);
     upgrade(lock);
 }
 
@@ -184,7 +285,29 @@ auto Thread::Check(const std::string& id) const -> bool
 {
     Lock lock(write_lock_);
 
-    return items_.end() != items_.find(id);
+    return find(lock, id).has_value();
+}
+
+auto Thread::ForTestingOnlyFactory(
+    const opentxs::api::storage::Driver& storage,
+    const std::string& id,
+    const std::string& hash,
+    Mailbox& mailInbox,
+    Mailbox& mailOutbox) -> std::unique_ptr<Thread>
+{
+    return std::unique_ptr<Thread>{
+        new Thread(storage, id, hash, {}, mailInbox, mailOutbox)};
+}
+
+auto Thread::ForTestingOnlyFactory(
+    const opentxs::api::storage::Driver& storage,
+    const std::string& id,
+    const std::set<std::string>& participants,
+    Mailbox& mailInbox,
+    Mailbox& mailOutbox) -> std::unique_ptr<Thread>
+{
+    return std::unique_ptr<Thread>{
+        new Thread(storage, id, participants, mailInbox, mailOutbox)};
 }
 
 auto Thread::ID() const -> std::string { return id_; }
@@ -193,29 +316,88 @@ auto Thread::Items() const -> proto::StorageThread
 {
     Lock lock(write_lock_);
 
+    if (false == load_all(lock)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load all pages.")
+            .Flush();
+    }
+
     return serialize(lock);
 }
 
+auto Thread::load_all(const Lock& lock) const -> bool
+{
+    auto output{true};
+
+    for (auto i = std::size_t{0}; i < pages_.size(); ++i) {
+        output &= load_page(lock, i);
+    }
+
+    return output;
+}
+
+auto Thread::load_page(const Lock& lock, const std::size_t index) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock));
+
+    auto& page = pages_.at(index);
+
+    if (page.loaded_) { return true; }
+
+    std::shared_ptr<proto::StorageThreadPage> serialized;
+
+    if (false == driver_.LoadProto(page.hash_, serialized, false)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to load page ")(index)
+            .Flush();
+
+        return false;
+    }
+
+    if (static_cast<std::size_t>(serialized->item_size()) != page.count_) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Page ")(index)(
+            " does not match the index")
+            .Flush();
+
+        return false;
+    }
+
+    for (const auto& item : serialized->item()) {
+        const auto& id = item.id();
+        items_[id] = item;
+        locations_[id] = index;
+        page.items_.emplace(id);
+    }
+
+    page.loaded_ = true;
+
+    return true;
+}
+
 auto Thread::Migrate(const opentxs::api::storage::Driver& to) const -> bool
 {
-    return Node::migrate(root_, to);
+    Lock lock(write_lock_);
+    auto output = Node::migrate(root_, to);
+
+    for (const auto& page : pages_) { output &= Node::migrate(page.hash_, to); }
+
+    return output;
 }
 
 auto Thread::Read(const std::string& id, const bool unread) -> bool
 {
     Lock lock(write_lock_);
 
-    auto it = items_.find(id);
+    const auto page = find(lock, id);
 
-    if (items_.end() == it) {
+    if (false == page.has_value()) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Item does not exist.").Flush();
 
         return false;
     }
 
-    auto& item = it->second;
+    if (false == load_page(lock, page.value())) { return false; }
 
-    item.set_unread(unread);
+    items_.at(id).set_unread(unread);
+    pages_.at(page.value()).dirty_ = true;
 
     return save(lock);
 }
@@ -224,13 +406,23 @@ auto Thread::Remove(const std::string& id) -> bool
 {
     Lock lock(write_lock_);
 
+    const auto page = find(lock, id);
+
+    if (false == page.has_value()) { return false; }
+
+    if (false == load_page(lock, page.value())) { return false; }
+
     auto it = items_.find(id);
 
-    if (items_.end() == it) { return false; }
+    OT_ASSERT(items_.end() != it);
 
     auto& item = it->second;
     auto box = static_cast<StorageBox>(item.box());
     items_.erase(it);
+    locations_.erase(id);
+    auto& container = pages_.at(page.value());
+    container.items_.erase(id);
+    container.dirty_ = true;
 
     switch (box) {
         case StorageBox::MAILINBOX: {
@@ -268,19 +460,88 @@ auto Thread::save(const Lock& lock) const -> bool
 {
     OT_ASSERT(verify_write_lock(lock));
 
-    auto serialized = serialize(lock);
+    for (auto& page : pages_) {
+        if (page.dirty_ && (false == save_page(lock, page))) { return false; }
+    }
+
+    drop_empty_pages(lock);
+
+    proto::StorageThread serialized;
+    serialized.set_version(version_);
+    serialized.set_id(id_);
+
+    for (const auto& nym : participants_) {
+        if (!nym.empty()) { *serialized.add_participant() = nym; }
+    }
+
+    for (const auto& page : pages_) {
+        auto& hash = *serialized.add_page();
+        hash.set_version(page_hash_version_);
+        hash.set_hash(page.hash_);
+        hash.set_count(page.count_);
+        hash.set_unread(page.unread_);
+        hash.set_index(page.index_);
+    }
 
     if (!proto::Validate(serialized, VERBOSE)) { return false; }
 
     return driver_.StoreProto(serialized, root_);
 }
 
+auto Thread::save_page(const Lock& lock, Page& page) const -> bool
+{
+    OT_ASSERT(verify_write_lock(lock));
+    OT_ASSERT(page.loaded_);
+
+    SortedItems sorted;
+
+    for (const auto& id : page.items_) {
+        const auto& item = items_.at(id);
+        sorted.emplace(SortKey{item.index(), item.time(), id}, &item);
+    }
+
+    proto::StorageThreadPage serialized;
+    serialized.set_version(page_version_);
+    auto count = std::size_t{0};
+    auto unread = std::size_t{0};
+    auto index = std::uint64_t{0};
+
+    for (const auto& it : sorted) {
+        OT_ASSERT(nullptr != it.second);
+
+        const auto& item = *it.second;
+        *serialized.add_item() = item;
+        ++count;
+
+        if (item.unread()) { ++unread; }
+
+        index = std::max(index, item.index());
+    }
+
+    if (0u < count) {
+        if (!proto::Validate(serialized, VERBOSE)) { return false; }
+
+        if (false == driver_.StoreProto(serialized, page.hash_)) {
+            return false;
+        }
+    } else {
+        page.hash_.clear();
+    }
+
+    page.count_ = count;
+    page.unread_ = unread;
+    page.index_ = index;
+    page.dirty_ = false;
+
+    return true;
+}
+
 auto Thread::serialize(const Lock& lock) const -> proto::StorageThread
 {
     OT_ASSERT(verify_write_lock(lock));
 
     proto::StorageThread serialized;
-    serialized.set_version(version_);
+    serialized.set_version(list_version_);
     serialized.set_id(id_);
 
     for (const auto& nym : participants_) {
@@ -332,10 +593,16 @@ auto Thread::UnreadCount() const -> std::size_t
     Lock lock(write_lock_);
     std::size_t output{0};
 
-    for (const auto& it : items_) {
-        const auto& item = it.second;
+    for (const auto& page : pages_) {
+        if (false == page.loaded_) {
+            output += page.unread_;
+
+            continue;
+        }
 
-        if (item.unread()) { ++output; }
+        for (const auto& id : page.items_) {
+            if (items_.at(id).unread()) { ++output; }
+        }
     }
 
     return output;
@@ -355,6 +622,7 @@ void Thread::upgrade(const Lock& lock)
             case StorageBox::MAILOUTBOX: {
                 if (item.unread()) {
                     item.set_unread(false);
+                    pages_.at(locations_.at(it.first)).dirty_ = true;
                     changed = true;
                 }
             } break;
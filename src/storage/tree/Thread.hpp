@@ -9,9 +9,12 @@
 #include <iosfwd>
 #include <list>
 #include <map>
+#include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include "opentxs/Proto.hpp"
 #include "opentxs/Types.hpp"
@@ -48,18 +51,48 @@ private:
     using SortKey = std::tuple<std::size_t, std::int64_t, std::string>;
     using SortedItems = std::map<SortKey, const proto::StorageThreadItem*>;
 
+    // Items are stored in pages so that adding, reading or removing one item
+    // only rewrites the page which contains it plus the page index. The index
+    // only records the hash and counts of each page. Pages, including the ids
+    // of their items, are loaded on demand.
+    struct Page {
+        std::string hash_{};
+        std::size_t count_{};
+        std::size_t unread_{};
+        std::uint64_t index_{};
+        bool loaded_{};
+        bool dirty_{};
+        std::set<std::string> items_{};
+    };
+
+    static constexpr std::size_t page_size_{256};
+    static constexpr VersionNumber current_version_{2};
+    static constexpr VersionNumber item_version_{1};
+    static constexpr VersionNumber list_version_{1};
+    static constexpr VersionNumber page_version_{1};
+    static constexpr VersionNumber page_hash_version_{1};
+
     std::string id_;
     std::string alias_;
     std::size_t index_;
     Mailbox& mail_inbox_;
     Mailbox& mail_outbox_;
-    std::map<std::string, proto::StorageThreadItem> items_;
+    // These contain items from loaded pages only
+    mutable std::map<std::string, proto::StorageThreadItem> items_;
+    mutable std::map<std::string, std::size_t> locations_;
+    mutable std::vector<Page> pages_;
     // It's important to use a sorted container for this so the thread ID can be
     // calculated deterministically
     std::set<std::string> participants_;
 
+    void drop_empty_pages(const Lock& lock) const;
+    auto find(const Lock& lock, const std::string& id) const
+        -> std::optional<std::size_t>;
     void init(const std::string& hash) final;
+    auto load_all(const Lock& lock) const -> bool;
+    auto load_page(const Lock& lock, const std::size_t index) const -> bool;
     auto save(const Lock& lock) const -> bool final;
+    auto save_page(const Lock& lock, Page& page) const -> bool;
     auto serialize(const Lock& lock) const -> proto::StorageThread;
     auto sort(const Lock& lock) const -> SortedItems;
     void upgrade(const Lock& lock);
@@ -84,6 +117,20 @@ private:
     auto operator=(Thread &&) -> Thread = delete;
 
 public:
+    // Threads are normally owned by a Threads node
+    static auto ForTestingOnlyFactory(
+        const opentxs::api::storage::Driver& storage,
+        const std::string& id,
+        const std::string& hash,
+        Mailbox& mailInbox,
+        Mailbox& mailOutbox) -> std::unique_ptr<Thread>;
+    static auto ForTestingOnlyFactory(
+        const opentxs::api::storage::Driver& storage,
+        const std::string& id,
+        const std::set<std::string>& participants,
+        Mailbox& mailInbox,
+        Mailbox& mailOutbox) -> std::unique_ptr<Thread>;
+
     auto Alias() const -> std::string;
     auto Check(const std::string& id) const -> bool;
     auto ID() const -> std::string;
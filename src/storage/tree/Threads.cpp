@@ -338,6 +338,10 @@ auto Threads::Rename(const std::string& existingID, const std::string& newID)
 
     OT_ASSERT(oldThread);
 
+    // A deferred update would otherwise be written under the old id
+    if (false == flush_child(lock, oldThread.get())) { return false; }
+
+    meta = it->second;
     std::unique_ptr<storage::Thread> newThread{nullptr};
 
     if (false == oldThread->Rename(newID)) {
@@ -401,13 +405,14 @@ void Threads::save(
         abort();
     }
 
-    auto& index = item_map_[id];
-    auto& hash = std::get<0>(index);
-    auto& alias = std::get<1>(index);
-    hash = nym->Root();
-    alias = nym->Alias();
+    // Only the hash waits for the thread to be written
+    std::get<1>(item_map_[id]) = nym->Alias();
+
+    const auto update = [this, nym, id] {
+        std::get<0>(item_map_[id]) = nym->Root();
+    };
 
-    if (!save(lock)) {
+    if (!update_child(lock, nym, update)) {
         std::cerr << __FUNCTION__ << ": Save error" << std::endl;
         abort();
     }
@@ -157,6 +157,8 @@ auto Tree::get_child(
 
             OT_FAIL;
         }
+
+        share_write_back(*pointer);
     }
 
     lock.unlock();
@@ -337,11 +339,12 @@ void Tree::save_child(
         OT_FAIL
     }
 
-    Lock rootLock(hashLock);
-    hash = input->Root();
-    rootLock.unlock();
+    const auto update = [input, &hashLock, &hash] {
+        Lock rootLock(hashLock);
+        hash = input->Root();
+    };
 
-    if (false == save(lock)) {
+    if (false == update_child(lock, input, update)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Save error.").Flush();
         OT_FAIL
     }
@@ -8,7 +8,11 @@
 #if OT_STORAGE_LMDB
 #include "util/LMDB.hpp"  // IWYU pragma: associated
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
 #include <stdexcept>
 
 #include "opentxs/Types.hpp"
@@ -17,25 +21,74 @@
 
 #define OT_METHOD "opentxs::storage::lmdb::LMDB::"
 
+namespace
+{
+// Environments in which the current thread holds a write transaction.
+// Beginning another one in the same environment would deadlock.
+thread_local auto writers_ = std::vector<const MDB_env*>{};
+
+auto add_writer(const MDB_env* env) noexcept -> void
+{
+    writers_.emplace_back(env);
+}
+
+auto remove_writer(const MDB_env* env) noexcept -> void
+{
+    const auto it = std::find(writers_.begin(), writers_.end(), env);
+
+    if (writers_.end() != it) { writers_.erase(it); }
+}
+
+struct WriteGuard {
+    WriteGuard(const MDB_env* env) noexcept
+        : env_(env)
+    {
+        add_writer(env_);
+    }
+
+    ~WriteGuard() { remove_writer(env_); }
+
+private:
+    const MDB_env* env_;
+};
+}  // namespace
+
 namespace opentxs::storage::lmdb
 {
 LMDB::LMDB(
     const TableNames& names,
     const std::string& folder,
     const TablesToInit init,
-    const Flags flags) noexcept
+    const Flags flags,
+    const std::size_t size) noexcept
     : names_(names)
     , env_(nullptr)
     , db_(init.size())
     , pending_()
+    , committing_()
+    , metrics_()
+    , dupsort_(init.size(), false)
     , lock_()
+    , commit_lock_()
+    , flush_signal_()
+    , queued_(false)
+    , failed_(false)
+    , overlaid_(false)
+    , running_(true)
+    , start_flusher_()
+    , flusher_()
+    , readers_()
+    , readers_lock_()
 {
-    init_environment(folder, init.size(), flags);
+    // Read transactions are cached and may be used by any thread
+    init_environment(folder, init.size(), flags | MDB_NOTLS, size);
     init_tables(init);
 }
 
 LMDB::Transaction::Transaction(MDB_env* env, const bool rw) noexcept(false)
     : success_(false)
+    , parent_(nullptr)
+    , writer_(rw ? env : nullptr)
     , ptr_(nullptr)
 {
     const Flags flags = rw ? 0u : MDB_RDONLY;
@@ -43,10 +96,22 @@ LMDB::Transaction::Transaction(MDB_env* env, const bool rw) noexcept(false)
     if (0 != ::mdb_txn_begin(env, nullptr, flags, &ptr_)) {
         throw std::runtime_error("Failed to start transaction");
     }
+
+    if (nullptr != writer_) { add_writer(writer_); }
+}
+
+LMDB::Transaction::Transaction(const LMDB& parent) noexcept(false)
+    : success_(false)
+    , parent_(&parent)
+    , writer_(nullptr)
+    , ptr_(parent.get_reader())
+{
 }
 
 LMDB::Transaction::Transaction(Transaction&& rhs) noexcept
     : success_(rhs.success_)
+    , parent_(rhs.parent_)
+    , writer_(rhs.writer_)
     , ptr_(rhs.ptr_)
 {
     rhs.ptr_ = nullptr;
@@ -72,7 +137,13 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
         auto cleanup = Cleanup{ptr_};
 
-        if (success_) {
+        if (nullptr != writer_) { remove_writer(writer_); }
+
+        if (nullptr != parent_) {
+            parent_->release_reader(ptr_);
+
+            return true;
+        } else if (success_) {
             return 0 == ::mdb_txn_commit(ptr_);
         } else {
             ::mdb_txn_abort(ptr_);
@@ -86,63 +157,106 @@ auto LMDB::Transaction::Finalize(const std::optional<bool> success) noexcept
 
 LMDB::Transaction::~Transaction() { Finalize(); }
 
-auto LMDB::Commit() const noexcept -> bool
+auto LMDB::apply(MDB_txn* txn, const NewKey& write) const noexcept -> bool
 {
-    struct Cleanup {
-        bool success_;
-
-        Cleanup(const LMDB& parent, MDB_txn*& transaction)
-            : success_(false)
-            , parent_(parent)
-            , transaction_(transaction)
-        {
-        }
+    const auto& [table, flags, index, data] = write;
+    const auto database = db_.at(table);
+    auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
 
-        ~Cleanup()
-        {
-            if (nullptr != transaction_) {
-                if (success_) {
-                    ::mdb_txn_commit(transaction_);
-                } else {
-                    ::mdb_txn_abort(transaction_);
-                }
+    if (false == data.has_value()) {
+        const auto rc = ::mdb_del(txn, database, &key, nullptr);
 
-                transaction_ = nullptr;
-            }
+        return (0 == rc) || (MDB_NOTFOUND == rc);
+    }
 
-            parent_.pending_.clear();
-        }
+    const auto& bytes = data.value();
+    auto value = MDB_val{bytes.size(), const_cast<char*>(bytes.data())};
+    const auto rc = ::mdb_put(txn, database, &key, &value, flags);
 
-    private:
-        const LMDB& parent_;
-        MDB_txn*& transaction_;
-    };
+    if ((MDB_KEYEXIST == rc) && (0 != (flags & MDB_NOOVERWRITE))) {
+        return true;
+    }
 
-    Lock lock(lock_);
-    MDB_txn* transaction{nullptr};
+    return 0 == rc;
+}
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, 0, &transaction)) {
-        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
+auto LMDB::Commit() const noexcept -> bool
+{
+    if (holds_write()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Unable to commit while holding a write transaction")
             .Flush();
 
         return false;
     }
 
-    OT_ASSERT(nullptr != transaction);
+    auto commit = Lock{commit_lock_};
 
-    Cleanup cleanup(*this, transaction);
+    {
+        auto lock = Lock{lock_};
 
-    for (auto& [table, mode, index, data] : pending_) {
-        auto database = db_.at(table);
-        auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
-        auto value = MDB_val{data.size(), const_cast<char*>(data.data())};
-        cleanup.success_ =
-            0 == ::mdb_put(transaction, database, &key, &value, 0);
+        if (pending_.writes_.empty()) { return true; }
 
-        if (false == cleanup.success_) { break; }
+        std::swap(committing_, pending_);
+        queued_.store(false);
     }
 
-    return cleanup.success_;
+    const auto start = Clock::now();
+    const auto& batch = committing_;
+    auto success{false};
+    MDB_txn* transaction{nullptr};
+
+    if (0 == ::mdb_txn_begin(env_, nullptr, 0, &transaction)) {
+        OT_ASSERT(nullptr != transaction);
+
+        success = true;
+
+        for (const auto& write : batch.writes_) {
+            if (false == apply(transaction, write)) {
+                success = false;
+                break;
+            }
+        }
+
+        if (success) {
+            success = 0 == ::mdb_txn_commit(transaction);
+        } else {
+            ::mdb_txn_abort(transaction);
+        }
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - start);
+    const auto count = batch.writes_.size();
+    const auto bytes = batch.bytes_;
+
+    auto lock = Lock{lock_};
+
+    if (success) {
+        LogTrace(OT_METHOD)(__FUNCTION__)(": Committed ")(count)(
+            " writes totaling ")(bytes)(" bytes in ")(elapsed.count())(" µs")
+            .Flush();
+        ++metrics_.batches_;
+        metrics_.writes_ += count;
+        metrics_.bytes_ += bytes;
+        metrics_.largest_batch_ = std::max(metrics_.largest_batch_, count);
+        metrics_.last_latency_ = elapsed;
+        metrics_.max_latency_ = std::max(metrics_.max_latency_, elapsed);
+        metrics_.total_latency_ += elapsed;
+        committing_ = Batch{};
+        failed_.store(false);
+    } else {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to commit ")(count)(
+            " queued writes. The batch will be retried.")
+            .Flush();
+        ++metrics_.failures_;
+        restore(lock);
+        failed_.store(true);
+    }
+
+    overlaid_.store(false == pending_.writes_.empty());
+
+    return success;
 }
 
 auto LMDB::Delete(const Table table, MDB_txn* parent) const noexcept -> bool
@@ -175,6 +289,9 @@ auto LMDB::Delete(const Table table, MDB_txn* parent) const noexcept -> bool
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
+    // Queued writes must not be reordered after this one
+    if ((nullptr == parent) && (false == flush())) { return false; }
+
     MDB_txn* transaction{nullptr};
 
     if (0 != ::mdb_txn_begin(env_, parent, 0, &transaction)) {
@@ -224,6 +341,9 @@ auto LMDB::Delete(const Table table, const ReadView index, MDB_txn* parent)
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
+    // Queued writes must not be reordered after this one
+    if ((nullptr == parent) && (false == flush())) { return false; }
+
     MDB_txn* transaction{nullptr};
 
     if (0 != ::mdb_txn_begin(env_, parent, 0, &transaction)) {
@@ -290,6 +410,9 @@ auto LMDB::Delete(
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
+    // Queued writes must not be reordered after this one
+    if ((nullptr == parent) && (false == flush())) { return false; }
+
     MDB_txn* transaction{nullptr};
 
     if (0 != ::mdb_txn_begin(env_, parent, 0, &transaction)) {
@@ -310,15 +433,28 @@ auto LMDB::Delete(
     return cleanup.success_;
 }
 
-auto LMDB::Exists(const Table table, const ReadView index) const noexcept
-    -> bool
+auto LMDB::Exists(const Table table, const ReadView index, MDB_txn* txn)
+    const noexcept -> bool
+{
+    if (const auto queued = overlay(table, index); queued.has_value()) {
+        const auto& [replace, values] = queued.value();
+
+        if (replace || (false == values.empty())) {
+            return false == values.empty();
+        }
+    }
+
+    return exists(table, index, txn);
+}
+
+auto LMDB::exists(const Table table, const ReadView index, MDB_txn* txn)
+    const noexcept -> bool
 {
     struct Cleanup {
         bool success_;
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
+        Cleanup(MDB_cursor*& cursor)
             : success_(false)
-            , transaction_(transaction)
             , cursor_(cursor)
         {
         }
@@ -329,36 +465,30 @@ auto LMDB::Exists(const Table table, const ReadView index) const noexcept
                 ::mdb_cursor_close(cursor_);
                 cursor_ = nullptr;
             }
-
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
         }
 
     private:
-        MDB_txn*& transaction_;
         MDB_cursor*& cursor_;
     };
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
-    MDB_txn* transaction{nullptr};
+    auto snapshot = std::optional<Transaction>{};
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
+    try {
+        txn = read_transaction(txn, snapshot);
+    } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
             .Flush();
 
         return false;
     }
 
-    OT_ASSERT(nullptr != transaction);
-
     MDB_cursor* cursor{nullptr};
-    Cleanup cleanup(transaction, cursor);
+    Cleanup cleanup(cursor);
     const auto database = db_.at(table);
 
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
+    if (0 != ::mdb_cursor_open(txn, database, &cursor)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
 
         return false;
@@ -371,6 +501,78 @@ auto LMDB::Exists(const Table table, const ReadView index) const noexcept
     return cleanup.success_;
 }
 
+auto LMDB::flush() const noexcept -> bool
+{
+    // A thread which holds a write transaction can not start another one. Its
+    // queued writes are committed by the flusher after it finishes.
+    if (false == queued_.load()) { return true; }
+
+    return holds_write() || Commit();
+}
+
+auto LMDB::flush_periodically() const noexcept -> void
+{
+    auto lock = Lock{lock_};
+
+    while (running_.load()) {
+        if (pending_.writes_.empty()) {
+            flush_signal_.wait(lock, [&] {
+                return (false == running_.load()) ||
+                       (false == pending_.writes_.empty());
+            });
+
+            continue;
+        }
+
+        const auto due = pending_.started_ + batch_interval_;
+        // A batch which failed to commit is retried after batch_interval_
+        // even if it is full
+        flush_signal_.wait_until(lock, due, [&] {
+            return (false == running_.load()) || pending_.writes_.empty() ||
+                   ((false == failed_.load()) &&
+                    (batch_bytes_ <= pending_.bytes_));
+        });
+
+        if (pending_.writes_.empty()) { continue; }
+
+        lock.unlock();
+        Commit();
+        lock.lock();
+    }
+}
+
+auto LMDB::get_reader() const noexcept(false) -> MDB_txn*
+{
+    auto output = [&]() -> MDB_txn* {
+        auto lock = Lock{readers_lock_};
+
+        if (readers_.empty()) { return nullptr; }
+
+        auto* txn = readers_.back();
+        readers_.pop_back();
+
+        return txn;
+    }();
+
+    if (nullptr != output) {
+        if (0 == ::mdb_txn_renew(output)) { return output; }
+
+        ::mdb_txn_abort(output);
+        output = nullptr;
+    }
+
+    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &output)) {
+        throw std::runtime_error("Failed to start transaction");
+    }
+
+    return output;
+}
+
+auto LMDB::holds_write() const noexcept -> bool
+{
+    return writers_.end() != std::find(writers_.begin(), writers_.end(), env_);
+}
+
 auto LMDB::init_db(const Table table, const std::size_t flags) noexcept
     -> MDB_dbi
 {
@@ -396,14 +598,15 @@ auto LMDB::init_db(const Table table, const std::size_t flags) noexcept
 auto LMDB::init_environment(
     const std::string& folder,
     const std::size_t tables,
-    const Flags flags) noexcept -> void
+    const Flags flags,
+    const std::size_t size) noexcept -> void
 {
     bool set = 0 == ::mdb_env_create(&env_);
 
     OT_ASSERT(set);
     OT_ASSERT(nullptr != env_);
 
-    set = 0 == ::mdb_env_set_mapsize(env_, OT_LMDB_SIZE);
+    set = 0 == ::mdb_env_set_mapsize(env_, size);
 
     OT_ASSERT(set);
 
@@ -411,7 +614,7 @@ auto LMDB::init_environment(
 
     OT_ASSERT(set);
 
-    set = 0 == ::mdb_env_set_maxreaders(env_, 1024u);
+    set = 0 == ::mdb_env_set_maxreaders(env_, max_readers_);
 
     OT_ASSERT(set);
 
@@ -424,6 +627,7 @@ auto LMDB::init_tables(const TablesToInit init) noexcept -> void
 {
     for (const auto& [table, flags] : init) {
         db_[table] = init_db(table, flags);
+        dupsort_[table] = (MDB_DUPSORT == (flags & MDB_DUPSORT));
     }
 }
 
@@ -431,14 +635,60 @@ auto LMDB::Load(
     const Table table,
     const ReadView index,
     const Callback cb,
-    const Mode multiple) const noexcept -> bool
+    const Mode mode,
+    MDB_txn* txn) const noexcept -> bool
+{
+    auto queued = overlay(table, index);
+
+    if (false == queued.has_value()) {
+        return load(table, index, cb, mode, txn);
+    }
+
+    auto& [replace, values] = queued.value();
+
+    if (false == replace) {
+        auto stored = std::vector<std::string>{};
+        load(
+            table,
+            index,
+            [&](const auto in) { stored.emplace_back(in); },
+            Mode::Multiple,
+            txn);
+
+        // A batch committed after the overlay was copied will be visible in
+        // both places
+        for (auto& value : values) {
+            const auto it = std::find(stored.begin(), stored.end(), value);
+
+            if (stored.end() == it) { stored.emplace_back(std::move(value)); }
+        }
+
+        values.swap(stored);
+    }
+
+    if (values.empty()) { return false; }
+
+    if (Mode::One == mode) {
+        cb(values.front());
+    } else {
+        for (const auto& value : values) { cb(value); }
+    }
+
+    return true;
+}
+
+auto LMDB::load(
+    const Table table,
+    const ReadView index,
+    const Callback cb,
+    const Mode multiple,
+    MDB_txn* txn) const noexcept -> bool
 {
     struct Cleanup {
         bool success_;
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
+        Cleanup(MDB_cursor*& cursor)
             : success_(false)
-            , transaction_(transaction)
             , cursor_(cursor)
         {
         }
@@ -449,36 +699,30 @@ auto LMDB::Load(
                 ::mdb_cursor_close(cursor_);
                 cursor_ = nullptr;
             }
-
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
         }
 
     private:
-        MDB_txn*& transaction_;
         MDB_cursor*& cursor_;
     };
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
-    MDB_txn* transaction{nullptr};
+    auto snapshot = std::optional<Transaction>{};
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
+    try {
+        txn = read_transaction(txn, snapshot);
+    } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
             .Flush();
 
         return false;
     }
 
-    OT_ASSERT(nullptr != transaction);
-
     MDB_cursor* cursor{nullptr};
-    Cleanup cleanup(transaction, cursor);
+    Cleanup cleanup(cursor);
     const auto database = db_.at(table);
 
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
+    if (0 != ::mdb_cursor_open(txn, database, &cursor)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
 
         return false;
@@ -518,38 +762,375 @@ auto LMDB::Load(
     const Table table,
     const std::size_t index,
     const Callback cb,
-    const Mode mode) const noexcept -> bool
+    const Mode mode,
+    MDB_txn* txn) const noexcept -> bool
 {
     return Load(
         table,
         ReadView{reinterpret_cast<const char*>(&index), sizeof(index)},
         cb,
-        mode);
+        mode,
+        txn);
+}
+
+auto LMDB::LoadMany(
+    const Table table,
+    const std::vector<ReadView>& keys,
+    const IndexedCallback cb,
+    MDB_txn* txn) const noexcept -> bool
+{
+    struct Cleanup {
+        bool success_;
+
+        Cleanup(MDB_cursor*& cursor)
+            : success_(false)
+            , cursor_(cursor)
+        {
+        }
+
+        ~Cleanup()
+        {
+            if (nullptr != cursor_) {
+                ::mdb_cursor_close(cursor_);
+                cursor_ = nullptr;
+            }
+        }
+
+    private:
+        MDB_cursor*& cursor_;
+    };
+
+    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
+
+    auto snapshot = std::optional<Transaction>{};
+
+    try {
+        txn = read_transaction(txn, snapshot);
+    } catch (...) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
+            .Flush();
+
+        return false;
+    }
+
+    MDB_cursor* cursor{nullptr};
+    Cleanup cleanup(cursor);
+    const auto database = db_.at(table);
+
+    if (0 != ::mdb_cursor_open(txn, database, &cursor)) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
+
+        return false;
+    }
+
+    // Visiting the keys in database order lets the cursor reuse the pages it
+    // already holds instead of descending from the root for every key
+    auto order = std::vector<std::size_t>(keys.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [&](const auto lhs, const auto rhs) {
+        const auto& left = keys[lhs];
+        const auto& right = keys[rhs];
+        auto a = MDB_val{left.size(), const_cast<char*>(left.data())};
+        auto b = MDB_val{right.size(), const_cast<char*>(right.data())};
+
+        return 0 > ::mdb_cmp(txn, database, &a, &b);
+    });
+
+    try {
+        for (const auto i : order) {
+            const auto& index = keys[i];
+
+            if (overlay(table, index).has_value()) {
+                auto more{true};
+                Load(
+                    table,
+                    index,
+                    [&](const auto in) { more = cb(i, in); },
+                    Mode::One,
+                    txn);
+
+                if (more) { continue; }
+
+                break;
+            }
+
+            auto key = MDB_val{index.size(), const_cast<char*>(index.data())};
+            auto value = MDB_val{};
+
+            if (0 != ::mdb_cursor_get(cursor, &key, &value, MDB_SET_KEY)) {
+                continue;
+            }
+
+            if (false ==
+                cb(i, {static_cast<char*>(value.mv_data), value.mv_size})) {
+                break;
+            }
+        }
+    } catch (const std::exception& e) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
+
+        return false;
+    }
+
+    cleanup.success_ = true;
+
+    return cleanup.success_;
+}
+
+auto LMDB::Metrics() const noexcept -> BatchMetrics
+{
+    auto lock = Lock{lock_};
+
+    return metrics_;
+}
+
+auto LMDB::overlay(const Table table, const ReadView key) const noexcept
+    -> std::optional<Pending>
+{
+    auto output = std::optional<Pending>{};
+
+    if (false == overlaid_.load()) { return output; }
+
+    const auto index = std::pair<Table, std::string>{table, key};
+    auto lock = Lock{lock_};
+
+    for (const auto* batch : {&committing_, &pending_}) {
+        const auto& map = batch->overlay_;
+
+        if (auto it = map.find(index); map.end() != it) {
+            const auto& entry = it->second;
+
+            if (entry.replace_ || (false == output.has_value())) {
+                output = entry;
+            } else {
+                auto& values = output->values_;
+                values.insert(
+                    values.end(), entry.values_.begin(), entry.values_.end());
+            }
+        }
+    }
+
+    return output;
+}
+
+auto LMDB::overlay(
+    const Table table,
+    const ReadView start,
+    const std::optional<ReadView> end,
+    const std::optional<ReadView> prefix,
+    const Dir dir,
+    MDB_txn* txn) const noexcept -> Queued
+{
+    auto output = Queued{};
+
+    if (false == overlaid_.load()) { return output; }
+
+    const auto forward = (Dir::Forward == dir);
+    const auto database = db_.at(table);
+    auto compare = [&](const std::string& lhs, const ReadView rhs) {
+        auto left = MDB_val{lhs.size(), const_cast<char*>(lhs.data())};
+        auto right = MDB_val{rhs.size(), const_cast<char*>(rhs.data())};
+
+        return ::mdb_cmp(txn, database, &left, &right);
+    };
+    auto merged = std::map<std::string, Pending>{};
+
+    {
+        auto lock = Lock{lock_};
+
+        for (const auto* batch : {&committing_, &pending_}) {
+            const auto& map = batch->overlay_;
+
+            for (auto it = map.lower_bound({table, std::string{}});
+                 (map.end() != it) && (table == it->first.first);
+                 ++it) {
+                const auto& [index, entry] = *it;
+                const auto& key = index.second;
+
+                if (prefix.has_value()) {
+                    if (0 != key.compare(0, prefix->size(), prefix.value())) {
+                        continue;
+                    }
+                } else {
+                    if (false == start.empty()) {
+                        const auto cmp = compare(key, start);
+
+                        if (forward ? (0 > cmp) : (0 < cmp)) { continue; }
+                    }
+
+                    if (end.has_value()) {
+                        const auto cmp = compare(key, end.value());
+
+                        if (forward ? (0 < cmp) : (0 > cmp)) { continue; }
+                    }
+                }
+
+                auto [pos, added] = merged.try_emplace(key, entry);
+
+                if (added) { continue; }
+
+                auto& existing = pos->second;
+
+                if (entry.replace_) {
+                    existing = entry;
+                } else {
+                    existing.values_.insert(
+                        existing.values_.end(),
+                        entry.values_.begin(),
+                        entry.values_.end());
+                }
+            }
+        }
+    }
+
+    output.assign(merged.begin(), merged.end());
+    std::sort(output.begin(), output.end(), [&](const auto& l, const auto& r) {
+        const auto cmp = compare(l.first, r.first);
+
+        return forward ? (0 > cmp) : (0 < cmp);
+    });
+
+    return output;
+}
+
+auto LMDB::queue(NewKey&& write) const noexcept -> bool
+{
+    OT_ASSERT(static_cast<std::size_t>(std::get<0>(write)) < db_.size());
+
+    std::call_once(start_flusher_, [this] {
+        flusher_ = std::thread{&LMDB::flush_periodically, this};
+    });
+    auto& [table, flags, index, data] = write;
+
+    if (failed_.load()) {
+        LogOutput(OT_METHOD)(__FUNCTION__)(
+            ": Queued writes can not be committed")
+            .Flush();
+
+        return false;
+    }
+
+    // Writes which can never succeed must not be allowed into a batch since
+    // they would cause every commit to fail
+    {
+        const auto limit =
+            static_cast<std::size_t>(::mdb_env_get_maxkeysize(env_));
+        const auto invalid =
+            (0 != (flags & ~Flags{MDB_NOOVERWRITE})) || index.empty() ||
+            (limit < index.size()) ||
+            (data.has_value() && dupsort_.at(table) &&
+             (limit < data->size()));
+
+        if (invalid) {
+            LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid write").Flush();
+
+            return false;
+        }
+    }
+
+    const auto keep = data.has_value() && (0 != (flags & MDB_NOOVERWRITE));
+
+    // The existing value wins, so there is nothing to write
+    if (keep && Exists(table, index)) { return true; }
+
+    auto full{false};
+
+    {
+        auto lock = Lock{lock_};
+        auto& batch = pending_;
+        auto& entry = batch.overlay_[{table, index}];
+
+        if (data.has_value()) {
+            if (keep && (false == entry.values_.empty())) { return true; }
+
+            if (false == dupsort_.at(table)) {
+                entry.replace_ = true;
+                entry.values_.clear();
+            }
+
+            entry.values_.emplace_back(data.value());
+            batch.bytes_ += data->size();
+        } else {
+            entry.replace_ = true;
+            entry.values_.clear();
+        }
+
+        if (batch.writes_.empty()) {
+            batch.started_ = Clock::now();
+            flush_signal_.notify_one();
+        }
+
+        batch.bytes_ += index.size();
+        batch.writes_.emplace_back(std::move(write));
+        queued_.store(true);
+        overlaid_.store(true);
+        full = (batch_bytes_ <= batch.bytes_);
+    }
+
+    if (full) {
+        // The flusher commits the batch if this thread can not
+        if (false == holds_write()) { return Commit(); }
+
+        flush_signal_.notify_one();
+    }
+
+    return true;
 }
 
 auto LMDB::Queue(
     const Table table,
     const ReadView key,
     const ReadView value,
-    const Mode mode) const noexcept -> bool
+    const Flags flags) const noexcept -> bool
 {
-    OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
+    return queue(NewKey{table, flags, std::string{key}, std::string{value}});
+}
 
-    Lock lock(lock_);
-    pending_.emplace_back(NewKey{table, mode, key, value});
+auto LMDB::QueueDelete(const Table table, const ReadView key) const noexcept
+    -> bool
+{
+    return queue(NewKey{table, 0, std::string{key}, std::nullopt});
+}
 
-    return true;
+auto LMDB::Read(
+    const Table table,
+    const ReadCallback cb,
+    const Dir dir,
+    MDB_txn* txn) const noexcept -> bool
+{
+    auto visited{false};
+    const auto success = read(
+        table,
+        {},
+        std::nullopt,
+        std::nullopt,
+        [&](const auto key, const auto value) {
+            visited = true;
+
+            return cb(key, value);
+        },
+        dir,
+        0,
+        txn);
+
+    return success && visited;
 }
 
-auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir)
-    const noexcept -> bool
+auto LMDB::read(
+    const Table table,
+    const ReadView start,
+    const std::optional<ReadView> end,
+    const std::optional<ReadView> prefix,
+    const ReadCallback cb,
+    const Dir dir,
+    const std::size_t limit,
+    MDB_txn* txn) const noexcept -> bool
 {
     struct Cleanup {
         bool success_;
 
-        Cleanup(MDB_txn*& transaction, MDB_cursor*& cursor)
+        Cleanup(MDB_cursor*& cursor)
             : success_(false)
-            , transaction_(transaction)
             , cursor_(cursor)
         {
         }
@@ -560,72 +1141,195 @@ auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir)
                 ::mdb_cursor_close(cursor_);
                 cursor_ = nullptr;
             }
-
-            if (nullptr != transaction_) {
-                ::mdb_txn_abort(transaction_);
-                transaction_ = nullptr;
-            }
         }
 
     private:
-        MDB_txn*& transaction_;
         MDB_cursor*& cursor_;
     };
 
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
-    MDB_txn* transaction{nullptr};
+    auto snapshot = std::optional<Transaction>{};
 
-    if (0 != ::mdb_txn_begin(env_, nullptr, MDB_RDONLY, &transaction)) {
+    try {
+        txn = read_transaction(txn, snapshot);
+    } catch (...) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to start transaction")
             .Flush();
 
         return false;
     }
 
-    OT_ASSERT(nullptr != transaction);
-
     MDB_cursor* cursor{nullptr};
-    auto cleanup = Cleanup{transaction, cursor};
+    Cleanup cleanup(cursor);
     const auto database = db_.at(table);
 
-    if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
+    if (0 != ::mdb_cursor_open(txn, database, &cursor)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Failed to get cursor").Flush();
 
         return false;
     }
 
-    const auto start =
-        MDB_cursor_op{(Dir::Forward == dir) ? MDB_FIRST : MDB_LAST};
-    const auto next =
-        MDB_cursor_op{(Dir::Forward == dir) ? MDB_NEXT : MDB_PREV};
-    auto again{true};
+    const auto forward = (Dir::Forward == dir);
+    const auto next = MDB_cursor_op{forward ? MDB_NEXT : MDB_PREV};
     auto key = MDB_val{};
     auto value = MDB_val{};
-    cleanup.success_ = 0 == ::mdb_cursor_get(cursor, &key, &value, start);
+    auto seek = space(start);
 
-    try {
-        if (cleanup.success_) {
-            if (0 == ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-                again =
-                    cb({static_cast<char*>(key.mv_data), key.mv_size},
-                       {static_cast<char*>(value.mv_data), value.mv_size});
+    if ((false == forward) && prefix.has_value()) {
+        // Seek past the last key which could begin with the prefix
+        while ((false == seek.empty()) && (std::byte{0xff} == seek.back())) {
+            seek.pop_back();
+        }
+
+        if (false == seek.empty()) {
+            const auto last = std::to_integer<std::uint8_t>(seek.back());
+            seek.back() = std::byte{static_cast<std::uint8_t>(last + 1u)};
+        }
+    }
+
+    auto positioned{false};
+
+    if (seek.empty()) {
+        const auto op = MDB_cursor_op{forward ? MDB_FIRST : MDB_LAST};
+        positioned = 0 == ::mdb_cursor_get(cursor, &key, &value, op);
+    } else {
+        key = MDB_val{seek.size(), seek.data()};
+        const auto found =
+            0 == ::mdb_cursor_get(cursor, &key, &value, MDB_SET_RANGE);
+
+        if (forward) {
+            positioned = found;
+        } else if (false == found) {
+            positioned = 0 == ::mdb_cursor_get(cursor, &key, &value, MDB_LAST);
+        } else {
+            auto target = MDB_val{seek.size(), seek.data()};
+            const auto exact =
+                (false == prefix.has_value()) &&
+                (0 == ::mdb_cmp(txn, database, &key, &target));
+
+            if (exact) {
+                ::mdb_cursor_get(cursor, &key, &value, MDB_LAST_DUP);
+                positioned = true;
             } else {
+                positioned =
+                    0 == ::mdb_cursor_get(cursor, &key, &value, MDB_PREV);
+            }
+        }
+    }
+
+    auto bound = MDB_val{};
+
+    if (end.has_value()) {
+        bound = MDB_val{end->size(), const_cast<char*>(end->data())};
+    }
+
+    // Queued writes are merged into the scan instead of being committed first
+    const auto queued = overlay(table, start, end, prefix, dir, txn);
+    auto pending = queued.begin();
+    // The queued entry for the key at the cursor, if any
+    const std::pair<std::string, Pending>* active{nullptr};
+    auto stored = std::vector<std::string>{};
+    auto count = std::size_t{0};
+    auto compare = [&](const std::string& lhs, MDB_val& rhs) {
+        auto left = MDB_val{lhs.size(), const_cast<char*>(lhs.data())};
+        const auto cmp = ::mdb_cmp(txn, database, &left, &rhs);
+
+        return forward ? cmp : -cmp;
+    };
+    // Returns false once the callback or the limit ends the scan
+    auto visit = [&](const ReadView index, const ReadView data) {
+        if (false == cb(index, data)) { return false; }
 
+        return (0 == limit) || (limit != ++count);
+    };
+    auto visit_queued = [&](const std::pair<std::string, Pending>& entry,
+                            const std::vector<std::string>& skip) {
+        for (const auto& data : entry.second.values_) {
+            const auto it = std::find(skip.begin(), skip.end(), data);
+
+            if (skip.end() != it) { continue; }
+
+            if (false == visit(entry.first, data)) { return false; }
+        }
+
+        return true;
+    };
+    // Visits the values of the active key which the database did not hold
+    auto finish_active = [&]() {
+        const auto* entry = active;
+        active = nullptr;
+
+        if ((nullptr == entry) || entry->second.replace_) { return true; }
+
+        return visit_queued(*entry, stored);
+    };
+
+    try {
+        while (positioned) {
+            if (0 != ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
                 return false;
             }
 
-            while (again && 0 == ::mdb_cursor_get(cursor, &key, &value, next)) {
-                if (0 ==
-                    ::mdb_cursor_get(cursor, &key, &value, MDB_GET_CURRENT)) {
-                    again =
-                        cb({static_cast<char*>(key.mv_data), key.mv_size},
-                           {static_cast<char*>(value.mv_data), value.mv_size});
-                } else {
+            const auto index =
+                ReadView{static_cast<char*>(key.mv_data), key.mv_size};
 
-                    return false;
+            if (end.has_value()) {
+                const auto cmp = ::mdb_cmp(txn, database, &key, &bound);
+
+                if (forward ? (0 < cmp) : (0 > cmp)) { break; }
+            }
+
+            if (prefix.has_value() &&
+                (0 != index.compare(0, prefix->size(), prefix.value()))) {
+                break;
+            }
+
+            if ((nullptr != active) && (0 != compare(active->first, key))) {
+                if (false == finish_active()) { return true; }
+            }
+
+            if (nullptr == active) {
+                for (; queued.end() != pending; ++pending) {
+                    const auto cmp = compare(pending->first, key);
+
+                    if (0 < cmp) { break; }
+
+                    if (0 == cmp) {
+                        active = &(*pending);
+                        stored.clear();
+                        ++pending;
+
+                        if (active->second.replace_ &&
+                            (false == visit_queued(*active, {}))) {
+                            return true;
+                        }
+
+                        break;
+                    }
+
+                    if (false == visit_queued(*pending, {})) { return true; }
                 }
             }
+
+            if ((nullptr != active) && active->second.replace_) {
+                // Hidden by a queued write
+            } else {
+                const auto data =
+                    ReadView{static_cast<char*>(value.mv_data), value.mv_size};
+
+                if (nullptr != active) { stored.emplace_back(data); }
+
+                if (false == visit(index, data)) { return true; }
+            }
+
+            positioned = 0 == ::mdb_cursor_get(cursor, &key, &value, next);
+        }
+
+        if (false == finish_active()) { return true; }
+
+        for (; queued.end() != pending; ++pending) {
+            if (false == visit_queued(*pending, {})) { return true; }
         }
     } catch (const std::exception& e) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": ")(e.what()).Flush();
@@ -633,9 +1337,60 @@ auto LMDB::Read(const Table table, const ReadCallback cb, const Dir dir)
         return false;
     }
 
+    cleanup.success_ = true;
+
     return cleanup.success_;
 }
 
+auto LMDB::ReadPrefix(
+    const Table table,
+    const ReadView prefix,
+    const ReadCallback cb,
+    const Dir dir,
+    const std::size_t limit,
+    MDB_txn* txn) const noexcept -> bool
+{
+    return read(table, prefix, std::nullopt, prefix, cb, dir, limit, txn);
+}
+
+auto LMDB::ReadRange(
+    const Table table,
+    const ReadView start,
+    const std::optional<ReadView> end,
+    const ReadCallback cb,
+    const Dir dir,
+    const std::size_t limit,
+    MDB_txn* txn) const noexcept -> bool
+{
+    return read(table, start, end, std::nullopt, cb, dir, limit, txn);
+}
+
+auto LMDB::read_transaction(
+    MDB_txn* txn,
+    std::optional<Transaction>& snapshot) const noexcept(false) -> MDB_txn*
+{
+    if (nullptr != txn) { return txn; }
+
+    snapshot.emplace(*this);
+
+    return snapshot.value();
+}
+
+auto LMDB::release_reader(MDB_txn* txn) const noexcept -> void
+{
+    OT_ASSERT(nullptr != txn);
+
+    ::mdb_txn_reset(txn);
+    auto lock = Lock{readers_lock_};
+
+    if (max_cached_readers_ > readers_.size()) {
+        readers_.emplace_back(txn);
+    } else {
+        lock.unlock();
+        ::mdb_txn_abort(txn);
+    }
+}
+
 auto LMDB::Store(
     const Table table,
     const ReadView index,
@@ -672,6 +1427,9 @@ auto LMDB::Store(
     OT_ASSERT(static_cast<std::size_t>(table) < db_.size());
 
     auto output = Result{false, MDB_LAST_ERRCODE};
+
+    // Queued writes must not be reordered after this one
+    if ((nullptr == parent) && (false == flush())) { return output; }
     auto& [success, code] = output;
     MDB_txn* transaction{nullptr};
     auto cleanup = Cleanup{transaction};
@@ -755,6 +1513,9 @@ auto LMDB::StoreOrUpdate(
 
     auto output = Result{false, MDB_LAST_ERRCODE};
 
+    // Queued writes must not be reordered after this one
+    if ((nullptr == parent) && (false == flush())) { return output; }
+
     if (false == bool(cb)) {
         LogOutput(OT_METHOD)(__FUNCTION__)(": Invalid callback").Flush();
 
@@ -776,6 +1537,9 @@ auto LMDB::StoreOrUpdate(
 
     OT_ASSERT(nullptr != transaction);
 
+    // The callback may call back into this object
+    const auto guard = WriteGuard{env_};
+
     const auto database = db_.at(table);
 
     if (0 != ::mdb_cursor_open(transaction, database, &cursor)) {
@@ -807,18 +1571,72 @@ auto LMDB::StoreOrUpdate(
     return output;
 }
 
+// Puts a batch which failed to commit back in front of the writes queued since
+// it was taken so that it remains visible and is retried together with them
+auto LMDB::restore(const Lock&) const noexcept -> void
+{
+    auto& failed = committing_;
+    auto& next = pending_;
+
+    for (auto& [key, entry] : next.overlay_) {
+        auto [it, added] = failed.overlay_.try_emplace(key, std::move(entry));
+
+        if (added) { continue; }
+
+        auto& existing = it->second;
+
+        if (entry.replace_) {
+            existing = std::move(entry);
+        } else {
+            existing.values_.insert(
+                existing.values_.end(),
+                std::make_move_iterator(entry.values_.begin()),
+                std::make_move_iterator(entry.values_.end()));
+        }
+    }
+
+    failed.writes_.insert(
+        failed.writes_.end(),
+        std::make_move_iterator(next.writes_.begin()),
+        std::make_move_iterator(next.writes_.end()));
+    failed.bytes_ += next.bytes_;
+    failed.started_ = Clock::now();
+    pending_ = std::move(failed);
+    committing_ = Batch{};
+    queued_.store(true);
+}
+
 auto LMDB::TransactionRO() const noexcept(false) -> Transaction
 {
-    return {env_, false};
+    return Transaction{*this};
 }
 
 auto LMDB::TransactionRW() const noexcept(false) -> Transaction
 {
+    if (false == flush()) {
+        throw std::runtime_error("Failed to commit queued writes");
+    }
+
     return {env_, true};
 }
 
 LMDB::~LMDB()
 {
+    {
+        auto lock = Lock{lock_};
+        running_.store(false);
+    }
+
+    flush_signal_.notify_all();
+
+    if (flusher_.joinable()) { flusher_.join(); }
+
+    Commit();
+
+    for (auto* txn : readers_) { ::mdb_txn_abort(txn); }
+
+    readers_.clear();
+
     if (nullptr != env_) {
         ::mdb_env_close(env_);
         env_ = nullptr;
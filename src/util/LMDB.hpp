@@ -11,17 +11,23 @@ extern "C" {
 #include <lmdb.h>  // IWYU pragma: export
 }
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
 #include <functional>
 #include <iosfwd>
 #include <map>
 #include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
 
 #include "opentxs/Bytes.hpp"
+#include "opentxs/Types.hpp"
 #include "opentxs/Version.hpp"
 
 #if defined(__x86_64__) || defined(__aarch64__) || defined(_WIN64)
@@ -34,6 +40,9 @@ namespace opentxs::storage::lmdb
 {
 using Callback = std::function<void(const ReadView data)>;
 using Flags = unsigned int;
+/// position of the key in the request, value
+using IndexedCallback =
+    std::function<bool(const std::size_t index, const ReadView data)>;
 using ReadCallback =
     std::function<bool(const ReadView key, const ReadView value)>;
 using Databases = std::vector<MDB_dbi>;
@@ -49,6 +58,17 @@ public:
     enum class Dir : bool { Forward = false, Backward = true };
     enum class Mode : bool { One = false, Multiple = true };
 
+    struct BatchMetrics {
+        std::size_t batches_{};
+        std::size_t writes_{};
+        std::size_t bytes_{};
+        std::size_t largest_batch_{};
+        std::size_t failures_{};
+        std::chrono::microseconds last_latency_{};
+        std::chrono::microseconds max_latency_{};
+        std::chrono::microseconds total_latency_{};
+    };
+
     struct Transaction {
         bool success_;
 
@@ -57,9 +77,14 @@ public:
         auto Finalize(const std::optional<bool> success = {}) noexcept -> bool;
 
         Transaction(MDB_env* env, const bool rw) noexcept(false);
+        /// Read-only transaction borrowed from the parent's reader cache
+        explicit Transaction(const LMDB& parent) noexcept(false);
         ~Transaction();
 
     private:
+        const LMDB* parent_;
+        // Set for write transactions
+        const MDB_env* writer_;
         MDB_txn* ptr_;
 
         Transaction(const Transaction&) = delete;
@@ -68,6 +93,11 @@ public:
         auto operator=(Transaction &&) -> Transaction& = delete;
     };
 
+    /// Commits every queued write immediately
+    ///
+    /// Fails without committing if the calling thread holds a write
+    /// transaction in this environment. If the commit fails the writes stay
+    /// queued and visible, and are retried by the next commit.
     auto Commit() const noexcept -> bool;
     auto Delete(const Table table, MDB_txn* parent = nullptr) const noexcept
         -> bool;
@@ -85,24 +115,81 @@ public:
         const ReadView key,
         const ReadView value,
         MDB_txn* parent = nullptr) const noexcept -> bool;
-    auto Exists(const Table table, const ReadView key) const noexcept -> bool;
+    auto Exists(
+        const Table table,
+        const ReadView key,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
     auto Load(
         const Table table,
         const ReadView key,
         const Callback cb,
-        const Mode mode = Mode::One) const noexcept -> bool;
+        const Mode mode = Mode::One,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
     auto Load(
         const Table table,
         const std::size_t key,
         const Callback cb,
-        const Mode mode = Mode::One) const noexcept -> bool;
+        const Mode mode = Mode::One,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
+    /// Looks up every key using a single cursor, visiting them in database
+    /// order. cb is only invoked for keys which exist.
+    auto LoadMany(
+        const Table table,
+        const std::vector<ReadView>& keys,
+        const IndexedCallback cb,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
+    auto Metrics() const noexcept -> BatchMetrics;
+    /// Adds a write to the current batch
+    ///
+    /// Only MDB_NOOVERWRITE is supported in flags.
+    ///
+    /// Queued writes are visible to every read function immediately. The
+    /// batch is committed in a single transaction after batch_interval_ has
+    /// elapsed or batch_bytes_ have been queued, and before any other write
+    /// transaction starts. Reads never commit.
+    ///
+    /// As with Store, the value replaces the existing value for the key
+    /// unless the table is MDB_DUPSORT, in which case it is added to the
+    /// existing values. With MDB_NOOVERWRITE the write is skipped if the key
+    /// already exists.
+    ///
+    /// Returns false if the key or value can not be stored, or if the queued
+    /// writes can not be committed. A batch which failed to commit is kept
+    /// and retried, and no more writes are accepted until it succeeds.
     auto Queue(
         const Table table,
         const ReadView key,
         const ReadView value,
-        const Mode mode = Mode::One) const noexcept -> bool;
-    auto Read(const Table table, const ReadCallback cb, const Dir dir)
-        const noexcept -> bool;
+        const Flags flags = 0) const noexcept -> bool;
+    /// Adds the removal of every value for the key to the current batch
+    auto QueueDelete(const Table table, const ReadView key) const noexcept
+        -> bool;
+    auto Read(
+        const Table table,
+        const ReadCallback cb,
+        const Dir dir,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
+    /// Visits entries beginning with the first key not before start in the
+    /// specified direction, stopping after end (inclusive) if specified, after
+    /// limit entries if limit is not zero, or when cb returns false
+    auto ReadRange(
+        const Table table,
+        const ReadView start,
+        const std::optional<ReadView> end,
+        const ReadCallback cb,
+        const Dir dir = Dir::Forward,
+        const std::size_t limit = 0,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
+    /// Visits every entry whose key begins with prefix
+    ///
+    /// Only meaningful for tables which use the default key comparison
+    auto ReadPrefix(
+        const Table table,
+        const ReadView prefix,
+        const ReadCallback cb,
+        const Dir dir = Dir::Forward,
+        const std::size_t limit = 0,
+        MDB_txn* txn = nullptr) const noexcept -> bool;
     auto Store(
         const Table table,
         const ReadView key,
@@ -121,6 +208,7 @@ public:
         const UpdateCallback cb,
         MDB_txn* parent = nullptr,
         const Flags flags = 0) const noexcept -> Result;
+    /// The returned snapshot may be passed to any read function
     auto TransactionRO() const noexcept(false) -> Transaction;
     auto TransactionRW() const noexcept(false) -> Transaction;
 
@@ -128,28 +216,112 @@ public:
         const TableNames& names,
         const std::string& folder,
         const TablesToInit init,
-        const Flags flags = 0)
+        const Flags flags = 0,
+        const std::size_t size = OT_LMDB_SIZE)
     noexcept;
     ~LMDB();
 
 private:
-    using NewKey = std::tuple<Table, Mode, std::string, std::string>;
-    using Pending = std::vector<NewKey>;
+    /// A missing value indicates deletion
+    using NewKey =
+        std::tuple<Table, Flags, std::string, std::optional<std::string>>;
+    using Readers = std::vector<MDB_txn*>;
+
+    struct Pending {
+        // Values in the database for this key are hidden
+        bool replace_{false};
+        std::vector<std::string> values_{};
+    };
+
+    using Overlay = std::map<std::pair<Table, std::string>, Pending>;
+    using Queued = std::vector<std::pair<std::string, Pending>>;
+
+    struct Batch {
+        std::vector<NewKey> writes_{};
+        Overlay overlay_{};
+        std::size_t bytes_{};
+        Time started_{};
+    };
+
+    // Each cached reader holds a slot in the lock table
+    static constexpr auto max_cached_readers_ = std::size_t{64};
+    // Idle cached readers keep their slot in the reader table, so they are
+    // reserved on top of the slots used by active transactions
+    static constexpr auto max_readers_ =
+        static_cast<unsigned int>(max_cached_readers_ + 1024u);
+    static constexpr auto batch_bytes_ = std::size_t{16u * 1024u * 1024u};
+    static constexpr auto batch_interval_ = std::chrono::milliseconds{100};
 
     const TableNames& names_;
     mutable MDB_env* env_;
     mutable Databases db_;
-    mutable Pending pending_;
+    // Writes accepted since the last commit
+    mutable Batch pending_;
+    // Writes which are being committed and must remain visible until done
+    mutable Batch committing_;
+    mutable BatchMetrics metrics_;
+    std::vector<bool> dupsort_;
     mutable std::mutex lock_;
+    mutable std::mutex commit_lock_;
+    // Wakes the flusher when a batch starts or fills, and on shutdown
+    mutable std::condition_variable flush_signal_;
+    mutable std::atomic<bool> queued_;
+    // The last commit failed and its batch is waiting to be retried
+    mutable std::atomic<bool> failed_;
+    // Either batch holds writes, so reads must consult the overlay
+    mutable std::atomic<bool> overlaid_;
+    mutable std::atomic<bool> running_;
+    mutable std::once_flag start_flusher_;
+    mutable std::thread flusher_;
+    mutable Readers readers_;
+    mutable std::mutex readers_lock_;
 
+    auto apply(MDB_txn* txn, const NewKey& write) const noexcept -> bool;
+    auto exists(const Table table, const ReadView key, MDB_txn* txn)
+        const noexcept -> bool;
+    auto flush() const noexcept -> bool;
+    auto flush_periodically() const noexcept -> void;
+    auto holds_write() const noexcept -> bool;
     auto get_database(const Table table) const noexcept -> MDB_dbi;
+    auto get_reader() const noexcept(false) -> MDB_txn*;
+    auto read(
+        const Table table,
+        const ReadView start,
+        const std::optional<ReadView> end,
+        const std::optional<ReadView> prefix,
+        const ReadCallback cb,
+        const Dir dir,
+        const std::size_t limit,
+        MDB_txn* txn) const noexcept -> bool;
+    auto read_transaction(MDB_txn* txn, std::optional<Transaction>& snapshot)
+        const noexcept(false) -> MDB_txn*;
+    auto release_reader(MDB_txn* txn) const noexcept -> void;
     auto init_db(const Table table, const std::size_t flags) noexcept
         -> MDB_dbi;
     void init_environment(
         const std::string& folder,
         const std::size_t tables,
-        const Flags flags) noexcept;
+        const Flags flags,
+        const std::size_t size) noexcept;
     void init_tables(const TablesToInit init) noexcept;
+    auto load(
+        const Table table,
+        const ReadView key,
+        const Callback cb,
+        const Mode mode,
+        MDB_txn* txn) const noexcept -> bool;
+    auto overlay(const Table table, const ReadView key) const noexcept
+        -> std::optional<Pending>;
+    /// Queued keys which a range scan must visit, in visiting order
+    auto overlay(
+        const Table table,
+        const ReadView start,
+        const std::optional<ReadView> end,
+        const std::optional<ReadView> prefix,
+        const Dir dir,
+        MDB_txn* txn) const noexcept -> Queued;
+    auto queue(NewKey&& write) const noexcept -> bool;
+    auto restore(const Lock& lock) const noexcept -> void;
 
     LMDB() = delete;
     LMDB(const LMDB&) = delete;
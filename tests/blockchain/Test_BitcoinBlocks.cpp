@@ -10,6 +10,8 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -24,6 +26,7 @@
 #include "bip158/bch_filter_1307544.hpp"
 #include "bip158/bch_filter_1307723.hpp"
 #include "blockchain/bitcoin/CompactSize.hpp"
+#include "blockchain/block/bitcoin/Block.hpp"
 #include "internal/blockchain/Blockchain.hpp"
 #include "internal/blockchain/bitcoin/Bitcoin.hpp"
 #include "opentxs/Bytes.hpp"
@@ -40,12 +43,15 @@
 #include "opentxs/blockchain/Network.hpp"
 #include "opentxs/blockchain/block/Block.hpp"
 #include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/blockchain/block/bitcoin/Transaction.hpp"
 #include "opentxs/blockchain/client/FilterOracle.hpp"
 #include "opentxs/blockchain/client/HeaderOracle.hpp"
 #include "opentxs/core/Data.hpp"
 
 namespace
 {
+using BlockImp = ot::blockchain::block::bitcoin::implementation::Block;
+
 struct Test_BitcoinBlock : public ::testing::Test {
     const ot::api::client::Manager& api_;
 
@@ -375,6 +381,111 @@ TEST_F(Test_BitcoinBlock, serialization)
     }
 }
 
+TEST_F(Test_BitcoinBlock, lazy_access)
+{
+    for (const auto& vector : bip_158_vectors_) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(
+            ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+        const auto& internal = static_cast<const BlockImp&>(block);
+
+        EXPECT_EQ(internal.Decoded(), 0u);
+        ASSERT_LT(0u, block.size());
+
+        const auto& first = block.at(0);
+
+        ASSERT_TRUE(first);
+        EXPECT_EQ(internal.Decoded(), 1u);
+        EXPECT_EQ(first.get(), block.at(0).get());
+        EXPECT_EQ(first.get(), block.at(first->ID().Bytes()).get());
+        EXPECT_EQ(internal.Decoded(), 1u);
+
+        auto count = std::size_t{0};
+
+        for (const auto& tx : block) {
+            EXPECT_TRUE(tx);
+
+            ++count;
+        }
+
+        EXPECT_EQ(count, block.size());
+        EXPECT_EQ(internal.Decoded(), block.size());
+    }
+}
+
+TEST_F(Test_BitcoinBlock, bulk_access_does_not_cache)
+{
+    for (const auto& vector : bip_158_vectors_) {
+        const auto raw = vector.Block(api_);
+        const auto pBlock = api_.Factory().BitcoinBlock(
+            ot::blockchain::Type::Bitcoin_testnet3, raw->Bytes());
+
+        ASSERT_TRUE(pBlock);
+
+        const auto& block = *pBlock;
+        const auto& internal = static_cast<const BlockImp&>(block);
+        const auto elements =
+            block.ExtractElements(ot::blockchain::filter::Type::Basic_BIP158);
+
+        EXPECT_EQ(internal.Decoded(), 0u);
+        EXPECT_EQ(block.CalculateSize(), raw->size());
+
+        auto serialized = api_.Factory().Data();
+
+        EXPECT_TRUE(block.Serialize(serialized->WriteInto()));
+        EXPECT_EQ(raw.get(), serialized);
+        EXPECT_EQ(internal.Decoded(), 0u);
+
+        // Decoding on demand must produce the same results
+        const auto& tx = block.at(0);
+
+        ASSERT_TRUE(tx);
+        EXPECT_EQ(internal.Decoded(), 1u);
+        EXPECT_EQ(
+            elements.size(),
+            block.ExtractElements(ot::blockchain::filter::Type::Basic_BIP158)
+                .size());
+        EXPECT_EQ(internal.Decoded(), 1u);
+    }
+}
+
+TEST_F(Test_BitcoinBlock, malformed_transaction)
+{
+    const auto& vector = bip_158_vectors_.at(0);
+    const auto chain = ot::blockchain::Type::Bitcoin_testnet3;
+    const auto raw = vector.Block(api_);
+
+    ASSERT_TRUE(api_.Factory().BitcoinBlock(chain, raw->Bytes()));
+
+    {
+        // The last transaction is missing its lock time
+        auto truncated = ot::space(raw->Bytes());
+        truncated.resize(truncated.size() - 1u);
+
+        EXPECT_FALSE(api_.Factory().BitcoinBlock(chain, ot::reader(truncated)));
+    }
+
+    {
+        // The transaction count claims one more transaction than the block
+        // contains
+        constexpr auto count = std::size_t{80};
+        auto extra = ot::space(raw->Bytes());
+
+        ASSERT_LT(count, extra.size());
+        ASSERT_GT(0xfd, std::to_integer<int>(extra.at(count)));
+
+        extra.at(count) =
+            std::byte{static_cast<std::uint8_t>(
+                std::to_integer<int>(extra.at(count)) + 1)};
+
+        EXPECT_FALSE(api_.Factory().BitcoinBlock(chain, ot::reader(extra)));
+    }
+}
+
 TEST_F(Test_BitcoinBlock, bch_filter_1307544)
 {
     const auto& filter = bch_filter_1307544_;
@@ -23,6 +23,7 @@
 #include "opentxs/Forward.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/FilterType.hpp"
 #include "opentxs/blockchain/block/bitcoin/Script.hpp"
 
 namespace b = ot::blockchain::block::bitcoin;
@@ -1872,6 +1873,93 @@ TEST(Test_BitcoinScript, multisig)
     }
 }
 
+TEST(Test_BitcoinScript, classify)
+{
+    using Template = b::internal::ScriptTemplate;
+
+    for (const auto* set :
+         {&p2pk_good_,
+          &p2pk_bad_,
+          &p2pkh_good_,
+          &p2pkh_bad_,
+          &p2sh_good_,
+          &p2sh_bad_,
+          &data_good_,
+          &data_bad_,
+          &multisig_good_,
+          &multisig_bad_,
+          &multisig_malformed_}) {
+        for (const auto& serialized : *set) {
+            const auto script = ot::factory::BitcoinScript(
+                chain_, ot::reader(serialized), true, false, false);
+
+            if (false == bool(script)) { continue; }
+
+            auto elements = b::ScriptElements{};
+
+            for (const auto& element : *script) {
+                elements.emplace_back(element);
+            }
+
+            const auto decoded =
+                ot::factory::BitcoinScript(chain_, std::move(elements));
+
+            ASSERT_TRUE(decoded);
+            EXPECT_EQ(script->Type(), decoded->Type());
+        }
+    }
+
+    auto p2wpkh = std::vector<std::byte>{std::byte{0x00}, std::byte{0x14}};
+    p2wpkh.insert(p2wpkh.end(), hash_160_.begin(), hash_160_.end());
+    const auto wpkh = b::internal::ClassifyScript(ot::reader(p2wpkh));
+
+    EXPECT_EQ(wpkh.template_, Template::PayToWitnessPubkeyHash);
+    ASSERT_EQ(wpkh.count_, 1u);
+    ASSERT_EQ(wpkh.pushes_.at(0).size(), hash_160_.size());
+    EXPECT_EQ(
+        std::memcmp(
+            wpkh.pushes_.at(0).data(), hash_160_.data(), hash_160_.size()),
+        0);
+
+    {
+        const auto script = ot::factory::BitcoinScript(
+            chain_, ot::reader(p2wpkh), true, false, false);
+
+        ASSERT_TRUE(script);
+        EXPECT_EQ(Script::Pattern::Custom, script->Type());
+
+        const auto elements = script->ExtractElements(
+            ot::blockchain::filter::Type::Extended_opentxs);
+
+        ASSERT_EQ(elements.size(), 1u);
+        EXPECT_EQ(elements.at(0), hash_160_);
+        ASSERT_EQ(2, script->size());
+        EXPECT_EQ(b::OP::ZERO, script->at(0).opcode_);
+
+        auto bytes = ot::Space{};
+
+        EXPECT_TRUE(script->Serialize(ot::writer(bytes)));
+        EXPECT_EQ(bytes, p2wpkh);
+    }
+
+    auto p2wsh = std::vector<std::byte>{std::byte{0x00}, std::byte{0x20}};
+    p2wsh.insert(
+        p2wsh.end(),
+        std::next(compressed_pubkey_1_.begin()),
+        compressed_pubkey_1_.end());
+    const auto wsh = b::internal::ClassifyScript(ot::reader(p2wsh));
+
+    EXPECT_EQ(wsh.template_, Template::PayToWitnessScriptHash);
+    ASSERT_EQ(wsh.count_, 1u);
+    EXPECT_EQ(wsh.pushes_.at(0).size(), 32u);
+
+    p2wpkh.pop_back();
+    const auto truncated = b::internal::ClassifyScript(ot::reader(p2wpkh));
+
+    EXPECT_EQ(truncated.template_, Template::Nonstandard);
+    EXPECT_EQ(truncated.count_, 0u);
+}
+
 TEST(Test_BitcoinScript, input)
 {
     for (const auto& serialized : input_good_) {
@@ -9,6 +9,7 @@
 #include <cstring>
 #include <memory>
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -494,4 +495,26 @@ TEST_F(Test_BitcoinTransaction, normalized_id)
     EXPECT_EQ(id1.get(), tx_id_.get());
     EXPECT_NE(id1.get(), id2.get());
 }
+
+TEST_F(Test_BitcoinTransaction, measure)
+{
+    using Encoded = ot::blockchain::bitcoin::EncodedTransaction;
+
+    auto bytes = ot::space(tx_bytes_->Bytes());
+    const auto size = bytes.size();
+    bytes.resize(size + 16u);
+
+    EXPECT_EQ(Encoded::Measure(ot::reader(bytes)), size);
+
+    auto layout = Encoded::Layout{};
+
+    EXPECT_EQ(Encoded::Measure(ot::reader(bytes), layout), size);
+    EXPECT_EQ(layout.inputs_, 4u);
+    EXPECT_EQ(layout.witnesses_, size - 4u);
+    EXPECT_EQ(layout.size_, size);
+    EXPECT_THROW(
+        Encoded::Measure(ot::ReadView{
+            reinterpret_cast<const char*>(bytes.data()), size - 1u}),
+        std::runtime_error);
+}
 }  // namespace
@@ -0,0 +1,157 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <boost/container/flat_map.hpp>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+
+#include "Helpers.hpp"
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "blockchain/client/BlockOracle.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/blockchain/BlockchainType.hpp"
+#include "opentxs/blockchain/block/bitcoin/Block.hpp"
+#include "opentxs/core/Data.hpp"
+
+namespace
+{
+class Test_BlockCache : public ::testing::Test
+{
+public:
+    using Mem = ot::blockchain::client::implementation::BlockOracle::Mem;
+    using Block = ot::blockchain::client::BlockOracle::BitcoinBlock_p;
+    using Future = ot::blockchain::client::BlockOracle::BitcoinBlockFuture;
+
+    static constexpr std::size_t limit_{100};
+
+    const ot::api::client::Manager& api_;
+    Mem cache_;
+
+    static auto future() -> Future
+    {
+        auto promise = std::promise<Block>{};
+        promise.set_value(nullptr);
+
+        return promise.get_future();
+    }
+    static auto id(const std::uint8_t value) -> ot::OTData
+    {
+        return ot::Data::Factory(value);
+    }
+
+    auto cached(const std::uint8_t value) -> bool
+    {
+        return cache_.find(id(value)->Bytes()).valid();
+    }
+    auto push(const std::uint8_t value, const std::size_t bytes) -> void
+    {
+        cache_.push(id(value), future(), bytes);
+    }
+
+    Test_BlockCache()
+        : api_(ot::Context().StartClient({}, 0))
+        , cache_(limit_)
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_BlockCache, budget)
+{
+    push(1, 40);
+    push(2, 40);
+    push(3, 20);
+
+    EXPECT_EQ(100u, cache_.bytes());
+    EXPECT_TRUE(cached(1));
+    EXPECT_TRUE(cached(2));
+    EXPECT_TRUE(cached(3));
+
+    push(4, 1);
+
+    EXPECT_EQ(61u, cache_.bytes());
+    EXPECT_FALSE(cached(1));
+    EXPECT_TRUE(cached(2));
+    EXPECT_TRUE(cached(3));
+    EXPECT_TRUE(cached(4));
+
+    // A block larger than the budget is not cached
+    push(5, limit_ + 1u);
+
+    EXPECT_EQ(61u, cache_.bytes());
+    EXPECT_FALSE(cached(5));
+
+    // Replacing a block releases its previous charge
+    push(2, 10);
+
+    EXPECT_EQ(31u, cache_.bytes());
+
+    cache_.clear();
+
+    EXPECT_EQ(0u, cache_.bytes());
+    EXPECT_FALSE(cached(2));
+}
+
+TEST_F(Test_BlockCache, eviction_order)
+{
+    push(1, 30);
+    push(2, 30);
+    push(3, 30);
+
+    // Finding a block makes it the most recently used
+    EXPECT_TRUE(cached(1));
+
+    push(4, 30);
+
+    EXPECT_TRUE(cached(1));
+    EXPECT_FALSE(cached(2));
+    EXPECT_TRUE(cached(3));
+    EXPECT_TRUE(cached(4));
+
+    push(5, 60);
+
+    EXPECT_FALSE(cached(1));
+    EXPECT_FALSE(cached(3));
+    EXPECT_TRUE(cached(4));
+    EXPECT_TRUE(cached(5));
+}
+
+TEST_F(Test_BlockCache, hits_and_misses)
+{
+    push(1, 10);
+
+    EXPECT_TRUE(cached(1));
+    EXPECT_TRUE(cached(1));
+    EXPECT_FALSE(cached(2));
+    EXPECT_EQ(2u, cache_.hits());
+    EXPECT_EQ(1u, cache_.misses());
+}
+
+TEST_F(Test_BlockCache, estimate_size)
+{
+    const auto chain = ot::blockchain::Type::UnitTest;
+    const auto& hex = genesis_block_data_.at(chain).genesis_block_hex_;
+    const auto bytes = api_.Factory().Data(hex, ot::StringStyle::Hex);
+    const auto block = api_.Factory().BitcoinBlock(chain, bytes->Bytes());
+
+    ASSERT_TRUE(block);
+
+    // The genesis block has one transaction with one input and one output,
+    // which are charged on top of the serialized size
+    const auto expected = bytes->size() + Mem::transaction_overhead_ +
+                          Mem::input_overhead_ + Mem::output_overhead_;
+
+    EXPECT_EQ(bytes->size(), block->CalculateSize());
+    EXPECT_EQ(expected, Mem::EstimateSize(*block));
+}
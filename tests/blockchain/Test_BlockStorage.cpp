@@ -0,0 +1,396 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "api/client/blockchain/database/Blocks.hpp"
+#include "internal/api/client/blockchain/Blockchain.hpp"
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Data.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace lmdb = opentxs::storage::lmdb;
+namespace ot = opentxs;
+
+namespace
+{
+using Blocks = ot::api::client::blockchain::database::implementation::Blocks;
+using Clock = std::chrono::steady_clock;
+
+// Matches the store's maintenance interval and minimum retention
+constexpr auto count_ = std::size_t{1024};
+constexpr auto keep_ = std::size_t{288};
+constexpr auto pruned_ = count_ - keep_;
+constexpr auto small_ = std::size_t{1024};
+// Large enough that pruning leaves more than 64 MiB to reclaim
+constexpr auto large_ = std::size_t{96 * 1024};
+constexpr auto next_block_address_ = std::size_t{1};
+constexpr auto timeout_ = std::chrono::seconds{30};
+constexpr auto readers_ = std::size_t{4};
+constexpr auto writers_ = std::size_t{4};
+
+class Test_BlockStorage : public ::testing::Test
+{
+public:
+    static const lmdb::TableNames names_;
+
+    const fs::path folder_;
+    std::unique_ptr<lmdb::LMDB> lmdb_;
+    std::unique_ptr<Blocks> blocks_;
+
+    static auto fill(const std::size_t i) -> char
+    {
+        return static_cast<char>(i % 251u);
+    }
+    static auto hash(const std::size_t i) -> ot::OTData
+    {
+        auto bytes = std::array<std::uint8_t, 32>{};
+        std::memcpy(bytes.data(), &i, sizeof(i));
+
+        return ot::Data::Factory(bytes.data(), bytes.size());
+    }
+    // Maintenance runs in the background so wait for its effect
+    static auto wait_until(std::function<bool()> condition) -> bool
+    {
+        const auto deadline = Clock::now() + timeout_;
+
+        while (Clock::now() < deadline) {
+            if (condition()) { return true; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        }
+
+        return condition();
+    }
+
+    auto exists(const std::size_t i) const -> bool
+    {
+        return blocks_->Exists(hash(i));
+    }
+    // Returns true if the block is present and holds the bytes it was stored
+    // with
+    auto intact(const std::size_t i, const std::size_t size) const -> bool
+    {
+        const auto reader = blocks_->Load(hash(i));
+
+        if ((false == reader.valid()) || (size != reader.size())) {
+            return false;
+        }
+
+        const auto* data = static_cast<const char*>(reader.data());
+
+        for (auto n = std::size_t{0}; n < size; ++n) {
+            if (fill(i) != data[n]) { return false; }
+        }
+
+        return true;
+    }
+    // Loads every block in [first, last) until stopped. A block at or above
+    // required must always be found, and every block found must be intact.
+    auto read(
+        const std::size_t first,
+        const std::size_t last,
+        const std::size_t required,
+        const std::size_t size,
+        const std::atomic<bool>& stop) const -> bool
+    {
+        auto output{true};
+
+        while (false == stop.load()) {
+            for (auto i = first; i < last; ++i) {
+                const auto found = exists(i);
+
+                if (found && (false == intact(i, size))) {
+                    // Pruned between the two calls
+                    if (exists(i)) { output = false; }
+                } else if ((i >= required) && (false == found)) {
+                    output = false;
+                }
+            }
+        }
+
+        return output;
+    }
+    auto position() const -> std::size_t
+    {
+        auto output = std::size_t{0};
+        lmdb_->Load(
+            ot::api::client::blockchain::Config,
+            next_block_address_,
+            [&](const auto in) {
+                if (sizeof(output) == in.size()) {
+                    std::memcpy(&output, in.data(), in.size());
+                }
+            });
+
+        return output;
+    }
+    auto store(const std::size_t i, const std::size_t size) const -> bool
+    {
+        auto writer = blocks_->Store(hash(i), size);
+
+        if (false == writer.valid()) { return false; }
+
+        std::memset(writer.get().data(), fill(i), size);
+
+        return true;
+    }
+
+    Test_BlockStorage()
+        : folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-blocks-%%%%-%%%%-%%%%-%%%%"))
+        , lmdb_()
+        , blocks_()
+    {
+        fs::create_directories(folder_);
+        lmdb_ = std::make_unique<lmdb::LMDB>(
+            names_,
+            folder_.string(),
+            lmdb::TablesToInit{
+                {ot::api::client::blockchain::Config, MDB_INTEGERKEY},
+                {ot::api::client::blockchain::BlockIndex, 0},
+                {ot::api::client::blockchain::BlockPins, 0},
+            });
+        blocks_ = std::make_unique<Blocks>(*lmdb_, folder_.string(), keep_);
+    }
+
+    ~Test_BlockStorage() override
+    {
+        blocks_.reset();
+        lmdb_.reset();
+        fs::remove_all(folder_);
+    }
+};
+
+const lmdb::TableNames Test_BlockStorage::names_{
+    {ot::api::client::blockchain::Config, "config"},
+    {ot::api::client::blockchain::BlockIndex, "blocks"},
+    {ot::api::client::blockchain::BlockPins, "block_pins"},
+};
+}  // namespace
+
+TEST_F(Test_BlockStorage, prune)
+{
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        const auto start = Clock::now();
+
+        ASSERT_TRUE(store(i, small_));
+
+        // The store which reaches the maintenance interval only signals the
+        // maintenance thread
+        if ((count_ - 1u) == i) {
+            RecordProperty(
+                "maintenance_store_us",
+                static_cast<int>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(
+                        Clock::now() - start)
+                        .count()));
+        }
+    }
+
+    ASSERT_TRUE(wait_until([&] { return false == exists(pruned_ - 1u); }));
+
+    for (auto i = std::size_t{0}; i < pruned_; ++i) {
+        EXPECT_FALSE(exists(i));
+        EXPECT_FALSE(blocks_->Load(hash(i)).valid());
+    }
+
+    for (auto i = pruned_; i < count_; ++i) { EXPECT_TRUE(intact(i, small_)); }
+
+    // Less than the compaction threshold was released so nothing moved
+    EXPECT_EQ(position(), count_ * small_);
+}
+
+TEST_F(Test_BlockStorage, pins)
+{
+    constexpr auto pinned = std::size_t{10};
+
+    for (auto i = std::size_t{0}; i < pinned; ++i) {
+        ASSERT_TRUE(blocks_->Pin(hash(i)));
+    }
+
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        ASSERT_TRUE(store(i, small_));
+    }
+
+    ASSERT_TRUE(wait_until([&] { return false == exists(pruned_ - 1u); }));
+
+    for (auto i = std::size_t{0}; i < pinned; ++i) {
+        EXPECT_TRUE(intact(i, small_));
+    }
+
+    for (auto i = pinned; i < pruned_; ++i) { EXPECT_FALSE(exists(i)); }
+
+    for (auto i = pruned_; i < count_; ++i) { EXPECT_TRUE(intact(i, small_)); }
+}
+
+TEST_F(Test_BlockStorage, compact)
+{
+    for (auto i = std::size_t{0}; i < count_; ++i) {
+        ASSERT_TRUE(store(i, large_));
+    }
+
+    // The retained blocks slide down to the start of the store
+    ASSERT_TRUE(wait_until([&] { return position() == keep_ * large_; }));
+
+    for (auto i = std::size_t{0}; i < pruned_; ++i) { EXPECT_FALSE(exists(i)); }
+
+    for (auto i = pruned_; i < count_; ++i) { EXPECT_TRUE(intact(i, large_)); }
+
+    // New blocks are written after the compacted ones
+    ASSERT_TRUE(store(count_, large_));
+    EXPECT_TRUE(intact(count_, large_));
+    EXPECT_EQ(position(), (keep_ + 1u) * large_);
+
+    // The index and write position survive a restart
+    blocks_.reset();
+    blocks_ = std::make_unique<Blocks>(*lmdb_, folder_.string(), keep_);
+
+    for (auto i = pruned_; i <= count_; ++i) {
+        EXPECT_TRUE(intact(i, large_));
+    }
+}
+
+TEST_F(Test_BlockStorage, concurrent_store_load)
+{
+    constexpr auto each = std::size_t{100};
+    constexpr auto total = writers_ * each;
+    auto stop = std::atomic<bool>{false};
+    auto readers = std::vector<std::future<bool>>{};
+    auto writers = std::vector<std::future<bool>>{};
+
+    for (auto r = std::size_t{0}; r < readers_; ++r) {
+        readers.emplace_back(std::async(std::launch::async, [&] {
+            return read(0, total, total, small_, stop);
+        }));
+    }
+
+    const auto start = Clock::now();
+
+    for (auto w = std::size_t{0}; w < writers_; ++w) {
+        writers.emplace_back(std::async(std::launch::async, [&, w] {
+            auto output{true};
+
+            for (auto i = w * each; i < ((w + 1u) * each); ++i) {
+                output &= store(i, small_);
+            }
+
+            return output;
+        }));
+    }
+
+    for (auto& writer : writers) { EXPECT_TRUE(writer.get()); }
+
+    RecordProperty(
+        "concurrent_store_us",
+        static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                             Clock::now() - start)
+                             .count()));
+    stop.store(true);
+
+    for (auto& reader : readers) { EXPECT_TRUE(reader.get()); }
+
+    for (auto i = std::size_t{0}; i < total; ++i) {
+        EXPECT_TRUE(intact(i, small_));
+    }
+
+    EXPECT_EQ(position(), total * small_);
+}
+
+TEST_F(Test_BlockStorage, concurrent_replace)
+{
+    auto writers = std::vector<std::future<bool>>{};
+
+    for (auto w = std::size_t{0}; w < writers_; ++w) {
+        writers.emplace_back(std::async(std::launch::async, [&] {
+            auto output{true};
+
+            for (auto n = 0; n < 100; ++n) { output &= store(0, small_); }
+
+            return output;
+        }));
+    }
+
+    for (auto& writer : writers) { EXPECT_TRUE(writer.get()); }
+
+    EXPECT_TRUE(intact(0, small_));
+    // Writers which raced to store the block first may each have reserved
+    // space, but only one copy is indexed
+    EXPECT_LE(position(), writers_ * small_);
+}
+
+TEST_F(Test_BlockStorage, store_load_during_maintenance)
+{
+    constexpr auto each = std::size_t{16};
+    constexpr auto added = writers_ * each;
+    // New blocks stored before pruning starts push this many of the oldest
+    // retained blocks out
+    constexpr auto retained = pruned_ + added;
+
+    for (auto i = std::size_t{0}; i < (count_ - 1u); ++i) {
+        ASSERT_TRUE(store(i, large_));
+    }
+
+    auto stop = std::atomic<bool>{false};
+    auto readers = std::vector<std::future<bool>>{};
+    auto writers = std::vector<std::future<bool>>{};
+
+    for (auto r = std::size_t{0}; r < readers_; ++r) {
+        readers.emplace_back(std::async(std::launch::async, [&] {
+            return read(pruned_, count_ - 1u, retained, large_, stop);
+        }));
+    }
+
+    // Starts pruning and compaction
+    ASSERT_TRUE(store(count_ - 1u, large_));
+
+    for (auto w = std::size_t{0}; w < writers_; ++w) {
+        writers.emplace_back(std::async(std::launch::async, [&, w] {
+            auto output{true};
+            const auto first = count_ + (w * each);
+
+            for (auto i = first; i < (first + each); ++i) {
+                output &= store(i, large_);
+                output &= intact(i, large_);
+            }
+
+            return output;
+        }));
+    }
+
+    for (auto& writer : writers) { EXPECT_TRUE(writer.get()); }
+
+    EXPECT_TRUE(wait_until([&] { return false == exists(pruned_ - 1u); }));
+
+    // Keep reading while compaction may still be moving blocks. A reader
+    // holding a block ends the compaction pass early, so do not wait for it
+    // to finish.
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+    stop.store(true);
+
+    for (auto& reader : readers) { EXPECT_TRUE(reader.get()); }
+
+    for (auto i = retained; i < (count_ + added); ++i) {
+        EXPECT_TRUE(intact(i, large_));
+    }
+}
@@ -7,10 +7,12 @@
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -26,6 +28,8 @@
 #include "opentxs/Types.hpp"
 #include "opentxs/api/Context.hpp"
 #include "opentxs/api/Factory.hpp"
+#include "opentxs/api/crypto/Crypto.hpp"
+#include "opentxs/api/crypto/Hash.hpp"
 #include "opentxs/api/client/Manager.hpp"
 #include "opentxs/blockchain/Blockchain.hpp"
 #include "opentxs/blockchain/BlockchainType.hpp"
@@ -35,6 +39,8 @@
 #include "opentxs/blockchain/client/FilterOracle.hpp"
 #include "opentxs/blockchain/client/HeaderOracle.hpp"
 #include "opentxs/core/Data.hpp"
+#include "opentxs/protobuf/Enums.pb.h"
+#include "opentxs/protobuf/GCS.pb.h"
 
 namespace
 {
@@ -355,6 +361,107 @@ TEST_F(Test_Filters, golomb_coding)
     }
 }
 
+TEST_F(Test_Filters, golomb_coding_mainnet_sized)
+{
+    // Replays filters with element counts typical of recent mainnet blocks
+    // and records the decoding time of the word-at-a-time decoder against a
+    // bit-at-a-time reference decoder.
+    const auto P = params_.first;
+    const auto M = params_.second;
+    auto generator = std::mt19937_64{158};
+    auto wordTime = std::chrono::nanoseconds{0};
+    auto bitTime = std::chrono::nanoseconds{0};
+
+    for (const auto N : {std::uint32_t{2500}, std::uint32_t{12000}}) {
+        auto distribution = std::uniform_int_distribution<std::uint64_t>{
+            0, std::uint64_t{N} * std::uint64_t{M} - 1u};
+        auto elements = std::vector<std::uint64_t>{};
+
+        while (elements.size() < N) {
+            elements.emplace_back(distribution(generator));
+        }
+
+        std::sort(std::begin(elements), std::end(elements));
+        elements.erase(
+            std::unique(std::begin(elements), std::end(elements)),
+            std::end(elements));
+        const auto count = static_cast<std::uint32_t>(elements.size());
+        const auto encoded = ot::gcs::GolombEncode(P, elements);
+        auto start = std::chrono::steady_clock::now();
+        const auto decoded = ot::gcs::GolombDecode(count, P, encoded);
+        wordTime += std::chrono::steady_clock::now() - start;
+        start = std::chrono::steady_clock::now();
+        auto reference = std::vector<std::uint64_t>{};
+        auto stream = ot::blockchain::internal::BitReader{encoded};
+        auto last = std::uint64_t{0};
+
+        for (auto i = std::uint32_t{0}; i < count; ++i) {
+            auto quotient = std::uint64_t{0};
+
+            while (1 == stream.read(1)) { ++quotient; }
+
+            last += (quotient << P) + stream.read(P);
+            reference.emplace_back(last);
+        }
+
+        bitTime += std::chrono::steady_clock::now() - start;
+
+        ASSERT_EQ(elements.size(), decoded.size());
+        EXPECT_EQ(elements, decoded);
+        EXPECT_EQ(reference, decoded);
+    }
+
+    RecordProperty(
+        "word_decoder_us",
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(wordTime)
+                .count()));
+    RecordProperty(
+        "bit_decoder_us",
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(bitTime)
+                .count()));
+}
+
+TEST_F(Test_Filters, hashed_set_construct)
+{
+    const auto key = std::string{"0123456789abcdef"};
+    const auto N = std::uint32_t{41};
+    const auto M = params_.second;
+    const auto range = std::uint64_t{N} * std::uint64_t{M};
+    auto data = std::vector<std::string>{};
+    auto items = std::vector<ot::ReadView>{};
+    auto expected = std::vector<std::uint64_t>{};
+
+    for (auto i = std::size_t{0}; i < N; ++i) {
+        auto& item = data.emplace_back();
+
+        for (auto j = std::size_t{0}; j < i; ++j) {
+            item.push_back(static_cast<char>(i * j));
+        }
+    }
+
+    for (const auto& item : data) {
+        auto hash = std::uint64_t{};
+        auto writer = [&hash](const auto) -> ot::WritableView {
+            return {&hash, sizeof(hash)};
+        };
+
+        ASSERT_TRUE(api_.Crypto().Hash().HMAC(
+            ot::proto::HASHTYPE_SIPHASH24, key, item, writer));
+
+        items.emplace_back(item);
+        expected.emplace_back(static_cast<std::uint64_t>(
+            (static_cast<unsigned __int128>(hash) *
+             static_cast<unsigned __int128>(range)) >>
+            64u));
+    }
+
+    std::sort(std::begin(expected), std::end(expected));
+
+    EXPECT_EQ(expected, ot::gcs::HashedSetConstruct(key, N, M, items));
+}
+
 TEST_F(Test_Filters, gcs)
 {
     const auto s1 = std::string{"blah"};
@@ -404,6 +511,55 @@ TEST_F(Test_Filters, gcs)
     }
 }
 
+TEST_F(Test_Filters, gcs_serialization)
+{
+    const auto s1 = std::string{"blah"};
+    const auto s2 = std::string{"foo"};
+    const auto s3 = std::string{"islajames"};
+    const auto elements = std::vector<ot::OTData>{
+        ot::Data::Factory(s1.data(), s1.length()),
+        ot::Data::Factory(s2.data(), s2.length())};
+    const auto key = std::string{"0123456789abcdef"};
+    const auto pGcs =
+        ot::factory::GCS(api_, params_.first, params_.second, key, elements);
+
+    ASSERT_TRUE(pGcs);
+
+    const auto& gcs = *pGcs;
+    auto flat = ot::Space{};
+
+    ASSERT_TRUE(gcs.Serialize(ot::writer(flat)));
+
+    const auto legacy = [&] {
+        const auto proto = gcs.Serialize();
+        auto out = std::string{};
+        proto.SerializeToString(&out);
+
+        return out;
+    }();
+
+    for (const auto view : {false, true}) {
+        const auto pCopy = ot::factory::GCS(api_, ot::reader(flat), view);
+
+        ASSERT_TRUE(pCopy);
+
+        const auto& copy = *pCopy;
+
+        EXPECT_EQ(copy.ElementCount(), gcs.ElementCount());
+        EXPECT_TRUE(copy.Compressed() == gcs.Compressed());
+        EXPECT_EQ(copy.Hash()->str(), gcs.Hash()->str());
+        EXPECT_TRUE(copy.Test(elements.at(0)));
+        EXPECT_TRUE(copy.Test(elements.at(1)));
+        EXPECT_FALSE(copy.Test(ot::ReadView{s3}));
+    }
+
+    const auto pLegacy = ot::factory::GCS(api_, ot::ReadView{legacy});
+
+    ASSERT_TRUE(pLegacy);
+    EXPECT_EQ(pLegacy->Hash()->str(), gcs.Hash()->str());
+    EXPECT_FALSE(ot::factory::GCS(api_, ot::ReadView{}));
+}
+
 TEST_F(Test_Filters, bip158_case_0) { EXPECT_TRUE(TestGCSBlock(0)); }
 
 TEST_F(Test_Filters, bip158_case_49291) { EXPECT_TRUE(TestGCSBlock(49291)); }
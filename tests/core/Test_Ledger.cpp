@@ -6,7 +6,9 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <memory>
+#include <set>
 
 #include "OTTestEnvironment.hpp"  // IWYU pragma: keep
 #include "opentxs/OT.hpp"
@@ -19,6 +21,8 @@
 #include "opentxs/api/server/Manager.hpp"
 #include "opentxs/core/Identifier.hpp"
 #include "opentxs/core/Ledger.hpp"
+#include "opentxs/core/NumList.hpp"
+#include "opentxs/core/OTTransaction.hpp"
 #include "opentxs/core/PasswordPrompt.hpp"
 #include "opentxs/core/contract/ServerContract.hpp"
 #include "opentxs/core/identifier/Nym.hpp"
@@ -28,6 +32,9 @@
 
 ot::OTNymID nym_id_{ot::identifier::Nym::Factory()};
 ot::OTServerID server_id_{ot::identifier::Server::Factory()};
+// Enough receipts for LoadBoxReceipts to spread the work over several threads
+constexpr auto receipts_ = std::int64_t{64};
+constexpr auto first_number_ = std::int64_t{1000};
 
 namespace
 {
@@ -45,6 +52,17 @@ struct Ledger : public ::testing::Test {
         , reason_s_(server_.Factory().PasswordPrompt(__FUNCTION__))
     {
     }
+
+    auto load_nymbox() -> std::unique_ptr<ot::Ledger>
+    {
+        auto nymbox = client_.Factory().Ledger(
+            nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, false);
+
+        if (false == bool(nymbox)) { return {}; }
+        if (false == nymbox->LoadNymbox()) { return {}; }
+
+        return nymbox;
+    }
 };
 }  // namespace
 
@@ -87,3 +105,101 @@ TEST_F(Ledger, load_nymbox)
     ASSERT_TRUE(nymbox);
     EXPECT_TRUE(nymbox->LoadNymbox());
 }
+
+TEST_F(Ledger, save_box_receipts)
+{
+    const auto nym = client_.Wallet().Nym(nym_id_);
+
+    ASSERT_TRUE(nym);
+
+    auto nymbox = client_.Factory().Ledger(
+        nym_id_, nym_id_, server_id_, ot::ledgerType::nymbox, true);
+
+    ASSERT_TRUE(nymbox);
+
+    for (auto i = std::int64_t{0}; i < receipts_; ++i) {
+        const auto number = first_number_ + i;
+        std::shared_ptr<ot::OTTransaction> transaction{
+            client_.Factory().Transaction(
+                *nymbox,
+                ot::transactionType::blank,
+                ot::originType::not_applicable,
+                number)};
+
+        ASSERT_TRUE(transaction);
+
+        transaction->AddNumbersToTransaction(ot::NumList{number});
+
+        ASSERT_TRUE(transaction->SignContract(*nym, reason_c_));
+        ASSERT_TRUE(transaction->SaveContract());
+        ASSERT_TRUE(transaction->SaveBoxReceipt(*nymbox));
+        ASSERT_TRUE(nymbox->AddTransaction(transaction));
+    }
+
+    nymbox->ReleaseSignatures();
+
+    EXPECT_TRUE(nymbox->SignContract(*nym, reason_c_));
+    EXPECT_TRUE(nymbox->SaveContract());
+    EXPECT_TRUE(nymbox->SaveNymbox());
+}
+
+TEST_F(Ledger, lazy_box_receipt)
+{
+    const auto number = first_number_ + 7;
+    auto nymbox = load_nymbox();
+
+    ASSERT_TRUE(nymbox);
+    ASSERT_EQ(receipts_, nymbox->GetTransactionCount());
+
+    for (const auto& [key, transaction] : nymbox->GetTransactionMap()) {
+        ASSERT_TRUE(transaction);
+        EXPECT_TRUE(transaction->IsAbbreviated());
+    }
+
+    auto abbreviated = nymbox->GetTransaction(number);
+
+    ASSERT_TRUE(abbreviated);
+    EXPECT_TRUE(abbreviated->IsAbbreviated());
+
+    auto full = nymbox->GetFullTransaction(number);
+
+    ASSERT_TRUE(full);
+    EXPECT_FALSE(full->IsAbbreviated());
+    EXPECT_EQ(number, full->GetTransactionNum());
+    EXPECT_EQ(full, nymbox->GetTransaction(number));
+
+    for (const auto& [key, transaction] : nymbox->GetTransactionMap()) {
+        ASSERT_TRUE(transaction);
+
+        if (number == key) { continue; }
+
+        EXPECT_TRUE(transaction->IsAbbreviated());
+    }
+
+    EXPECT_FALSE(nymbox->GetFullTransaction(first_number_ + receipts_));
+}
+
+TEST_F(Ledger, load_box_receipts)
+{
+    auto nymbox = load_nymbox();
+
+    ASSERT_TRUE(nymbox);
+    ASSERT_EQ(receipts_, nymbox->GetTransactionCount());
+
+    auto unloaded = std::set<std::int64_t>{};
+
+    EXPECT_TRUE(nymbox->LoadBoxReceipts(&unloaded));
+    EXPECT_TRUE(unloaded.empty());
+
+    auto number = first_number_;
+
+    for (const auto& [key, transaction] : nymbox->GetTransactionMap()) {
+        ASSERT_TRUE(transaction);
+        EXPECT_EQ(number, key);
+        EXPECT_FALSE(transaction->IsAbbreviated());
+        EXPECT_EQ(key, transaction->GetTransactionNum());
+        ++number;
+    }
+
+    EXPECT_EQ(first_number_ + receipts_, number);
+}
@@ -0,0 +1,255 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/trade/MarketJournal.hpp"
+#include "internal/api/Api.hpp"
+#include "internal/api/client/Client.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/Wallet.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/PasswordPrompt.hpp"
+#include "opentxs/identity/Nym.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using Journal = ot::MarketJournal;
+
+// Every fill journals both offers and the new last sale price
+constexpr auto fills_{100};
+
+class Test_MarketJournal : public ::testing::Test
+{
+public:
+    static ot::Nym_p notary_;
+    static ot::Nym_p other_;
+
+    const ot::api::internal::Core& api_;
+    const ot::OTPasswordPrompt reason_;
+    const std::string market_;
+
+    static auto offer(const std::int64_t number) -> Journal::Entry
+    {
+        auto output = Journal::Entry{};
+        output.type_ = Journal::Type::Offer;
+        output.number_ = number;
+        output.date_ = ot::Clock::from_time_t(1000 + number);
+        output.data_ = "offer " + std::to_string(number);
+
+        return output;
+    }
+    static auto read(const std::string& path) -> std::string
+    {
+        auto file = std::ifstream{path, std::ios::in | std::ios::binary};
+
+        return std::string{
+            std::istreambuf_iterator<char>{file},
+            std::istreambuf_iterator<char>{}};
+    }
+    static auto write(const std::string& path, const std::string& data)
+        -> void
+    {
+        auto file = std::ofstream{
+            path, std::ios::out | std::ios::binary | std::ios::trunc};
+        file.write(data.data(), data.size());
+    }
+
+    auto append(Journal& journal, Journal::Entry entry) const -> bool
+    {
+        return journal.Append(*notary_, entry, reason_);
+    }
+    auto load(const ot::identity::Nym& signer, std::vector<Journal::Entry>& out)
+        const -> bool
+    {
+        auto journal = Journal{api_, market_};
+
+        return journal.Load(signer, out);
+    }
+
+    Test_MarketJournal()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient({}, 0)))
+        , reason_(api_.Factory().PasswordPrompt(__FUNCTION__))
+        , market_(fs::unique_path("journal-%%%%-%%%%-%%%%-%%%%").string())
+    {
+        if (false == bool(notary_)) {
+            notary_ = api_.Wallet().Nym(reason_, "Notary");
+            other_ = api_.Wallet().Nym(reason_, "Other");
+        }
+    }
+
+    ~Test_MarketJournal() override
+    {
+        auto ec = boost::system::error_code{};
+        fs::remove(Journal{api_, market_}.Path(), ec);
+    }
+};
+
+ot::Nym_p Test_MarketJournal::notary_{};
+ot::Nym_p Test_MarketJournal::other_{};
+}  // namespace
+
+TEST_F(Test_MarketJournal, replay)
+{
+    ASSERT_TRUE(notary_);
+
+    {
+        auto journal = Journal{api_, market_};
+        auto sale = Journal::Entry{};
+        sale.type_ = Journal::Type::Sale;
+        sale.number_ = 42;
+        sale.data_ = "sale date";
+        auto removal = Journal::Entry{};
+        removal.type_ = Journal::Type::Remove;
+        removal.number_ = 1;
+
+        EXPECT_TRUE(append(journal, offer(1)));
+        EXPECT_TRUE(append(journal, offer(2)));
+        EXPECT_TRUE(append(journal, removal));
+        EXPECT_TRUE(append(journal, sale));
+        EXPECT_EQ(journal.Count(), 4u);
+    }
+
+    auto journal = Journal{api_, market_};
+    auto entries = std::vector<Journal::Entry>{};
+
+    ASSERT_TRUE(journal.Load(*notary_, entries));
+    ASSERT_EQ(entries.size(), 4u);
+    EXPECT_EQ(journal.Count(), 4u);
+    EXPECT_EQ(entries.at(0).type_, Journal::Type::Offer);
+    EXPECT_EQ(entries.at(0).number_, 1);
+    EXPECT_EQ(entries.at(0).date_, offer(1).date_);
+    EXPECT_EQ(entries.at(0).data_, offer(1).data_);
+    EXPECT_EQ(entries.at(1).number_, 2);
+    EXPECT_EQ(entries.at(2).type_, Journal::Type::Remove);
+    EXPECT_EQ(entries.at(2).number_, 1);
+    EXPECT_EQ(entries.at(3).type_, Journal::Type::Sale);
+    EXPECT_EQ(entries.at(3).number_, 42);
+    EXPECT_EQ(entries.at(3).data_, "sale date");
+
+    EXPECT_TRUE(journal.Clear());
+    EXPECT_EQ(journal.Count(), 0u);
+    EXPECT_TRUE(load(*notary_, entries));
+    EXPECT_TRUE(entries.empty());
+}
+
+TEST_F(Test_MarketJournal, truncated_tail)
+{
+    ASSERT_TRUE(notary_);
+
+    auto journal = Journal{api_, market_};
+
+    ASSERT_TRUE(append(journal, offer(1)));
+
+    const auto first = fs::file_size(journal.Path());
+
+    ASSERT_TRUE(append(journal, offer(2)));
+
+    // The process stopped partway through writing the second record
+    fs::resize_file(journal.Path(), fs::file_size(journal.Path()) - 5u);
+    auto entries = std::vector<Journal::Entry>{};
+
+    ASSERT_TRUE(load(*notary_, entries));
+    ASSERT_EQ(entries.size(), 1u);
+    EXPECT_EQ(entries.at(0).number_, 1);
+    EXPECT_EQ(fs::file_size(journal.Path()), first);
+
+    // New records follow the last complete one
+    ASSERT_TRUE(append(journal, offer(3)));
+    ASSERT_TRUE(load(*notary_, entries));
+    ASSERT_EQ(entries.size(), 2u);
+    EXPECT_EQ(entries.at(1).number_, 3);
+}
+
+TEST_F(Test_MarketJournal, bad_signature)
+{
+    ASSERT_TRUE(notary_);
+    ASSERT_TRUE(other_);
+
+    auto journal = Journal{api_, market_};
+
+    ASSERT_TRUE(append(journal, offer(1)));
+    ASSERT_TRUE(append(journal, offer(2)));
+
+    auto entries = std::vector<Journal::Entry>{};
+
+    // Signed by a different nym
+    EXPECT_FALSE(load(*other_, entries));
+    EXPECT_TRUE(entries.empty());
+
+    // Altered after it was signed
+    const auto original = read(journal.Path());
+    auto altered = original;
+    const auto pos = altered.rfind("offer 2");
+
+    ASSERT_NE(pos, std::string::npos);
+
+    altered.at(pos + 6u) = '9';
+    write(journal.Path(), altered);
+
+    EXPECT_FALSE(load(*notary_, entries));
+    EXPECT_TRUE(entries.empty());
+    EXPECT_EQ(read(journal.Path()), altered);
+
+    write(journal.Path(), original);
+
+    EXPECT_TRUE(load(*notary_, entries));
+    EXPECT_EQ(entries.size(), 2u);
+}
+
+TEST_F(Test_MarketJournal, fill_latency)
+{
+    ASSERT_TRUE(notary_);
+
+    auto journal = Journal{api_, market_};
+    auto sale = Journal::Entry{};
+    sale.type_ = Journal::Type::Sale;
+    sale.data_ = "sale date";
+    const auto start = Clock::now();
+
+    for (auto i = 0; i < fills_; ++i) {
+        sale.number_ = i;
+
+        ASSERT_TRUE(append(journal, offer(2 * i)));
+        ASSERT_TRUE(append(journal, offer(2 * i + 1)));
+        ASSERT_TRUE(append(journal, sale));
+    }
+
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - start);
+    RecordProperty("fill_us", static_cast<int>(elapsed.count() / fills_));
+
+    const auto loadStart = Clock::now();
+    auto entries = std::vector<Journal::Entry>{};
+
+    ASSERT_TRUE(load(*notary_, entries));
+
+    const auto replay = std::chrono::duration_cast<std::chrono::microseconds>(
+        Clock::now() - loadStart);
+    RecordProperty("replay_us", static_cast<int>(replay.count()));
+
+    EXPECT_EQ(entries.size(), static_cast<std::size_t>(3 * fills_));
+}
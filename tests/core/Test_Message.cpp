@@ -0,0 +1,147 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+
+namespace
+{
+class Test_Message : public ::testing::Test
+{
+public:
+    using Encoding = ot::Message::Encoding;
+
+    const ot::OTString serialized_;
+
+    static auto make_message(const std::size_t transactions) -> std::string
+    {
+        auto output = std::string{
+            "<notaryMessage version=\"3.0\" dateSigned=\"1587000000\">\n"
+            "<notarizeTransactionResponse requestNum=\"42\" success=\"true\" "
+            "nymID=\"ot2xuVPJDdweZvKLQD42UMCzhCmT3okn3W1PktLgCbmQLRnaKy848sX\" "
+            "notaryID=\"ot2BqchYuY5r747PnGK3SuM4A8bCLtuGASqPWpUW8Q4JcqQHXLn\">"
+            "\n"};
+
+        for (std::size_t i = 0; i < transactions; ++i) {
+            output += "<transaction type=\"transferReceipt\" "
+                      "transactionNum=\"";
+            output += std::to_string(1000 + i);
+            output += "\" inReferenceTo=\"";
+            output += std::to_string(5000 + 3 * i);
+            output += "\" adjustment=\"";
+            output += std::to_string(17 * i);
+            output += "\" dateSigned=\"";
+            output += std::to_string(1587000000 + i);
+            output += "\" />\n";
+        }
+
+        output += "</notarizeTransactionResponse>\n</notaryMessage>\n";
+
+        return output;
+    }
+
+    Test_Message()
+        : serialized_(ot::String::Factory(make_message(500)))
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_Message, armored_round_trip)
+{
+    const auto frame = ot::Message::Encode(serialized_, Encoding::Armored);
+    auto output = ot::String::Factory();
+    auto encoding = Encoding::Binary;
+
+    ASSERT_FALSE(frame.empty());
+    EXPECT_NE('\0', frame.front());
+    EXPECT_TRUE(ot::Message::Decode(frame, output, encoding));
+    EXPECT_EQ(Encoding::Armored, encoding);
+    EXPECT_STREQ(serialized_->Get(), output->Get());
+}
+
+TEST_F(Test_Message, binary_round_trip)
+{
+    const auto frame = ot::Message::Encode(serialized_, Encoding::Binary);
+    auto output = ot::String::Factory();
+    auto encoding = Encoding::Armored;
+
+    ASSERT_FALSE(frame.empty());
+    EXPECT_EQ('\0', frame.front());
+    EXPECT_GT(frame.size(), serialized_->GetLength());
+    EXPECT_TRUE(ot::Message::Decode(frame, output, encoding));
+    EXPECT_EQ(Encoding::Binary, encoding);
+    EXPECT_STREQ(serialized_->Get(), output->Get());
+}
+
+TEST_F(Test_Message, empty)
+{
+    auto output = ot::String::Factory();
+    auto encoding = Encoding::Armored;
+
+    EXPECT_TRUE(
+        ot::Message::Encode(ot::String::Factory(), Encoding::Binary).empty());
+    EXPECT_TRUE(
+        ot::Message::Encode(ot::String::Factory(), Encoding::Armored).empty());
+    EXPECT_FALSE(ot::Message::Decode("", output, encoding));
+}
+
+TEST_F(Test_Message, failure)
+{
+    auto output = ot::String::Factory();
+    auto encoding = Encoding::Armored;
+
+    // Armored clients and older notaries have always used an empty frame
+    EXPECT_TRUE(ot::Message::Failure(Encoding::Armored).empty());
+
+    // A binary client must be able to tell a notary which decoded its request
+    // but failed to process it from one which could not decode it at all
+    const auto binary = ot::Message::Failure(Encoding::Binary);
+
+    ASSERT_FALSE(binary.empty());
+    EXPECT_EQ('\0', binary.front());
+    EXPECT_FALSE(ot::Message::Decode(binary, output, encoding));
+    EXPECT_EQ(Encoding::Binary, encoding);
+    EXPECT_FALSE(output->Exists());
+}
+
+TEST_F(Test_Message, round_trip_latency)
+{
+    // Records the average time taken to encode and decode a notary reply
+    // in each encoding. Armored frames use the configured compression level.
+    constexpr auto iterations = int{50};
+    auto time = [&](const Encoding encoding) {
+        const auto start = std::chrono::steady_clock::now();
+
+        for (auto i = int{0}; i < iterations; ++i) {
+            auto output = ot::String::Factory();
+            auto detected = Encoding::Armored;
+            const auto frame = ot::Message::Encode(serialized_, encoding);
+
+            EXPECT_TRUE(ot::Message::Decode(frame, output, detected));
+            EXPECT_EQ(encoding, detected);
+            EXPECT_EQ(serialized_->GetLength(), output->GetLength());
+        }
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   std::chrono::steady_clock::now() - start)
+                   .count() /
+               iterations;
+    };
+
+    RecordProperty(
+        "armored_round_trip_us", static_cast<int>(time(Encoding::Armored)));
+    RecordProperty(
+        "binary_round_trip_us", static_cast<int>(time(Encoding::Binary)));
+}
@@ -0,0 +1,173 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/OTStorageLMDB.hpp"
+#include "internal/api/Api.hpp"
+#include "internal/api/client/Client.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Legacy.hpp"
+#include "opentxs/api/client/Manager.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace
+{
+using Storage = ot::OTDB::StorageLMDB;
+
+class Test_OTStorageLMDB : public ::testing::Test
+{
+public:
+    const ot::api::internal::Core& api_;
+    const fs::path folder_;
+    const std::string data_;
+    const std::string nyms_;
+    std::unique_ptr<Storage> storage_;
+
+    static auto write(const fs::path& path, const std::string& data) -> void
+    {
+        fs::create_directories(path.parent_path());
+        auto file = std::ofstream{
+            path.string(), std::ios::out | std::ios::binary | std::ios::trunc};
+        file.write(data.data(), data.size());
+    }
+
+    auto import(const bool force = false) const -> bool
+    {
+        return Storage::Import(api_, data_, force);
+    }
+    auto query(const std::string& one, const std::string& folder = {}) const
+        -> std::string
+    {
+        return storage_->QueryPlainString(
+            api_, data_, folder.empty() ? nyms_ : folder, one, "", "");
+    }
+    auto store(const std::string& one, const std::string& value) const -> bool
+    {
+        return storage_->StorePlainString(
+            api_, value, data_, nyms_, one, "", "");
+    }
+
+    Test_OTStorageLMDB()
+        : api_(dynamic_cast<const ot::api::client::internal::Manager&>(
+              ot::Context().StartClient({}, 0)))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-otdb-%%%%-%%%%-%%%%-%%%%"))
+        , data_(folder_.string())
+        , nyms_(api_.Legacy().Nym())
+        , storage_(Storage::Instantiate())
+    {
+        fs::create_directories(folder_);
+    }
+
+    ~Test_OTStorageLMDB() override { fs::remove_all(folder_); }
+};
+}  // namespace
+
+TEST_F(Test_OTStorageLMDB, store_and_erase)
+{
+    ASSERT_TRUE(storage_);
+    ASSERT_TRUE(import());
+
+    const auto one = std::string{"alice"};
+    auto key = std::string{};
+
+    EXPECT_FALSE(storage_->Exists(api_, data_, nyms_, one, "", ""));
+    EXPECT_EQ(query(one), "");
+
+    ASSERT_TRUE(store(one, "first"));
+    EXPECT_TRUE(storage_->Exists(api_, data_, nyms_, one, "", ""));
+    EXPECT_EQ(query(one), "first");
+    EXPECT_EQ(
+        storage_->FormPathString(api_, key, data_, nyms_, one, "", ""),
+        std::int64_t{5});
+    EXPECT_EQ(key, nyms_ + "/" + one);
+
+    // Overwriting replaces the value, and other instances share the same
+    // environment
+    ASSERT_TRUE(store(one, "second"));
+
+    auto other = std::unique_ptr<Storage>{Storage::Instantiate()};
+
+    EXPECT_EQ(
+        other->QueryPlainString(api_, data_, nyms_, one, "", ""), "second");
+
+    EXPECT_TRUE(storage_->EraseValueByKey(api_, data_, nyms_, one, "", ""));
+    EXPECT_FALSE(storage_->Exists(api_, data_, nyms_, one, "", ""));
+    EXPECT_EQ(query(one), "");
+    EXPECT_FALSE(storage_->EraseValueByKey(api_, data_, nyms_, one, "", ""));
+
+    // Keys which StorageFS would reject are rejected the same way
+    EXPECT_FALSE(store("ab", "value"));
+    EXPECT_FALSE(storage_->StorePlainString(
+        api_, "value", data_, nyms_, one, "", "three"));
+}
+
+TEST_F(Test_OTStorageLMDB, import_partial_commit)
+{
+    ASSERT_TRUE(storage_);
+
+    const auto root = fs::path{folder_};
+    // The key for this file is longer than LMDB allows
+    const auto invalid = root / nyms_ / std::string(255, 'a');
+    write(root / "notary.xml", "notary");
+    write(root / nyms_ / "alice", "alice");
+    write(invalid / std::string(255, 'b') / "ccc", "invalid");
+
+    EXPECT_FALSE(import());
+
+    // The files which were copied are committed even though the import as a
+    // whole failed
+    EXPECT_EQ(query("notary.xml", "."), "notary");
+    EXPECT_EQ(query("alice"), "alice");
+
+    // Since the import was not recorded as complete it runs again
+    fs::remove_all(invalid);
+    write(root / nyms_ / "alice", "alice 2");
+
+    EXPECT_TRUE(import());
+    EXPECT_EQ(query("alice"), "alice 2");
+}
+
+TEST_F(Test_OTStorageLMDB, import_rerun)
+{
+    ASSERT_TRUE(storage_);
+
+    const auto root = fs::path{folder_};
+    write(root / nyms_ / "alice", "alice");
+    write(root / nyms_ / "bob", "bob");
+
+    ASSERT_TRUE(import());
+    EXPECT_EQ(query("alice"), "alice");
+    EXPECT_EQ(query("bob"), "bob");
+
+    // Values written after the import are not replaced by the legacy files
+    ASSERT_TRUE(store("alice", "changed"));
+    write(root / nyms_ / "bob", "bob 2");
+    write(root / nyms_ / "carol", "carol");
+
+    EXPECT_TRUE(import());
+    EXPECT_EQ(query("alice"), "changed");
+    EXPECT_EQ(query("bob"), "bob");
+    EXPECT_EQ(query("carol"), "");
+
+    // Unless the import is forced
+    EXPECT_TRUE(import(true));
+    EXPECT_EQ(query("alice"), "alice");
+    EXPECT_EQ(query("bob"), "bob 2");
+    EXPECT_EQ(query("carol"), "carol");
+}
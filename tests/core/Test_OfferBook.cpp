@@ -0,0 +1,262 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/trade/OTOffer.hpp"
+#include "opentxs/core/trade/OfferBook.hpp"
+
+namespace
+{
+class Test_OfferBook : public ::testing::Test
+{
+public:
+    using Numbers = std::vector<std::int64_t>;
+
+    const ot::api::client::Manager& api_;
+    std::vector<std::unique_ptr<ot::OTOffer>> offers_;
+
+    static auto numbers(const ot::OfferBook& book) -> Numbers
+    {
+        auto output = Numbers{};
+
+        for (const auto* offer : book) {
+            output.emplace_back(offer->GetTransactionNum());
+        }
+
+        return output;
+    }
+
+    auto make(
+        const bool ask,
+        const std::int64_t price,
+        const std::int64_t number,
+        const std::time_t added) -> ot::OTOffer&
+    {
+        auto& offer = offers_.emplace_back(api_.Factory().Offer());
+
+        EXPECT_TRUE(offer);
+        EXPECT_TRUE(offer->MakeOffer(ask, price, 100, 1, number));
+
+        offer->SetDateAddedToMarket(ot::Clock::from_time_t(added));
+
+        return *offer;
+    }
+
+    Test_OfferBook()
+        : api_(ot::Context().StartClient({}, 0))
+        , offers_()
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_OfferBook, empty)
+{
+    const auto book = ot::OfferBook{true};
+
+    EXPECT_TRUE(book.empty());
+    EXPECT_EQ(0u, book.size());
+    EXPECT_EQ(0, book.BestPrice());
+    EXPECT_EQ(0, book.BestLimitPrice());
+    EXPECT_TRUE(book.begin() == book.end());
+}
+
+TEST_F(Test_OfferBook, bid_priority)
+{
+    auto book = ot::OfferBook{true};
+    book.Add(make(false, 10, 1, 1));
+    book.Add(make(false, 12, 2, 2));
+    book.Add(make(false, 10, 3, 3));
+    book.Add(make(false, 11, 4, 4));
+
+    // Highest price first, then oldest first
+    EXPECT_EQ(Numbers({2, 4, 1, 3}), numbers(book));
+    EXPECT_EQ(4u, book.size());
+    EXPECT_EQ(3u, book.GetLevels().size());
+    EXPECT_EQ(12, book.BestPrice());
+    EXPECT_EQ(12, book.BestLimitPrice());
+}
+
+TEST_F(Test_OfferBook, ask_priority)
+{
+    auto book = ot::OfferBook{false};
+    book.Add(make(true, 10, 1, 1));
+    book.Add(make(true, 8, 2, 2));
+    book.Add(make(true, 10, 3, 3));
+    book.Add(make(true, 9, 4, 4));
+
+    // Lowest price first, then oldest first
+    EXPECT_EQ(Numbers({2, 4, 1, 3}), numbers(book));
+    EXPECT_EQ(4u, book.size());
+    EXPECT_EQ(3u, book.GetLevels().size());
+    EXPECT_EQ(8, book.BestPrice());
+    EXPECT_EQ(8, book.BestLimitPrice());
+}
+
+TEST_F(Test_OfferBook, market_ask)
+{
+    auto book = ot::OfferBook{false};
+    book.Add(make(true, 0, 1, 1));
+    book.Add(make(true, 5, 2, 2));
+    book.Add(make(true, 0, 3, 3));
+
+    // A market ask accepts any price, so it is the best ask
+    EXPECT_EQ(Numbers({1, 3, 2}), numbers(book));
+    EXPECT_EQ(0, book.BestPrice());
+    EXPECT_EQ(5, book.BestLimitPrice());
+}
+
+TEST_F(Test_OfferBook, market_bid)
+{
+    auto book = ot::OfferBook{true};
+    book.Add(make(false, 0, 1, 1));
+
+    EXPECT_EQ(0, book.BestPrice());
+    EXPECT_EQ(0, book.BestLimitPrice());
+
+    book.Add(make(false, 5, 2, 2));
+
+    // A market bid sorts below every limit bid
+    EXPECT_EQ(Numbers({2, 1}), numbers(book));
+    EXPECT_EQ(5, book.BestPrice());
+    EXPECT_EQ(5, book.BestLimitPrice());
+}
+
+TEST_F(Test_OfferBook, remove)
+{
+    auto book = ot::OfferBook{true};
+    auto& first = make(false, 10, 1, 1);
+    auto& second = make(false, 10, 2, 2);
+    auto& third = make(false, 11, 3, 3);
+    book.Add(first);
+    book.Add(second);
+    book.Add(third);
+
+    EXPECT_EQ(nullptr, book.Remove(12, 1));
+    EXPECT_EQ(nullptr, book.Remove(10, 3));
+    EXPECT_EQ(nullptr, book.Remove(10, 4));
+    EXPECT_EQ(3u, book.size());
+
+    EXPECT_EQ(&first, book.Remove(10, 1));
+    EXPECT_EQ(Numbers({3, 2}), numbers(book));
+    EXPECT_EQ(2u, book.GetLevels().size());
+
+    EXPECT_EQ(&third, book.Remove(11, 3));
+    EXPECT_EQ(Numbers({2}), numbers(book));
+    EXPECT_EQ(1u, book.GetLevels().size());
+    EXPECT_EQ(10, book.BestPrice());
+
+    EXPECT_EQ(&second, book.Remove(10, 2));
+    EXPECT_TRUE(book.empty());
+    EXPECT_TRUE(book.GetLevels().empty());
+    EXPECT_EQ(nullptr, book.Remove(10, 2));
+}
+
+TEST_F(Test_OfferBook, pop)
+{
+    auto book = ot::OfferBook{false};
+    book.Add(make(true, 10, 1, 1));
+    book.Add(make(true, 8, 2, 2));
+    book.Add(make(true, 10, 3, 3));
+    auto popped = std::set<std::int64_t>{};
+
+    while (false == book.empty()) {
+        const auto size = book.size();
+        const auto* offer = book.Pop();
+
+        ASSERT_NE(nullptr, offer);
+        EXPECT_TRUE(popped.emplace(offer->GetTransactionNum()).second);
+        EXPECT_EQ(size - 1u, book.size());
+    }
+
+    EXPECT_EQ(std::set<std::int64_t>({1, 2, 3}), popped);
+    EXPECT_TRUE(book.GetLevels().empty());
+    EXPECT_EQ(nullptr, book.Pop());
+}
+
+TEST_F(Test_OfferBook, reload_order)
+{
+    // A market loaded from storage may add its offers in any order
+    auto book = ot::OfferBook{true};
+    book.Add(make(false, 10, 3, 3));
+    book.Add(make(false, 10, 1, 1));
+    book.Add(make(false, 10, 5, 2));
+    book.Add(make(false, 10, 4, 2));
+
+    // Time order, with the transaction number breaking ties
+    EXPECT_EQ(Numbers({1, 4, 5, 3}), numbers(book));
+    EXPECT_EQ(1u, book.GetLevels().size());
+}
+
+TEST_F(Test_OfferBook, latency)
+{
+    // Records the time taken to add, iterate and remove a deep book with
+    // many offers at each price
+    constexpr auto count = std::int64_t{2000};
+    constexpr auto levels = std::int64_t{50};
+    auto book = ot::OfferBook{true};
+    auto offers = std::vector<ot::OTOffer*>{};
+    offers.reserve(count);
+
+    for (auto i = std::int64_t{0}; i < count; ++i) {
+        offers.emplace_back(&make(false, 1 + (i % levels), i + 1, i + 1));
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const auto elapsed = [](const Clock::time_point& start) {
+        return static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start)
+                .count());
+    };
+
+    auto start = Clock::now();
+
+    for (auto* offer : offers) { book.Add(*offer); }
+
+    RecordProperty("add_us", elapsed(start));
+
+    EXPECT_EQ(static_cast<std::size_t>(count), book.size());
+    EXPECT_EQ(static_cast<std::size_t>(levels), book.GetLevels().size());
+
+    start = Clock::now();
+    auto visited = std::size_t{0};
+
+    for (const auto* offer : book) {
+        if (nullptr != offer) { ++visited; }
+    }
+
+    RecordProperty("iterate_us", elapsed(start));
+
+    EXPECT_EQ(book.size(), visited);
+
+    start = Clock::now();
+
+    for (const auto* offer : offers) {
+        EXPECT_EQ(
+            offer,
+            book.Remove(offer->GetPriceLimit(), offer->GetTransactionNum()));
+    }
+
+    RecordProperty("remove_us", elapsed(start));
+
+    EXPECT_TRUE(book.empty());
+}
@@ -0,0 +1,155 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/transaction/ReceiptCache.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/core/String.hpp"
+
+namespace
+{
+class Test_ReceiptCache : public ::testing::Test
+{
+public:
+    static constexpr std::size_t limit_{100};
+
+    ot::ReceiptCache cache_;
+
+    static auto receipt(const char c, const std::size_t size) -> std::string
+    {
+        return std::string(size, c);
+    }
+
+    auto cached(const std::string& key) -> bool
+    {
+        auto output = std::string{};
+
+        return cache_.Find(key, output);
+    }
+
+    Test_ReceiptCache()
+        : cache_(limit_)
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_ReceiptCache, find)
+{
+    auto output = std::string{};
+
+    EXPECT_FALSE(cache_.Find("a", output));
+
+    cache_.Add("a", receipt('a', 10));
+
+    EXPECT_TRUE(cache_.Find("a", output));
+    EXPECT_EQ(receipt('a', 10), output);
+}
+
+TEST_F(Test_ReceiptCache, replace)
+{
+    auto output = std::string{};
+    cache_.Add("a", receipt('a', 60));
+    cache_.Add("a", receipt('b', 60));
+
+    ASSERT_TRUE(cache_.Find("a", output));
+    EXPECT_EQ(receipt('b', 60), output);
+
+    // The replaced entry must not count against the limit
+    cache_.Add("b", receipt('c', 40));
+
+    EXPECT_TRUE(cached("a"));
+    EXPECT_TRUE(cached("b"));
+}
+
+TEST_F(Test_ReceiptCache, erase)
+{
+    cache_.Add("a", receipt('a', 10));
+    cache_.Erase("a");
+    cache_.Erase("missing");
+
+    EXPECT_FALSE(cached("a"));
+}
+
+TEST_F(Test_ReceiptCache, byte_limit)
+{
+    cache_.Add("a", receipt('a', 40));
+    cache_.Add("b", receipt('b', 40));
+    cache_.Add("c", receipt('c', 20));
+
+    EXPECT_TRUE(cached("a"));
+    EXPECT_TRUE(cached("b"));
+    EXPECT_TRUE(cached("c"));
+
+    cache_.Add("d", receipt('d', 1));
+
+    EXPECT_FALSE(cached("a"));
+    EXPECT_TRUE(cached("b"));
+    EXPECT_TRUE(cached("c"));
+    EXPECT_TRUE(cached("d"));
+}
+
+TEST_F(Test_ReceiptCache, eviction_order)
+{
+    cache_.Add("a", receipt('a', 30));
+    cache_.Add("b", receipt('b', 30));
+    cache_.Add("c", receipt('c', 30));
+
+    // Finding an entry makes it the most recently used
+    EXPECT_TRUE(cached("a"));
+
+    cache_.Add("d", receipt('d', 30));
+
+    EXPECT_TRUE(cached("a"));
+    EXPECT_FALSE(cached("b"));
+    EXPECT_TRUE(cached("c"));
+    EXPECT_TRUE(cached("d"));
+
+    cache_.Add("e", receipt('e', 60));
+
+    EXPECT_FALSE(cached("a"));
+    EXPECT_FALSE(cached("c"));
+    EXPECT_TRUE(cached("d"));
+    EXPECT_TRUE(cached("e"));
+}
+
+TEST_F(Test_ReceiptCache, oversize)
+{
+    cache_.Add("a", receipt('a', 10));
+    cache_.Add("b", receipt('b', limit_ + 1));
+
+    EXPECT_TRUE(cached("a"));
+    EXPECT_FALSE(cached("b"));
+
+    // An oversize replacement drops the stale entry
+    cache_.Add("a", receipt('c', limit_ + 1));
+
+    EXPECT_FALSE(cached("a"));
+}
+
+TEST_F(Test_ReceiptCache, key)
+{
+    const auto key = ot::ReceiptCache::Key(
+        "data",
+        ot::String::Factory("nymbox"),
+        ot::String::Factory("notary"),
+        ot::String::Factory("nym"),
+        ot::String::Factory("42.rct"));
+    const auto other = ot::ReceiptCache::Key(
+        "data",
+        ot::String::Factory("nymbox"),
+        ot::String::Factory("notary"),
+        ot::String::Factory("nym"),
+        ot::String::Factory("43.rct"));
+
+    EXPECT_FALSE(key.empty());
+    EXPECT_NE(key, other);
+}
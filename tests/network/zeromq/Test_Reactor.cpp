@@ -0,0 +1,240 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Forward.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/core/Log.hpp"
+#include "opentxs/network/zeromq/Context.hpp"
+#include "opentxs/network/zeromq/ListenCallback.hpp"
+#include "opentxs/network/zeromq/Message.hpp"
+#include "opentxs/network/zeromq/ReplyCallback.hpp"
+#include "opentxs/network/zeromq/socket/Pull.hpp"
+#include "opentxs/network/zeromq/socket/Push.hpp"
+#include "opentxs/network/zeromq/socket/Reply.hpp"
+#include "opentxs/network/zeromq/socket/Sender.tpp"
+#include "opentxs/network/zeromq/socket/Socket.hpp"
+
+using namespace opentxs;
+
+namespace zmq = ot::network::zeromq;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// More than the largest reactor so that every worker has several sockets
+constexpr auto socket_count_{16};
+constexpr auto message_count_{100};
+// Every call used to wait for up to one 100 ms receiver poll
+constexpr auto apply_count_{20};
+constexpr auto apply_limit_ = std::chrono::milliseconds{500};
+
+class Test_Reactor : public ::testing::Test
+{
+public:
+    const zmq::Context& context_;
+    const std::string endpoint_{"inproc://opentxs/test/reactor_test"};
+
+    auto endpoint(const int index) const -> std::string
+    {
+        return endpoint_ + std::to_string(index);
+    }
+    auto time_apply(const zmq::socket::Socket& socket) const
+        -> std::chrono::microseconds
+    {
+        const auto start = Clock::now();
+
+        for (auto i = 0; i < apply_count_; ++i) {
+            EXPECT_TRUE(socket.SetTimeouts(
+                std::chrono::milliseconds(0),
+                std::chrono::milliseconds(30000),
+                std::chrono::milliseconds(-1)));
+        }
+
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - start);
+    }
+    template <typename Predicate>
+    auto wait(Predicate predicate) const -> bool
+    {
+        const auto end = Clock::now() + std::chrono::seconds(15);
+
+        while (Clock::now() < end) {
+            if (predicate()) { return true; }
+
+            Sleep(std::chrono::milliseconds(10));
+        }
+
+        return predicate();
+    }
+
+    Test_Reactor()
+        : context_(Context().ZMQ())
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_Reactor, many_sockets)
+{
+    auto counters =
+        std::vector<std::atomic<int>>(static_cast<std::size_t>(socket_count_));
+    auto callbacks = std::vector<OTZMQListenCallback>{};
+    auto pulls = std::vector<OTZMQPullSocket>{};
+    auto pushes = std::vector<OTZMQPushSocket>{};
+
+    for (auto i = 0; i < socket_count_; ++i) {
+        auto& counter = counters.at(static_cast<std::size_t>(i));
+        const auto& callback =
+            callbacks.emplace_back(zmq::ListenCallback::Factory(
+                [&counter](zmq::Message&) -> void { ++counter; }));
+        const auto& pull = pulls.emplace_back(context_.PullSocket(
+            callback, zmq::socket::Socket::Direction::Bind));
+
+        ASSERT_TRUE(pull->Start(endpoint(i)));
+
+        const auto& push = pushes.emplace_back(
+            context_.PushSocket(zmq::socket::Socket::Direction::Connect));
+
+        ASSERT_TRUE(push->Start(endpoint(i)));
+    }
+
+    for (auto n = 0; n < message_count_; ++n) {
+        for (const auto& push : pushes) {
+            ASSERT_TRUE(push->Send(std::to_string(n)));
+        }
+    }
+
+    EXPECT_TRUE(wait([&]() -> bool {
+        for (const auto& counter : counters) {
+            if (message_count_ > counter.load()) { return false; }
+        }
+
+        return true;
+    }));
+
+    for (const auto& counter : counters) {
+        EXPECT_EQ(counter.load(), message_count_);
+    }
+}
+
+TEST_F(Test_Reactor, apply_socket_wakes_shared_reactor)
+{
+    auto callback =
+        zmq::ListenCallback::Factory([](zmq::Message&) -> void {});
+    auto pull =
+        context_.PullSocket(callback, zmq::socket::Socket::Direction::Bind);
+
+    ASSERT_TRUE(pull->Start(endpoint_ + "apply_shared"));
+
+    const auto elapsed = time_apply(pull.get());
+    RecordProperty("apply_shared_us", static_cast<int>(elapsed.count()));
+
+    EXPECT_LT(elapsed, apply_limit_);
+}
+
+TEST_F(Test_Reactor, apply_socket_wakes_private_reactor)
+{
+    auto callback = zmq::ReplyCallback::Factory(
+        [this](const zmq::Message& input) -> OTZMQMessage {
+            return context_.ReplyMessage(input);
+        });
+    auto reply =
+        context_.ReplySocket(callback, zmq::socket::Socket::Direction::Bind);
+
+    ASSERT_TRUE(reply->Start(endpoint_ + "apply_private"));
+
+    const auto elapsed = time_apply(reply.get());
+    RecordProperty("apply_private_us", static_cast<int>(elapsed.count()));
+
+    EXPECT_LT(elapsed, apply_limit_);
+}
+
+TEST_F(Test_Reactor, callback_uses_other_sockets)
+{
+    // Sockets are assigned to workers in turn so one of these shares a
+    // worker with the socket whose callback uses them
+    constexpr auto others{4};
+    auto noop = zmq::ListenCallback::Factory([](zmq::Message&) -> void {});
+    auto targets = std::vector<OTZMQPullSocket>{};
+    std::atomic<int> applied{0};
+    std::atomic<int> finished{0};
+    auto callback = zmq::ListenCallback::Factory([&](zmq::Message&) -> void {
+        for (const auto& target : targets) {
+            if (target->SetTimeouts(
+                    std::chrono::milliseconds(0),
+                    std::chrono::milliseconds(30000),
+                    std::chrono::milliseconds(-1))) {
+                ++applied;
+            }
+        }
+
+        ++finished;
+    });
+    auto pull =
+        context_.PullSocket(callback, zmq::socket::Socket::Direction::Bind);
+
+    for (auto i = 0; i < others; ++i) {
+        const auto& target = targets.emplace_back(context_.PullSocket(
+            noop, zmq::socket::Socket::Direction::Bind));
+
+        ASSERT_TRUE(target->Start(endpoint_ + "target" + std::to_string(i)));
+    }
+
+    ASSERT_TRUE(pull->Start(endpoint_ + "source"));
+
+    auto push = context_.PushSocket(zmq::socket::Socket::Direction::Connect);
+
+    ASSERT_TRUE(push->Start(endpoint_ + "source"));
+    ASSERT_TRUE(push->Send(std::string{"apply"}));
+    EXPECT_TRUE(wait([&]() -> bool { return 0 < finished.load(); }));
+    EXPECT_EQ(applied.load(), others);
+}
+
+TEST_F(Test_Reactor, close)
+{
+    std::atomic<int> received{0};
+    auto callback = zmq::ListenCallback::Factory(
+        [&](zmq::Message&) -> void { ++received; });
+    auto pull =
+        context_.PullSocket(callback, zmq::socket::Socket::Direction::Bind);
+
+    ASSERT_TRUE(pull->Start(endpoint_ + "close"));
+
+    auto push = context_.PushSocket(zmq::socket::Socket::Direction::Connect);
+
+    ASSERT_TRUE(push->Start(endpoint_ + "close"));
+
+    for (auto n = 0; n < message_count_; ++n) {
+        ASSERT_TRUE(push->Send(std::to_string(n)));
+    }
+
+    EXPECT_TRUE(pull->Close());
+
+    const auto after = received.load();
+
+    // The reactor does not touch a socket once it has been closed
+    for (auto n = 0; n < message_count_; ++n) {
+        push->Send(std::to_string(n));
+    }
+
+    Sleep(std::chrono::milliseconds(200));
+
+    EXPECT_EQ(received.load(), after);
+}
@@ -0,0 +1,238 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "core/cron/Schedule.hpp"
+#include "opentxs/Types.hpp"
+#include "server/CronSignal.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Schedule = ot::cron::Schedule;
+using Signal = ot::server::CronSignal;
+
+constexpr auto interval_ = std::chrono::seconds{30};
+constexpr auto tolerance_ = std::chrono::milliseconds{250};
+
+class Test_CronSchedule : public ::testing::Test
+{
+public:
+    const ot::Time now_;
+    std::mutex lock_;
+    Schedule schedule_;
+    Signal signal_;
+    std::map<std::int64_t, ot::Time> processed_;
+
+    // Processes every item when it falls due, the same way the notary cron
+    // thread does, until the signal is stopped
+    auto run() -> void
+    {
+        do {
+            ot::Lock lock(lock_);
+            const auto now = ot::Clock::now();
+
+            if (0 < schedule_.Timeout(now, {}).count()) { continue; }
+
+            for (const auto& number : schedule_.Due(now)) {
+                processed_.emplace(number, now);
+                schedule_.Remove(number);
+            }
+        } while (signal_.Wait([&] {
+            ot::Lock lock(lock_);
+
+            return schedule_.Timeout(ot::Clock::now(), {});
+        }()));
+    }
+    auto processed(const std::int64_t number) -> ot::Time
+    {
+        ot::Lock lock(lock_);
+        const auto it = processed_.find(number);
+
+        return (processed_.end() == it) ? ot::Time{} : it->second;
+    }
+    auto wait_for(const std::int64_t number) -> ot::Time
+    {
+        const auto limit = ot::Clock::now() + std::chrono::seconds{5};
+
+        while (ot::Clock::now() < limit) {
+            const auto output = processed(number);
+
+            if (ot::Time{} != output) { return output; }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{5});
+        }
+
+        return {};
+    }
+
+    Test_CronSchedule()
+        : now_(ot::Clock::now())
+        , lock_()
+        , schedule_()
+        , signal_()
+        , processed_()
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_CronSchedule, next_process_date)
+{
+    const auto last = now_ - std::chrono::seconds{10};
+    const auto expected = last + interval_ + ot::Clock::duration{1};
+
+    // Never processed
+    EXPECT_EQ(Schedule::NextProcessDate(false, {}, interval_, {}), ot::Time{});
+    EXPECT_EQ(Schedule::NextProcessDate(false, last, interval_, {}), expected);
+
+    // Expiration comes before the next interval
+    const auto expires = now_ + std::chrono::seconds{5};
+
+    EXPECT_EQ(
+        Schedule::NextProcessDate(false, last, interval_, expires), expires);
+    EXPECT_EQ(
+        Schedule::NextProcessDate(false, last, interval_, expected + interval_),
+        expected);
+
+    // Removal never waits for the interval or the expiration
+    EXPECT_EQ(
+        Schedule::NextProcessDate(true, last, interval_, expires), ot::Time{});
+}
+
+TEST_F(Test_CronSchedule, due)
+{
+    schedule_.Add(1, now_ + std::chrono::seconds{2});
+    schedule_.Add(2, now_ - std::chrono::seconds{1});
+    schedule_.Add(3, now_);
+    schedule_.Add(4, now_ - std::chrono::seconds{2});
+
+    EXPECT_EQ(schedule_.Next(), now_ - std::chrono::seconds{2});
+    EXPECT_EQ(schedule_.Due(now_), (Schedule::Numbers{4, 2, 3}));
+    EXPECT_EQ(schedule_.Due(now_ + std::chrono::seconds{2}).size(), 4u);
+
+    // Adding an item again moves it
+    schedule_.Add(4, now_ + std::chrono::seconds{3});
+
+    EXPECT_EQ(schedule_.Due(now_), (Schedule::Numbers{2, 3}));
+
+    schedule_.Remove(2);
+    schedule_.Remove(3);
+    schedule_.Remove(5);
+
+    EXPECT_TRUE(schedule_.Due(now_).empty());
+    EXPECT_EQ(schedule_.Next(), now_ + std::chrono::seconds{2});
+
+    schedule_.Remove(1);
+    schedule_.Remove(4);
+
+    EXPECT_EQ(schedule_.Next(), ot::Time::max());
+}
+
+TEST_F(Test_CronSchedule, timeout)
+{
+    const auto earliest = now_ + std::chrono::milliseconds{50};
+
+    // Nothing scheduled
+    EXPECT_GT(schedule_.Timeout(now_, earliest), std::chrono::hours{24});
+
+    schedule_.Add(1, now_ + std::chrono::seconds{2});
+
+    EXPECT_EQ(schedule_.Timeout(now_, earliest), std::chrono::seconds{2});
+
+    // Never less than the minimum time between rounds
+    schedule_.Add(1, now_);
+
+    EXPECT_EQ(
+        schedule_.Timeout(now_, earliest), std::chrono::milliseconds{50});
+
+    // Rounded up to the next millisecond
+    EXPECT_EQ(
+        schedule_.Timeout(now_ - std::chrono::microseconds{1500}, now_),
+        std::chrono::milliseconds{2});
+}
+
+TEST_F(Test_CronSchedule, flag_for_removal)
+{
+    const auto last = now_;
+    const auto due = Schedule::NextProcessDate(false, last, interval_, {});
+
+    EXPECT_FALSE(schedule_.Reschedule(1, {}));
+    EXPECT_FALSE(schedule_.Contains(1));
+
+    schedule_.Add(1, due);
+
+    EXPECT_TRUE(schedule_.Due(now_).empty());
+
+    // A market flags a filled trade, which must be removed in the next round
+    // rather than after its interval
+    EXPECT_TRUE(schedule_.Reschedule(
+        1, Schedule::NextProcessDate(true, last, interval_, {})));
+    EXPECT_EQ(schedule_.Due(now_), (Schedule::Numbers{1}));
+
+    // The item was removed before its reschedule arrived
+    schedule_.Remove(1);
+
+    EXPECT_FALSE(schedule_.Reschedule(1, {}));
+    EXPECT_TRUE(schedule_.Due(now_).empty());
+}
+
+TEST_F(Test_CronSchedule, run_at_deadline)
+{
+    const auto deadline = ot::Clock::now() + std::chrono::milliseconds{200};
+
+    {
+        ot::Lock lock(lock_);
+        schedule_.Add(1, deadline);
+        schedule_.Add(2, ot::Clock::now() + std::chrono::hours{1});
+    }
+
+    auto thread = std::async(std::launch::async, [&] { run(); });
+    const auto first = wait_for(1);
+
+    // Nothing in this test may return early while the thread is running
+    EXPECT_NE(first, ot::Time{});
+    EXPECT_GE(first, deadline);
+    EXPECT_LT(first, deadline + tolerance_);
+    RecordProperty(
+        "lateness_us",
+        static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(
+                             first - deadline)
+                             .count()));
+
+    // The thread is now waiting for an item due in an hour. Flagging it for
+    // removal must wake the thread instead of waiting for that deadline.
+    const auto flagged = ot::Clock::now();
+
+    {
+        ot::Lock lock(lock_);
+
+        EXPECT_TRUE(schedule_.Reschedule(2, {}));
+    }
+
+    signal_.Wake();
+    const auto second = wait_for(2);
+
+    EXPECT_NE(second, ot::Time{});
+    EXPECT_GE(second, flagged);
+    EXPECT_LT(second, flagged + tolerance_);
+
+    const auto stopped = ot::Clock::now();
+    signal_.Stop();
+    thread.get();
+
+    EXPECT_LT(ot::Clock::now(), stopped + tolerance_);
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/Factory.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/core/Message.hpp"
+#include "opentxs/core/String.hpp"
+#include "server/RequestLocks.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+using Locks = ot::server::RequestLocks;
+
+constexpr auto read_{"getAccountData"};
+constexpr auto write_{"processNymbox"};
+constexpr auto numbers_{"getTransactionNumbers"};
+constexpr auto global_{"processInbox"};
+constexpr auto wait_ = std::chrono::milliseconds{250};
+
+class Test_RequestLocks : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    Locks locks_;
+
+    // Distinct ids can share a stripe, so pick one which does not share a
+    // stripe with the first
+    static auto other_id(const std::string& id) -> std::string
+    {
+        constexpr auto stripes = std::size_t{64};
+        const auto hash = std::hash<std::string>{};
+
+        for (auto i = 0;; ++i) {
+            auto output = id + std::to_string(i);
+
+            if ((hash(output) % stripes) != (hash(id) % stripes)) {
+                return output;
+            }
+        }
+    }
+
+    auto request(
+        const char* command,
+        const std::string& nym,
+        const std::string& account = {}) const -> std::unique_ptr<ot::Message>
+    {
+        auto output = api_.Factory().Message();
+        output->m_strCommand = ot::String::Factory(command);
+        output->m_strNymID = ot::String::Factory(nym);
+        output->m_strAcctID = ot::String::Factory(account);
+
+        return output;
+    }
+    // Returns true if the second request can start while the first is in
+    // progress
+    auto parallel(const ot::Message& first, const ot::Message& second) const
+        -> bool
+    {
+        auto held = std::make_unique<Locks::Guard>(locks_, first);
+
+        return run_while_held(held, [&] { Locks::Guard lock{locks_, second}; });
+    }
+    template <typename Held, typename Function>
+    auto run_while_held(std::unique_ptr<Held>& held, Function function) const
+        -> bool
+    {
+        auto future = std::async(std::launch::async, [&] { function(); });
+        const auto status = future.wait_for(wait_);
+        held.reset();
+        future.get();
+
+        return std::future_status::ready == status;
+    }
+
+    Test_RequestLocks()
+        : api_(ot::Context().StartClient({}, 0))
+        , locks_()
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_RequestLocks, scope)
+{
+    EXPECT_EQ(
+        Locks::GetScope(ot::MessageType::getAccountData), Locks::Scope::Read);
+    EXPECT_EQ(
+        Locks::GetScope(ot::MessageType::processNymbox), Locks::Scope::Write);
+    EXPECT_EQ(
+        Locks::GetScope(ot::MessageType::getTransactionNumbers),
+        Locks::Scope::Write);
+    EXPECT_EQ(
+        Locks::GetScope(ot::MessageType::processInbox), Locks::Scope::Global);
+    EXPECT_EQ(
+        Locks::GetScope(ot::MessageType::notarizeTransaction),
+        Locks::Scope::Global);
+}
+
+TEST_F(Test_RequestLocks, separate_accounts)
+{
+    const auto nym = std::string{"nym"};
+    const auto account = std::string{"account"};
+    const auto first = request(read_, nym, account);
+    const auto second = request(read_, other_id(nym), other_id(account));
+
+    EXPECT_TRUE(parallel(*first, *second));
+}
+
+TEST_F(Test_RequestLocks, same_account)
+{
+    const auto nym = std::string{"nym"};
+    const auto account = std::string{"account"};
+    const auto first = request(read_, nym, account);
+    const auto second = request(read_, other_id(nym), account);
+
+    EXPECT_FALSE(parallel(*first, *second));
+}
+
+TEST_F(Test_RequestLocks, separate_nyms)
+{
+    const auto nym = std::string{"nym"};
+    const auto first = request(write_, nym);
+    const auto second = request(numbers_, other_id(nym));
+    const auto third = request(read_, other_id(nym), "account");
+
+    EXPECT_TRUE(parallel(*first, *second));
+    EXPECT_TRUE(parallel(*first, *third));
+}
+
+TEST_F(Test_RequestLocks, same_nym)
+{
+    const auto nym = std::string{"nym"};
+    const auto first = request(write_, nym);
+    const auto second = request(numbers_, nym);
+    const auto third = request(read_, nym, "account");
+
+    EXPECT_FALSE(parallel(*first, *second));
+    EXPECT_FALSE(parallel(*first, *third));
+}
+
+TEST_F(Test_RequestLocks, global)
+{
+    const auto nym = std::string{"nym"};
+    const auto account = std::string{"account"};
+    const auto first = request(global_, nym, account);
+    const auto second = request(read_, other_id(nym), other_id(account));
+    const auto third = request(write_, other_id(nym));
+
+    EXPECT_FALSE(parallel(*first, *second));
+    EXPECT_FALSE(parallel(*first, *third));
+    EXPECT_FALSE(parallel(*second, *first));
+}
+
+TEST_F(Test_RequestLocks, cron)
+{
+    const auto first = request(write_, "nym");
+
+    {
+        auto held = std::make_unique<ot::sLock>(locks_.Shared());
+
+        EXPECT_TRUE(run_while_held(
+            held, [&] { Locks::Guard lock{locks_, *first}; }));
+    }
+
+    {
+        auto held = std::make_unique<ot::eLock>(locks_.Exclusive());
+
+        EXPECT_FALSE(run_while_held(
+            held, [&] { Locks::Guard lock{locks_, *first}; }));
+    }
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#include "storage/FlushTimer.hpp"
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+using Timer = opentxs::storage::FlushTimer;
+
+constexpr auto interval_ = std::chrono::milliseconds{100};
+constexpr auto never_ = std::chrono::hours{1};
+
+// Stands in for the storage tree: changes mark the root dirty, and a flush
+// commits the root only if it is dirty
+class Test_FlushTimer : public ::testing::Test
+{
+public:
+    std::mutex lock_;
+    bool dirty_;
+    int commits_;
+    std::promise<Clock::time_point> committed_;
+
+    auto change() -> void
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        dirty_ = true;
+    }
+    auto commits() -> int
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+
+        return commits_;
+    }
+    auto flush() -> void
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+
+        if (false == dirty_) { return; }
+
+        dirty_ = false;
+
+        if (0 == commits_++) { committed_.set_value(Clock::now()); }
+    }
+
+    Test_FlushTimer()
+        : lock_()
+        , dirty_(false)
+        , commits_(0)
+        , committed_()
+    {
+    }
+};
+}  // namespace
+
+TEST_F(Test_FlushTimer, dirty_root_flushed_after_interval)
+{
+    auto future = committed_.get_future();
+    auto timer = Timer{interval_, [this] { flush(); }};
+    const auto start = Clock::now();
+    change();
+
+    ASSERT_EQ(future.wait_for(4 * interval_), std::future_status::ready);
+
+    const auto elapsed = future.get() - start;
+
+    // The change waits for the next tick rather than being written at once
+    EXPECT_GE(elapsed, interval_ / 2);
+    EXPECT_EQ(commits(), 1);
+    RecordProperty(
+        "flush_latency_us",
+        static_cast<int>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                .count()));
+
+    // A later change is committed by a later tick
+    change();
+    const auto deadline = Clock::now() + 4 * interval_;
+
+    while ((1 == commits()) && (Clock::now() < deadline)) {
+        std::this_thread::sleep_for(interval_ / 10);
+    }
+
+    EXPECT_EQ(commits(), 2);
+}
+
+TEST_F(Test_FlushTimer, clean_root_not_flushed)
+{
+    auto timer = Timer{interval_, [this] { flush(); }};
+    std::this_thread::sleep_for(3 * interval_);
+
+    EXPECT_EQ(commits(), 0);
+
+    timer.Stop();
+
+    EXPECT_EQ(commits(), 0);
+}
+
+TEST_F(Test_FlushTimer, dirty_root_flushed_on_shutdown)
+{
+    {
+        auto timer = Timer{never_, [this] { flush(); }};
+        change();
+
+        EXPECT_EQ(commits(), 0);
+
+        timer.Stop();
+
+        EXPECT_EQ(commits(), 1);
+
+        // The timer does not run once it has been stopped
+        change();
+        timer.Stop();
+
+        EXPECT_EQ(commits(), 1);
+    }
+
+    EXPECT_EQ(commits(), 1);
+
+    // The change made after the first timer stopped is committed when the
+    // second one is destroyed
+    {
+        auto timer = Timer{never_, [this] { flush(); }};
+    }
+
+    EXPECT_EQ(commits(), 2);
+}
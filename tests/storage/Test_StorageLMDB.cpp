@@ -0,0 +1,193 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "2_Factory.hpp"
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "opentxs/OT.hpp"
+#include "opentxs/Pimpl.hpp"
+#include "opentxs/Types.hpp"
+#include "opentxs/api/Context.hpp"
+#include "opentxs/api/client/Manager.hpp"
+#include "opentxs/api/storage/Plugin.hpp"
+#include "opentxs/core/Flag.hpp"
+#include "storage/StorageConfig.hpp"
+
+namespace fs = boost::filesystem;
+namespace ot = opentxs;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr auto writers_{8};
+constexpr auto writes_{500};
+
+class Test_StorageLMDB : public ::testing::Test
+{
+public:
+    const ot::api::client::Manager& api_;
+    const fs::path folder_;
+    const ot::OTFlag bucket_;
+    const ot::Digest digest_;
+    const ot::Random random_;
+    ot::StorageConfig config_;
+
+    static auto key(const int writer, const int i) -> std::string
+    {
+        return std::to_string(writer) + "-" + std::to_string(i);
+    }
+
+    auto make() const -> std::unique_ptr<ot::api::storage::Plugin>
+    {
+        return std::unique_ptr<ot::api::storage::Plugin>{
+            ot::Factory::StorageLMDB(
+                api_.Storage(), config_, digest_, random_, bucket_)};
+    }
+    // Every writer queues all of its writes through the writer pool, then
+    // waits for them
+    auto write(
+        const ot::api::storage::Plugin& driver,
+        const int writer,
+        const bool isTransaction) const -> bool
+    {
+        auto promises = std::vector<std::promise<bool>>(writes_);
+        auto futures = std::vector<std::future<bool>>{};
+        futures.reserve(promises.size());
+
+        for (auto i = 0; i < writes_; ++i) {
+            auto& promise = promises.at(static_cast<std::size_t>(i));
+            futures.emplace_back(promise.get_future());
+            driver.Store(
+                isTransaction, key(writer, i), "value", false, promise);
+        }
+
+        auto output{true};
+
+        for (auto& future : futures) { output &= future.get(); }
+
+        return output;
+    }
+
+    Test_StorageLMDB()
+        : api_(ot::Context().StartClient({}, 0))
+        , folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-storage-%%%%-%%%%-%%%%-%%%%"))
+        , bucket_(ot::Flag::Factory(false))
+        , digest_([](auto, auto, auto) { return false; })
+        , random_([] { return std::string{}; })
+        , config_()
+    {
+        fs::create_directories(folder_);
+        config_.path_ = folder_.string();
+    }
+
+    ~Test_StorageLMDB() override { fs::remove_all(folder_); }
+};
+}  // namespace
+
+TEST_F(Test_StorageLMDB, concurrent_writers)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    for (const auto isTransaction : {true, false}) {
+        auto threads = std::vector<std::future<bool>>{};
+        const auto start = Clock::now();
+
+        for (auto writer = 0; writer < writers_; ++writer) {
+            threads.emplace_back(std::async(std::launch::async, [&, writer] {
+                return write(*driver, writer, isTransaction);
+            }));
+        }
+
+        for (auto& thread : threads) { EXPECT_TRUE(thread.get()); }
+
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - start);
+        RecordProperty(
+            isTransaction ? "queued_writes_us" : "committed_writes_us",
+            static_cast<int>(elapsed.count()));
+    }
+
+    for (auto writer = 0; writer < writers_; ++writer) {
+        for (auto i = 0; i < writes_; ++i) {
+            auto value = std::string{};
+
+            EXPECT_TRUE(driver->LoadFromBucket(key(writer, i), value, false));
+            EXPECT_EQ(value, "value");
+        }
+    }
+}
+
+TEST_F(Test_StorageLMDB, queue_failure)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    const auto invalid = std::string(4096, 'k');
+
+    for (const auto isTransaction : {true, false}) {
+        auto rejected = std::promise<bool>{};
+        auto accepted = std::promise<bool>{};
+        auto rejectedFuture = rejected.get_future();
+        auto acceptedFuture = accepted.get_future();
+        driver->Store(isTransaction, invalid, "value", false, rejected);
+        driver->Store(isTransaction, "valid", "value", false, accepted);
+
+        EXPECT_FALSE(rejectedFuture.get());
+        EXPECT_TRUE(acceptedFuture.get());
+        EXPECT_FALSE(driver->Store(isTransaction, "", "value", false));
+    }
+}
+
+TEST_F(Test_StorageLMDB, shutdown_drains_writes)
+{
+    auto driver = make();
+
+    ASSERT_TRUE(driver);
+
+    auto promises = std::vector<std::promise<bool>>(writes_);
+    auto futures = std::vector<std::future<bool>>{};
+
+    for (auto i = 0; i < writes_; ++i) {
+        auto& promise = promises.at(static_cast<std::size_t>(i));
+        futures.emplace_back(promise.get_future());
+        driver->Store(false, key(0, i), "value", false, promise);
+    }
+
+    driver.reset();
+
+    for (auto& future : futures) {
+        ASSERT_EQ(
+            future.wait_for(std::chrono::seconds(0)),
+            std::future_status::ready);
+        EXPECT_TRUE(future.get());
+    }
+
+    driver = make();
+
+    for (auto i = 0; i < writes_; ++i) {
+        auto value = std::string{};
+
+        EXPECT_TRUE(driver->LoadFromBucket(key(0, i), value, false));
+    }
+}
@@ -0,0 +1,318 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Types.hpp"
+#include "opentxs/api/storage/Driver.hpp"
+#include "opentxs/protobuf/StorageThread.pb.h"
+#include "opentxs/protobuf/StorageThreadItem.pb.h"
+#include "opentxs/protobuf/StorageThreadPageHash.pb.h"
+#include "opentxs/protobuf/verify/StorageThread.hpp"
+#include "storage/Plugin.hpp"
+#include "storage/tree/Mailbox.hpp"
+#include "storage/tree/Thread.hpp"
+
+namespace ot = opentxs;
+
+namespace
+{
+// Holds every object in memory and counts how often objects are loaded
+class MemoryDriver final : public ot::api::storage::Driver
+{
+public:
+    mutable std::size_t loads_{};
+
+    auto EmptyBucket(const bool) const -> bool final { return true; }
+    auto Load(const std::string& key, const bool, std::string& value) const
+        -> bool final
+    {
+        ++loads_;
+        const auto it = data_.find(key);
+
+        if (data_.end() == it) { return false; }
+
+        value = it->second;
+
+        return true;
+    }
+    auto LoadFromBucket(
+        const std::string& key,
+        std::string& value,
+        const bool) const -> bool final
+    {
+        return Load(key, false, value);
+    }
+    auto LoadRoot() const -> std::string final { return {}; }
+    auto Migrate(const std::string&, const Driver&) const -> bool final
+    {
+        return false;
+    }
+    auto Store(
+        const bool,
+        const std::string& key,
+        const std::string& value,
+        const bool) const -> bool final
+    {
+        data_[key] = value;
+
+        return true;
+    }
+    void Store(
+        const bool isTransaction,
+        const std::string& key,
+        const std::string& value,
+        const bool bucket,
+        std::promise<bool>& promise) const final
+    {
+        promise.set_value(Store(isTransaction, key, value, bucket));
+    }
+    auto Store(const bool, const std::string& value, std::string& key) const
+        -> bool final
+    {
+        const auto count = std::to_string(++next_);
+        key = std::string(32u - count.size(), '0') + count;
+        data_[key] = value;
+
+        return true;
+    }
+    auto StoreRoot(const bool, const std::string&) const -> bool final
+    {
+        return true;
+    }
+
+private:
+    mutable std::map<std::string, std::string> data_{};
+    mutable std::size_t next_{};
+};
+
+class Test_StorageThread : public ::testing::Test
+{
+public:
+    static constexpr auto count_{600};
+    static const std::string thread_id_;
+    static const std::string participant_;
+
+    const MemoryDriver driver_;
+    std::unique_ptr<ot::storage::Mailbox> inbox_;
+    std::unique_ptr<ot::storage::Mailbox> outbox_;
+
+    static auto item_id(const int i) -> std::string
+    {
+        const auto number = std::to_string(i);
+
+        return std::string(32u - number.size(), '0') + number;
+    }
+
+    auto add(ot::storage::Thread& thread, const int i) const -> bool
+    {
+        return thread.Add(
+            item_id(i),
+            static_cast<std::uint64_t>(i),
+            ot::StorageBox::INCOMINGCHEQUE,
+            "",
+            "");
+    }
+    auto index(const ot::storage::Thread& thread) const
+        -> std::shared_ptr<ot::proto::StorageThread>
+    {
+        auto output = std::shared_ptr<ot::proto::StorageThread>{};
+        driver_.LoadProto(thread.Root(), output);
+
+        return output;
+    }
+    auto load(const std::string& hash) -> std::unique_ptr<ot::storage::Thread>
+    {
+        auto output = ot::storage::Thread::ForTestingOnlyFactory(
+            driver_, thread_id_, hash, *inbox_, *outbox_);
+        driver_.loads_ = 0;
+
+        return output;
+    }
+    auto make() -> std::unique_ptr<ot::storage::Thread>
+    {
+        auto output = ot::storage::Thread::ForTestingOnlyFactory(
+            driver_,
+            thread_id_,
+            std::set<std::string>{participant_},
+            *inbox_,
+            *outbox_);
+
+        for (auto i = 0; i < count_; ++i) {
+            EXPECT_TRUE(add(*output, i));
+        }
+
+        return output;
+    }
+    auto unread(const ot::storage::Thread& thread, const int i) const -> bool
+    {
+        const auto items = thread.Items();
+
+        for (const auto& item : items.item()) {
+            if (item.id() == item_id(i)) { return item.unread(); }
+        }
+
+        ADD_FAILURE() << "missing item " << i;
+
+        return false;
+    }
+
+    Test_StorageThread()
+        : driver_()
+        , inbox_(ot::storage::Mailbox::ForTestingOnlyFactory(driver_, ""))
+        , outbox_(ot::storage::Mailbox::ForTestingOnlyFactory(driver_, ""))
+    {
+    }
+};
+
+const std::string Test_StorageThread::thread_id_{item_id(1000000)};
+const std::string Test_StorageThread::participant_{item_id(2000000)};
+}  // namespace
+
+TEST_F(Test_StorageThread, add_across_pages)
+{
+    const auto thread = make();
+    const auto serialized = index(*thread);
+
+    ASSERT_TRUE(serialized);
+    EXPECT_EQ(serialized->version(), 2u);
+    EXPECT_EQ(serialized->item_size(), 0);
+    ASSERT_EQ(serialized->page_size(), 3);
+    EXPECT_EQ(serialized->page(0).count(), 256u);
+    EXPECT_EQ(serialized->page(1).count(), 256u);
+    EXPECT_EQ(serialized->page(2).count(), 88u);
+    EXPECT_EQ(thread->Items().item_size(), count_);
+    EXPECT_EQ(thread->UnreadCount(), static_cast<std::size_t>(count_));
+
+    // Adding an existing item updates it in place
+    EXPECT_TRUE(add(*thread, 0));
+    EXPECT_EQ(thread->Items().item_size(), count_);
+}
+
+TEST_F(Test_StorageThread, load_pages_on_demand)
+{
+    const auto reloaded = load(make()->Root());
+
+    EXPECT_EQ(reloaded->UnreadCount(), static_cast<std::size_t>(count_));
+    EXPECT_EQ(driver_.loads_, 0u);
+    EXPECT_TRUE(reloaded->Check(item_id(count_ - 1)));
+    EXPECT_EQ(driver_.loads_, 1u);
+    EXPECT_TRUE(reloaded->Check(item_id(0)));
+    EXPECT_EQ(driver_.loads_, 3u);
+    EXPECT_FALSE(reloaded->Check(item_id(count_)));
+    EXPECT_EQ(driver_.loads_, 3u);
+}
+
+TEST_F(Test_StorageThread, read_across_pages)
+{
+    auto reloaded = load(make()->Root());
+
+    EXPECT_TRUE(reloaded->Read(item_id(0), false));
+    EXPECT_TRUE(reloaded->Read(item_id(300), false));
+    EXPECT_TRUE(reloaded->Read(item_id(count_ - 1), false));
+    EXPECT_FALSE(reloaded->Read(item_id(count_), false));
+    EXPECT_EQ(reloaded->UnreadCount(), static_cast<std::size_t>(count_ - 3));
+
+    reloaded = load(reloaded->Root());
+
+    EXPECT_EQ(reloaded->UnreadCount(), static_cast<std::size_t>(count_ - 3));
+    EXPECT_EQ(driver_.loads_, 0u);
+    EXPECT_FALSE(unread(*reloaded, 0));
+    EXPECT_FALSE(unread(*reloaded, 300));
+    EXPECT_FALSE(unread(*reloaded, count_ - 1));
+    EXPECT_TRUE(unread(*reloaded, 1));
+}
+
+TEST_F(Test_StorageThread, remove_across_pages)
+{
+    auto reloaded = load(make()->Root());
+
+    EXPECT_TRUE(reloaded->Remove(item_id(0)));
+    EXPECT_FALSE(reloaded->Remove(item_id(0)));
+
+    // Empty the middle page
+    for (auto i = 256; i < 512; ++i) {
+        EXPECT_TRUE(reloaded->Remove(item_id(i)));
+    }
+
+    reloaded = load(reloaded->Root());
+    const auto serialized = index(*reloaded);
+
+    ASSERT_TRUE(serialized);
+    ASSERT_EQ(serialized->page_size(), 2);
+    EXPECT_EQ(serialized->page(0).count(), 255u);
+    EXPECT_EQ(serialized->page(1).count(), 88u);
+    EXPECT_FALSE(reloaded->Check(item_id(0)));
+    EXPECT_FALSE(reloaded->Check(item_id(300)));
+    EXPECT_TRUE(reloaded->Check(item_id(1)));
+    EXPECT_TRUE(reloaded->Check(item_id(512)));
+    EXPECT_EQ(reloaded->Items().item_size(), count_ - 257);
+
+    // New items go to the last page, which has room
+    EXPECT_TRUE(add(*reloaded, count_));
+    ASSERT_EQ(index(*reloaded)->page_size(), 2);
+    EXPECT_EQ(index(*reloaded)->page(1).count(), 89u);
+}
+
+TEST_F(Test_StorageThread, upgrade_version_1)
+{
+    constexpr auto items{300};
+    constexpr auto box =
+        static_cast<std::uint32_t>(ot::StorageBox::INCOMINGCHEQUE);
+    auto original = ot::proto::StorageThread{};
+    original.set_version(1);
+    original.set_id(thread_id_);
+    original.add_participant(participant_);
+
+    for (auto i = 0; i < items; ++i) {
+        auto& item = *original.add_item();
+        item.set_version(1);
+        item.set_id(item_id(i));
+        item.set_index(static_cast<std::uint64_t>(i));
+        item.set_time(static_cast<std::uint64_t>(i));
+        item.set_box(box);
+        item.set_unread(true);
+    }
+
+    auto hash = std::string{};
+
+    ASSERT_TRUE(driver_.StoreProto(original, hash));
+
+    auto thread = load(hash);
+
+    EXPECT_EQ(thread->UpgradeLevel(), 1u);
+    EXPECT_EQ(thread->Items().item_size(), items);
+    EXPECT_EQ(thread->UnreadCount(), static_cast<std::size_t>(items));
+
+    // The next save writes the version 2 format
+    EXPECT_TRUE(thread->Read(item_id(5), false));
+
+    const auto serialized = index(*thread);
+
+    ASSERT_TRUE(serialized);
+    EXPECT_EQ(serialized->version(), 2u);
+    EXPECT_EQ(serialized->item_size(), 0);
+    ASSERT_EQ(serialized->page_size(), 2);
+    EXPECT_EQ(serialized->page(0).count(), 256u);
+    EXPECT_EQ(serialized->page(1).count(), 44u);
+
+    thread = load(thread->Root());
+
+    EXPECT_EQ(thread->UnreadCount(), static_cast<std::size_t>(items - 1));
+    EXPECT_EQ(driver_.loads_, 0u);
+    EXPECT_EQ(thread->Items().item_size(), items);
+    EXPECT_FALSE(unread(*thread, 5));
+    EXPECT_TRUE(unread(*thread, 6));
+}
@@ -0,0 +1,375 @@
+// Copyright (c) 2010-2020 The Open-Transactions developers
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "OTTestEnvironment.hpp"  // IWYU pragma: keep
+#include "opentxs/Bytes.hpp"
+#include "opentxs/Version.hpp"
+#include "opentxs/core/Log.hpp"
+#include "util/LMDB.hpp"
+
+namespace fs = boost::filesystem;
+namespace lmdb = opentxs::storage::lmdb;
+
+namespace
+{
+constexpr auto values_ = lmdb::Table{0};
+constexpr auto duplicates_ = lmdb::Table{1};
+
+class Test_LMDB : public ::testing::Test
+{
+public:
+    static const lmdb::TableNames names_;
+
+    const fs::path folder_;
+
+    auto make(const std::size_t size = OT_LMDB_SIZE) const
+        -> std::unique_ptr<lmdb::LMDB>
+    {
+        return std::make_unique<lmdb::LMDB>(
+            names_,
+            folder_.string(),
+            lmdb::TablesToInit{{values_, 0}, {duplicates_, MDB_DUPSORT}},
+            0,
+            size);
+    }
+
+    auto load(const lmdb::LMDB& db, const lmdb::Table table, const char* key)
+        const -> std::vector<std::string>
+    {
+        auto output = std::vector<std::string>{};
+        db.Load(
+            table,
+            key,
+            [&](const auto data) { output.emplace_back(data); },
+            lmdb::LMDB::Mode::Multiple);
+
+        return output;
+    }
+
+    Test_LMDB()
+        : folder_(
+              fs::temp_directory_path() /
+              fs::unique_path("opentxs-lmdb-%%%%-%%%%-%%%%-%%%%"))
+    {
+        fs::create_directories(folder_);
+    }
+
+    ~Test_LMDB() override { fs::remove_all(folder_); }
+};
+
+const lmdb::TableNames Test_LMDB::names_{
+    {values_, "values"},
+    {duplicates_, "duplicates"},
+};
+}  // namespace
+
+TEST_F(Test_LMDB, read_your_writes)
+{
+    auto db = make();
+
+    ASSERT_TRUE(db->Store(values_, "b", "stored").first);
+
+    {
+        // The flusher can not commit while this thread holds the writer lock
+        auto blocker = db->TransactionRW();
+
+        EXPECT_TRUE(db->Queue(values_, "a", "queued"));
+        EXPECT_TRUE(db->Queue(values_, "b", "replaced"));
+        EXPECT_TRUE(db->Queue(duplicates_, "d", "1"));
+        EXPECT_TRUE(db->Queue(duplicates_, "d", "2"));
+        EXPECT_TRUE(db->Queue(values_, "b", "ignored", MDB_NOOVERWRITE));
+        EXPECT_TRUE(db->Exists(values_, "a"));
+        EXPECT_EQ(
+            load(*db, values_, "a"), std::vector<std::string>{"queued"});
+        EXPECT_EQ(
+            load(*db, values_, "b"), std::vector<std::string>{"replaced"});
+        EXPECT_EQ(
+            load(*db, duplicates_, "d"), (std::vector<std::string>{"1", "2"}));
+
+        auto visited = std::vector<std::string>{};
+        db->ReadRange(
+            values_,
+            "a",
+            std::nullopt,
+            [&](const auto key, const auto value) {
+                visited.emplace_back(std::string{key} + std::string{value});
+
+                return true;
+            });
+
+        EXPECT_EQ(
+            visited, (std::vector<std::string>{"aqueued", "breplaced"}));
+        EXPECT_TRUE(db->QueueDelete(values_, "a"));
+        EXPECT_FALSE(db->Exists(values_, "a"));
+        EXPECT_FALSE(db->Commit());
+        EXPECT_EQ(db->Metrics().batches_, 0u);
+
+        blocker.Finalize(false);
+    }
+
+    EXPECT_TRUE(db->Commit());
+    EXPECT_EQ(db->Metrics().failures_, 0u);
+    EXPECT_FALSE(db->Exists(values_, "a"));
+    EXPECT_EQ(load(*db, values_, "b"), std::vector<std::string>{"replaced"});
+
+    db.reset();
+    db = make();
+
+    EXPECT_FALSE(db->Exists(values_, "a"));
+    EXPECT_EQ(load(*db, values_, "b"), std::vector<std::string>{"replaced"});
+    EXPECT_EQ(
+        load(*db, duplicates_, "d"), (std::vector<std::string>{"1", "2"}));
+}
+
+TEST_F(Test_LMDB, self_commit)
+{
+    auto db = make();
+    const auto value = std::string(4u * 1024u * 1024u, 'x');
+    const auto keys = std::vector<std::string>{"a", "b", "c", "d"};
+
+    for (const auto& key : keys) {
+        EXPECT_TRUE(db->Queue(values_, key, value));
+    }
+
+    // The last write filled the batch, so it was committed before Queue
+    // returned
+    const auto metrics = db->Metrics();
+
+    EXPECT_EQ(metrics.writes_, keys.size());
+    EXPECT_GE(metrics.batches_, 1u);
+    EXPECT_GE(metrics.bytes_, keys.size() * value.size());
+    EXPECT_EQ(metrics.failures_, 0u);
+    EXPECT_GE(metrics.max_latency_, metrics.last_latency_);
+}
+
+TEST_F(Test_LMDB, flusher)
+{
+    auto db = make();
+
+    EXPECT_TRUE(db->Queue(values_, "a", "value"));
+
+    for (auto i = 0; i < 100; ++i) {
+        if (0 < db->Metrics().batches_) { break; }
+
+        opentxs::Sleep(std::chrono::milliseconds(50));
+    }
+
+    EXPECT_EQ(db->Metrics().batches_, 1u);
+    EXPECT_EQ(db->Metrics().writes_, 1u);
+}
+
+TEST_F(Test_LMDB, invalid_write)
+{
+    auto db = make();
+    const auto key = std::string(4096, 'k');
+
+    EXPECT_FALSE(db->Queue(values_, key, "value"));
+    EXPECT_FALSE(db->Queue(values_, "", "value"));
+    EXPECT_FALSE(db->Queue(duplicates_, "d", key));
+    EXPECT_FALSE(db->Queue(values_, "a", "value", MDB_APPEND));
+    EXPECT_TRUE(db->Queue(values_, "a", "value"));
+    EXPECT_TRUE(db->Commit());
+}
+
+TEST_F(Test_LMDB, failed_commit)
+{
+    // Too small for the queued writes
+    auto db = make(1024u * 1024u);
+    const auto value = std::string(64u * 1024u, 'x');
+    auto keys = std::vector<std::string>{};
+
+    {
+        // Keep the flusher from trying to commit before the batch is complete
+        auto blocker = db->TransactionRW();
+
+        for (auto i = 0; i < 32; ++i) {
+            const auto& key = keys.emplace_back(std::to_string(i));
+
+            ASSERT_TRUE(db->Queue(values_, key, value));
+        }
+
+        blocker.Finalize(false);
+    }
+
+    EXPECT_FALSE(db->Commit());
+    EXPECT_GE(db->Metrics().failures_, 1u);
+    EXPECT_EQ(db->Metrics().batches_, 0u);
+
+    // The writes are kept for the next attempt and remain visible
+    for (const auto& key : keys) {
+        EXPECT_EQ(load(*db, values_, key.c_str()).size(), 1u);
+    }
+
+    EXPECT_FALSE(db->Queue(values_, "rejected", "value"));
+    EXPECT_FALSE(db->Exists(values_, "rejected"));
+    EXPECT_FALSE(db->Store(values_, "rejected", "value").first);
+}
+
+TEST_F(Test_LMDB, read_range)
+{
+    auto db = make();
+
+    for (const auto* key : {"a", "b", "c", "d", "e", "f"}) {
+        ASSERT_TRUE(db->Store(values_, key, key).first);
+    }
+
+    const auto range = [&](const char* start,
+                           const std::optional<std::string_view> end,
+                           const lmdb::LMDB::Dir dir,
+                           const std::size_t limit = 0) {
+        auto output = std::string{};
+        db->ReadRange(
+            values_,
+            start,
+            end,
+            [&](const auto key, const auto) {
+                output.append(key);
+
+                return true;
+            },
+            dir,
+            limit);
+
+        return output;
+    };
+    constexpr auto forward = lmdb::LMDB::Dir::Forward;
+    constexpr auto backward = lmdb::LMDB::Dir::Backward;
+
+    EXPECT_EQ(range("b", "d", forward), "bcd");
+    EXPECT_EQ(range("bb", std::nullopt, forward), "cdef");
+    EXPECT_EQ(range("", "b", forward), "ab");
+    EXPECT_EQ(range("g", std::nullopt, forward), "");
+    EXPECT_EQ(range("d", "b", backward), "dcb");
+    EXPECT_EQ(range("cc", std::nullopt, backward), "cba");
+    EXPECT_EQ(range("z", "e", backward), "fe");
+    EXPECT_EQ(range("a", std::nullopt, forward, 2), "ab");
+    EXPECT_EQ(range("f", std::nullopt, backward, 3), "fed");
+
+    auto visited = std::string{};
+    db->ReadRange(values_, "a", std::nullopt, [&](const auto key, const auto) {
+        visited.append(key);
+
+        return "c" != key;
+    });
+
+    EXPECT_EQ(visited, "abc");
+
+    {
+        // Queued writes are merged into the scan before they are committed
+        auto blocker = db->TransactionRW();
+
+        EXPECT_TRUE(db->Queue(values_, "bb", "bb"));
+        EXPECT_TRUE(db->QueueDelete(values_, "c"));
+        EXPECT_EQ(range("b", "d", forward), "bbbd");
+        EXPECT_EQ(range("d", "b", backward), "dbbb");
+
+        blocker.Finalize(false);
+    }
+
+    EXPECT_TRUE(db->Commit());
+    EXPECT_EQ(range("b", "d", forward), "bbbd");
+}
+
+TEST_F(Test_LMDB, read_range_duplicates)
+{
+    auto db = make();
+
+    for (const auto* value : {"1", "2", "3"}) {
+        ASSERT_TRUE(db->Store(duplicates_, "b", value).first);
+    }
+
+    ASSERT_TRUE(db->Store(duplicates_, "a", "0").first);
+    ASSERT_TRUE(db->Store(duplicates_, "c", "4").first);
+
+    const auto range = [&](const char* start, const lmdb::LMDB::Dir dir) {
+        auto output = std::string{};
+        db->ReadRange(
+            duplicates_,
+            start,
+            std::nullopt,
+            [&](const auto, const auto value) {
+                output.append(value);
+
+                return true;
+            },
+            dir);
+
+        return output;
+    };
+
+    EXPECT_EQ(range("b", lmdb::LMDB::Dir::Forward), "1234");
+    EXPECT_EQ(range("b", lmdb::LMDB::Dir::Backward), "3210");
+}
+
+TEST_F(Test_LMDB, read_prefix)
+{
+    auto db = make();
+    const auto max = std::string{"p\xff"};
+
+    for (const auto& key : {std::string{"o"},
+                            std::string{"p"},
+                            std::string{"p1"},
+                            std::string{"p2"},
+                            max,
+                            std::string{"q"}}) {
+        ASSERT_TRUE(db->Store(values_, key, "value").first);
+    }
+
+    const auto prefix = [&](const std::string& value,
+                            const lmdb::LMDB::Dir dir,
+                            const std::size_t limit = 0) {
+        auto output = std::vector<std::string>{};
+        db->ReadPrefix(
+            values_,
+            value,
+            [&](const auto key, const auto) {
+                output.emplace_back(key);
+
+                return true;
+            },
+            dir,
+            limit);
+
+        return output;
+    };
+    using Keys = std::vector<std::string>;
+
+    EXPECT_EQ(
+        prefix("p", lmdb::LMDB::Dir::Forward), (Keys{"p", "p1", "p2", max}));
+    EXPECT_EQ(
+        prefix("p", lmdb::LMDB::Dir::Backward), (Keys{max, "p2", "p1", "p"}));
+    EXPECT_EQ(prefix("p", lmdb::LMDB::Dir::Forward, 2), (Keys{"p", "p1"}));
+    EXPECT_EQ(prefix(max, lmdb::LMDB::Dir::Backward), (Keys{max}));
+    EXPECT_EQ(prefix("p1", lmdb::LMDB::Dir::Forward), (Keys{"p1"}));
+    EXPECT_TRUE(prefix("r", lmdb::LMDB::Dir::Forward).empty());
+    EXPECT_TRUE(prefix("n", lmdb::LMDB::Dir::Backward).empty());
+
+    {
+        auto blocker = db->TransactionRW();
+
+        EXPECT_TRUE(db->Queue(values_, "p0", "value"));
+        EXPECT_TRUE(db->QueueDelete(values_, "p2"));
+        EXPECT_EQ(
+            prefix("p", lmdb::LMDB::Dir::Forward),
+            (Keys{"p", "p0", "p1", max}));
+        EXPECT_EQ(
+            prefix("p", lmdb::LMDB::Dir::Backward),
+            (Keys{max, "p1", "p0", "p"}));
+
+        blocker.Finalize(false);
+    }
+}